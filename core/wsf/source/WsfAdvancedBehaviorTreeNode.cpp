@@ -636,6 +636,13 @@ WsfAdvancedBehaviorTreeNodeTypes::LoadResult WsfAdvancedBehaviorTreeNodeTypes::L
    return result;
 }
 
+bool WsfAdvancedBehaviorTreeNodeTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("advanced_behavior");
+   aKeywords.push_back("condition");
+   return true;
+}
+
 
 WsfAdvancedBehaviorTreeNode::WsfAdvancedBehaviorTreeNode(const WsfScenario& aScenario)
    : mScenario(aScenario)
@@ -526,6 +526,8 @@ public:
     * @param aInput input to read from.
     */
    LoadResult LoadType(UtInput& aInput) override;
+
+   bool GetInputKeywords(std::vector<std::string>& aKeywords) const override;
 };
 
 class WSF_EXPORT WsfAdvancedBehaviorTreeLeafNode : public WsfAdvancedBehaviorTreeNode
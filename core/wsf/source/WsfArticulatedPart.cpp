@@ -353,6 +353,12 @@ void WsfArticulatedPart::SetPlatform(WsfPlatform* aPlatformPtr)
    }
 }
 
+// =================================================================================================
+//! Articulated parts (comm devices, visual parts and the like) are not told about other platforms by default.
+//! A derived part that overrides PlatformAdded or PlatformDeleted must override this as well (see WsfSensor).
+// virtual
+void WsfArticulatedPart::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // =================================================================================================
 //! Set the platform-relative (ECS) roll angle of the articulated part.
 void WsfArticulatedPart::SetRoll(double aRoll)
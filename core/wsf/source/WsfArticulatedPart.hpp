@@ -91,6 +91,7 @@ public:
    bool        Initialize(double aSimTime) override;
    bool        ProcessInput(UtInput& aInput) override;
    void        SetPlatform(WsfPlatform* aPlatformPtr) override;
+   void        AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    //@}
 
    virtual void UpdatePosition(double aSimTime);
@@ -858,6 +858,24 @@ WsfCSV_EventOutputData::WsfCSV_EventOutputData()
    }
 
    AddDataTags("TEAM_NAME_DEFINITION", {"time<time>", "event<string>", "platform<string>", "side<string>"});
+
+   {
+      // ZONE_ENTERED, ZONE_EXITED
+      std::vector<std::string> temp = {"time<time>",
+                                       "event<string>",
+                                       "platform<string>",
+                                       "side<string>",
+                                       "zone<string>",
+                                       "crossing_time<time>",
+                                       "lat<lat>",
+                                       "lon<lon>",
+                                       "alt<double>",
+                                       "x<double>",
+                                       "y<double>",
+                                       "z<double>"};
+      AddDataTags("ZONE_ENTERED", temp);
+      AddDataTags("ZONE_EXITED", temp);
+   }
 }
 
 // =================================================================================================
@@ -156,6 +156,7 @@ WsfCommandChain& WsfCommandChain::operator=(const WsfCommandChain& aRhs)
       mPeers.clear();
       mSubordinates.clear();
       mPlatformClassPtr = aRhs.mPlatformClassPtr;
+      ++mChangeCount;
    }
    return *this;
 }
@@ -178,7 +179,11 @@ void WsfCommandChain::SetCommander(WsfPlatform* aPlatformPtr)
       // Commander didn't change, ensure the commander pointer is set properly and exit if not set or valid
       if ((mCommanderPtr == nullptr) || (mCommanderPtr == aPlatformPtr))
       {
-         mCommanderPtr = aPlatformPtr;
+         if (mCommanderPtr != aPlatformPtr)
+         {
+            mCommanderPtr = aPlatformPtr;
+            ++mChangeCount;
+         }
          return;
       }
    }
@@ -209,6 +214,7 @@ void WsfCommandChain::SetCommander(WsfPlatform* aPlatformPtr)
    // Setup my new commander
    mCommanderPtr  = aPlatformPtr;
    mCommanderName = mCommanderPtr->GetNameId();
+   ++mChangeCount;
 
    // Clear my new commander from my previous peers' peer lists, if present
    RemovePeer(mCommanderPtr);
@@ -242,6 +248,12 @@ void WsfCommandChain::SetCommander(WsfPlatform* aPlatformPtr)
          }
       }
    }
+
+   // The platforms to which this chain is related are indexed by commander name.
+   if ((mPlatformPtr != nullptr) && (mPlatformPtr->GetSimulation() != nullptr))
+   {
+      mPlatformPtr->GetSimulation()->PlatformInterestChanged(*mPlatformPtr);
+   }
 }
 
 // ================================================================================================
@@ -258,6 +270,7 @@ void WsfCommandChain::AddPeer(WsfPlatform* aPlatformPtr)
    if (std::find(mPeers.begin(), mPeers.end(), aPlatformPtr) == mPeers.end())
    {
       mPeers.push_back(aPlatformPtr);
+      ++mChangeCount;
    }
 }
 
@@ -271,6 +284,7 @@ void WsfCommandChain::RemovePeer(WsfPlatform* aPlatformPtr)
       if ((iter = std::find(mPeers.begin(), mPeers.end(), aPlatformPtr)) != mPeers.end())
       {
          mPeers.erase(iter);
+         ++mChangeCount;
       }
    }
 }
@@ -282,6 +296,7 @@ void WsfCommandChain::AddSubordinate(WsfPlatform* aPlatformPtr)
    if (std::find(mSubordinates.begin(), mSubordinates.end(), aPlatformPtr) == mSubordinates.end())
    {
       mSubordinates.push_back(aPlatformPtr);
+      ++mChangeCount;
    }
 }
 
@@ -295,6 +310,7 @@ void WsfCommandChain::RemoveSubordinate(WsfPlatform* aPlatformPtr)
       if ((iter = std::find(mSubordinates.begin(), mSubordinates.end(), aPlatformPtr)) != mSubordinates.end())
       {
          mSubordinates.erase(iter);
+         ++mChangeCount;
       }
    }
 }
@@ -339,6 +355,7 @@ bool WsfCommandChain::Initialize(double /* aSimTime */)
    {
       mCommanderPtr  = mPlatformPtr;
       mCommanderName = mPlatformPtr->GetNameId();
+      ++mChangeCount;
    }
 
    mPlatformClassPtr = mPlatformPtr->GetSimulation()->GetScenario().GetScriptTypes()->GetClass("WsfPlatform");
@@ -459,6 +476,7 @@ void WsfCommandChain::PlatformDeleted(WsfPlatform* aPlatformPtr)
       // Assume SELF command since commander is deleted
       mCommanderPtr  = mPlatformPtr;
       mCommanderName = mPlatformPtr->GetNameId();
+      ++mChangeCount;
 
       // The script may set a new commander
       // Execute any script - commander deletion
@@ -489,6 +507,7 @@ void WsfCommandChain::PlatformDeleted(WsfPlatform* aPlatformPtr)
 
       // One of my peers is being deleted.
       mPeers.erase(iter);
+      ++mChangeCount;
 
       if (defChainPtr)
       {
@@ -511,6 +530,7 @@ void WsfCommandChain::PlatformDeleted(WsfPlatform* aPlatformPtr)
 
       // One of my direct subordinates is being deleted.
       mSubordinates.erase(iter);
+      ++mChangeCount;
 
       if (defChainPtr)
       {
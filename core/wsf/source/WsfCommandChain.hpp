@@ -96,6 +96,10 @@ public:
    void RemoveSubordinate(WsfPlatform* aPlatformPtr);
    //@}
 
+   //! Return a count that is incremented whenever the commander, peers or subordinates change.
+   //! Users that cache information derived from the command chain may compare it to detect a change.
+   unsigned int GetChangeCount() const { return mChangeCount; }
+
    //! @name Simulation infrastructure methods.
    //@(
    bool Initialize(double aSimTime) override;
@@ -122,6 +126,7 @@ private:
    WsfPlatform*              mCommanderPtr;
    std::vector<WsfPlatform*> mPeers;
    std::vector<WsfPlatform*> mSubordinates;
+   unsigned int              mChangeCount{0};
 
    UtScriptClass* mPlatformClassPtr;
 };
@@ -11,6 +11,8 @@
 
 #include "WsfComponentList.hpp"
 
+#include <iterator>
+
 // ================================================================================================
 WsfComponentList::WsfComponentList() {}
 
@@ -43,7 +45,12 @@ WsfComponentList& WsfComponentList::operator=(WsfComponentList&& aRhs)
    if (this != &aRhs)
    {
       DeleteAllP(true);
-      mComponentsByName = std::move(aRhs.mComponentsByName);
+      mComponentsByName   = std::move(aRhs.mComponentsByName);
+      mComponentsByRole   = std::move(aRhs.mComponentsByRole);
+      mComponentsWithName = std::move(aRhs.mComponentsWithName);
+      aRhs.mComponentsByName.clear();
+      aRhs.mComponentsByRole.clear();
+      aRhs.mComponentsWithName.clear();
    }
    return *this;
 }
@@ -70,15 +77,12 @@ bool WsfComponentList::DeleteComponent(WsfStringId aName, int aRole)
 //! @returns The count of components who have the specified role.
 unsigned int WsfComponentList::GetComponentCount(int aRole) const
 {
-   unsigned int count = 0;
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto roleIter = mComponentsByRole.find(aRole);
+   if (roleIter != mComponentsByRole.end())
    {
-      if (mComponentsByName[i].second->ComponentHasRole(aRole))
-      {
-         ++count;
-      }
+      return static_cast<unsigned int>(roleIter->second.size());
    }
-   return count;
+   return 0;
 }
 
 // ================================================================================================
@@ -124,6 +128,7 @@ void WsfComponentList::DeleteAllP(bool aDoNotify)
    while (!mComponentsByName.empty())
    {
       WsfComponent* componentPtr = mComponentsByName.back().second;
+      UnindexComponent(mComponentsByName.back().first, componentPtr);
       mComponentsByName.pop_back();
       if (aDoNotify)
       {
@@ -153,11 +158,11 @@ bool WsfComponentList::AddComponentP(WsfComponent* aComponentPtr, bool aDoNotify
 
    WsfStringId name(aComponentPtr->GetComponentName());
    int         role(aComponentPtr->GetComponentRoles()[0]); // The 'primary' role
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto        nameIter = mComponentsWithName.find(name);
+   if (nameIter != mComponentsWithName.end())
    {
-      if (mComponentsByName[i].first == name)
+      for (WsfComponent* componentPtr : nameIter->second)
       {
-         WsfComponent* componentPtr(mComponentsByName[i].second);
          if (componentPtr->GetComponentRoles()[0] == role)
          {
             return false; // Error, name and role matches
@@ -165,6 +170,7 @@ bool WsfComponentList::AddComponentP(WsfComponent* aComponentPtr, bool aDoNotify
       }
    }
    mComponentsByName.push_back(NameAndComponent(name, aComponentPtr));
+   IndexComponent(name, aComponentPtr);
    if (aDoNotify)
    {
       ComponentAdded(aComponentPtr); // Inform the derived class
@@ -183,12 +189,10 @@ bool WsfComponentList::DeleteComponentP(WsfStringId aName, int aRole, bool aDoNo
 // protected
 WsfComponent* WsfComponentList::FindComponentP(WsfStringId aName) const
 {
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto nameIter = mComponentsWithName.find(aName);
+   if (nameIter != mComponentsWithName.end())
    {
-      if (mComponentsByName[i].first == aName)
-      {
-         return mComponentsByName[i].second;
-      }
+      return nameIter->second.front();
    }
    return nullptr;
 }
@@ -203,11 +207,11 @@ WsfComponent* WsfComponentList::FindComponentP(WsfStringId aName) const
 //! @returns A pointer to the component if found. 0 if the requested component does not exist.
 WsfComponent* WsfComponentList::FindComponentP(WsfStringId aName, int aRole) const
 {
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto nameIter = mComponentsWithName.find(aName);
+   if (nameIter != mComponentsWithName.end())
    {
-      if (mComponentsByName[i].first == aName)
+      for (WsfComponent* componentPtr : nameIter->second)
       {
-         WsfComponent* componentPtr(mComponentsByName[i].second);
          if (componentPtr->ComponentHasRole(aRole))
          {
             return componentPtr;
@@ -221,12 +225,10 @@ WsfComponent* WsfComponentList::FindComponentP(WsfStringId aName, int aRole) con
 // protected
 WsfComponent* WsfComponentList::FindComponentByRoleP(int aRole) const
 {
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto roleIter = mComponentsByRole.find(aRole);
+   if (roleIter != mComponentsByRole.end())
    {
-      if (mComponentsByName[i].second->ComponentHasRole(aRole))
-      {
-         return mComponentsByName[i].second;
-      }
+      return roleIter->second.front();
    }
    return nullptr;
 }
@@ -234,17 +236,10 @@ WsfComponent* WsfComponentList::FindComponentByRoleP(int aRole) const
 // ================================================================================================
 WsfComponent* WsfComponentList::GetComponentEntryByRoleP(int aRole, unsigned int aEntry) const
 {
-   unsigned int count = 0;
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   auto roleIter = mComponentsByRole.find(aRole);
+   if ((roleIter != mComponentsByRole.end()) && (aEntry < roleIter->second.size()))
    {
-      if (mComponentsByName[i].second->ComponentHasRole(aRole))
-      {
-         if (count == aEntry)
-         {
-            return mComponentsByName[i].second;
-         }
-         ++count;
-      }
+      return roleIter->second[aEntry];
    }
    return nullptr;
 }
@@ -252,25 +247,75 @@ WsfComponent* WsfComponentList::GetComponentEntryByRoleP(int aRole, unsigned int
 // ================================================================================================
 bool WsfComponentList::RemoveComponentP(WsfStringId aName, int aRole, bool aDelete, bool aDoNotify)
 {
-   for (size_t i = 0; i < mComponentsByName.size(); ++i)
+   WsfComponent* componentPtr = FindComponentP(aName, aRole);
+   if (componentPtr == nullptr)
    {
-      if (mComponentsByName[i].first == aName)
+      return false;
+   }
+
+   auto iter = std::find_if(mComponentsByName.begin(),
+                            mComponentsByName.end(),
+                            [componentPtr](const NameAndComponent& aEntry) { return aEntry.second == componentPtr; });
+   UnindexComponent(aName, componentPtr);
+   mComponentsByName.erase(iter);
+   if (aDoNotify)
+   {
+      ComponentDeleted(componentPtr); // Inform the derived class
+   }
+   if (aDelete)
+   {
+      delete componentPtr;
+   }
+   return true;
+}
+
+// ================================================================================================
+//! Add a component that has been appended to mComponentsByName to the role and name indices.
+//! The component is indexed under each of the roles in GetComponentRoles that it supports.
+// private
+void WsfComponentList::IndexComponent(WsfStringId aName, WsfComponent* aComponentPtr)
+{
+   for (const int* rolePtr = aComponentPtr->GetComponentRoles(); *rolePtr != cWSF_COMPONENT_NULL; ++rolePtr)
+   {
+      if (aComponentPtr->ComponentHasRole(*rolePtr))
       {
-         WsfComponent* componentPtr(mComponentsByName[i].second);
-         if (componentPtr->ComponentHasRole(aRole))
+         IndexEntry& entry = mComponentsByRole[*rolePtr];
+         if (entry.empty() || (entry.back() != aComponentPtr)) // In case a role is listed more than once
          {
-            mComponentsByName.erase(mComponentsByName.begin() + i);
-            if (aDoNotify)
-            {
-               ComponentDeleted(componentPtr); // Inform the derived class
-            }
-            if (aDelete)
-            {
-               delete componentPtr;
-            }
-            return true;
+            entry.push_back(aComponentPtr);
          }
       }
    }
-   return false;
+   mComponentsWithName[aName].push_back(aComponentPtr);
+}
+
+// ================================================================================================
+//! Remove a component from the role and name indices.
+// private
+void WsfComponentList::UnindexComponent(WsfStringId aName, WsfComponent* aComponentPtr)
+{
+   // Components are most often removed from the end of the list, so each entry is searched from the back.
+   auto unindex = [aComponentPtr](IndexEntry& aEntry)
+   {
+      auto iter = std::find(aEntry.rbegin(), aEntry.rend(), aComponentPtr);
+      if (iter != aEntry.rend())
+      {
+         aEntry.erase(std::next(iter).base());
+      }
+      return aEntry.empty();
+   };
+
+   for (const int* rolePtr = aComponentPtr->GetComponentRoles(); *rolePtr != cWSF_COMPONENT_NULL; ++rolePtr)
+   {
+      auto roleIter = mComponentsByRole.find(*rolePtr);
+      if ((roleIter != mComponentsByRole.end()) && unindex(roleIter->second))
+      {
+         mComponentsByRole.erase(roleIter);
+      }
+   }
+   auto nameIter = mComponentsWithName.find(aName);
+   if ((nameIter != mComponentsWithName.end()) && unindex(nameIter->second))
+   {
+      mComponentsWithName.erase(nameIter);
+   }
 }
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,11 @@
 // PROGRAMMING NOTE: The base class should not include the AddComponent method. This is a requirement
 //                   to ensure type-safety of derived component lists. Otherwise it would be possible
 //                   to inject components of the wrong type into a typed component list.
+//
+// PROGRAMMING NOTE: The lookups by role and by name use indices that are maintained as components are
+//                   added and removed. A component is indexed under each role in GetComponentRoles that
+//                   it supports, so every role for which QueryInterface returns an interface must be
+//                   listed in GetComponentRoles. The RoleIterator still examines every entry in the list.
 class WSF_EXPORT WsfComponentList
 {
 public:
@@ -169,13 +175,12 @@ public:
    template<class T>
    bool FindByRole(T*& aPtr) const
    {
-      for (const auto& component : mComponentsByName)
+      WsfComponent* componentPtr = FindComponentByRoleP(cCOMPONENT_ROLE<T>());
+      if (componentPtr != nullptr)
       {
-         if (component.second->QueryInterfaceT(aPtr))
-         {
-            return true;
-         }
+         return componentPtr->QueryInterfaceT(aPtr);
       }
+      aPtr = nullptr;
       return false;
    }
 
@@ -335,6 +340,19 @@ protected:
    bool RemoveComponentP(WsfStringId aName, int aRole, bool aDelete, bool aDoNotify);
 
    ComponentList mComponentsByName;
+
+private:
+   //! The components in an index entry, in the order in which they appear in mComponentsByName.
+   using IndexEntry = std::vector<WsfComponent*>;
+
+   void IndexComponent(WsfStringId aName, WsfComponent* aComponentPtr);
+   void UnindexComponent(WsfStringId aName, WsfComponent* aComponentPtr);
+
+   //! The components that support each role, indexed by role.
+   std::unordered_map<int, IndexEntry> mComponentsByRole;
+
+   //! The components with each name, indexed by name.
+   std::unordered_map<WsfStringId, IndexEntry> mComponentsWithName;
 };
 
 //! A component list that stores only components of a specified type.
@@ -96,6 +96,14 @@ bool WsfCorrelationStrategyTypes::ProcessInput(UtInput& aInput)
    return processed;
 }
 
+// =================================================================================================
+bool WsfCorrelationStrategyTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("default_correlation_method");
+   aKeywords.push_back(GetBlockName());
+   return true;
+}
+
 // =================================================================================================
 //! (Factory Method) Create a new instance of a strategy with the given name.
 //! @param aName The name of the desired strategy.
@@ -34,6 +34,7 @@ public:
    WSF_EXPORT void               SetDefaultStrategyName(const std::string& aName);
 
    bool        ProcessInput(UtInput& aInput) override; // To configure the default strategy name.
+   bool        GetInputKeywords(std::vector<std::string>& aKeywords) const override;
    std::string mDefaultStrategyName;
 };
 
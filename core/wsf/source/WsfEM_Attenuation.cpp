@@ -26,6 +26,7 @@ WsfEM_Attenuation::WsfEM_Attenuation()
    : WsfObject()
    , mDebugEnabled(false)
    , mSortEndPoints(true)
+   , mCoherenceCache()
 {
 }
 
@@ -34,12 +35,16 @@ WsfEM_Attenuation::WsfEM_Attenuation(const WsfEM_Attenuation& aSrc)
    : WsfObject(aSrc)
    , mDebugEnabled(aSrc.mDebugEnabled)
    , mSortEndPoints(aSrc.mSortEndPoints)
+   , mCoherenceCache(aSrc.mCoherenceCache)
 {
 }
 
 // =================================================================================================
 // virtual
-WsfEM_Attenuation::~WsfEM_Attenuation() {}
+WsfEM_Attenuation::~WsfEM_Attenuation()
+{
+   mCoherenceCache.ReportStatistics(GetType());
+}
 
 // =================================================================================================
 //! Initialize the attenuation object.
@@ -47,6 +52,7 @@ WsfEM_Attenuation::~WsfEM_Attenuation() {}
 // virtual
 bool WsfEM_Attenuation::Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr)
 {
+   mCoherenceCache.Initialize(aXmtrRcvrPtr);
    return true;
 }
 
@@ -72,6 +78,9 @@ bool WsfEM_Attenuation::ProcessInput(UtInput& aInput)
    {
       mDebugEnabled = true;
    }
+   else if (mCoherenceCache.ProcessInput(aInput))
+   {
+   }
    else
    {
       myCommand = false;
@@ -111,7 +120,15 @@ double WsfEM_Attenuation::ComputeAttenuationFactor(WsfEM_Interaction&          a
       {
          frequency = aInteraction.GetTransmitter()->GetFrequency();
       }
-      atten = ComputeAttenuationFactorP(range, elevation, altitude, frequency);
+      atten = CachedAttenuationFactor(aInteraction,
+                                      aEnvironment,
+                                      aGeometry,
+                                      range,
+                                      elevation,
+                                      altitude,
+                                      frequency,
+                                      [&]()
+                                      { return ComputeAttenuationFactorP(range, elevation, altitude, frequency); });
    }
    return atten;
 }
@@ -259,6 +276,51 @@ void WsfEM_Attenuation::GetRangeElevationAltitude(WsfEM_Interaction&          aI
    }
 }
 
+// =================================================================================================
+//! Return the attenuation factor of a path from the coherence cache, computing it if it is not in the cache.
+//!
+//! @param aInteraction     The interaction object.
+//! @param aEnvironment     The environment object.
+//! @param aGeometry        An enum representing the participants.
+//! @param aRange           The slant range of the path (meters).
+//! @param aElevation       The elevation angle of the path (radians).
+//! @param aAltitude        The altitude of the path (meters).
+//! @param aFrequency       The frequency of the signal (hertz).
+//! @param aComputeFunction The function that computes the attenuation factor of the path.
+//! @returns The attenuation factor. It is simply computed if 'coherence_cache' was not specified.
+// protected
+double WsfEM_Attenuation::CachedAttenuationFactor(WsfEM_Interaction&             aInteraction,
+                                                  WsfEnvironment&                aEnvironment,
+                                                  WsfEM_Interaction::Geometry    aGeometry,
+                                                  double                         aRange,
+                                                  double                         aElevation,
+                                                  double                         aAltitude,
+                                                  double                         aFrequency,
+                                                  const std::function<double()>& aComputeFunction)
+{
+   if (!mCoherenceCache.IsEnabled())
+   {
+      return aComputeFunction();
+   }
+
+   WsfEM_CoherenceCache<1>::Key     key  = WsfEM_CoherenceCacheBase::MakeKey(aInteraction, aGeometry);
+   WsfEM_CoherenceCache<1>::Path    path = {aRange, aElevation, aAltitude};
+   WsfEM_CoherenceCache<1>::Values  values;
+   WsfEM_CoherenceCacheBase::Lookup lookup =
+      mCoherenceCache.Find(key, path, aFrequency, aEnvironment.GetChangeCount(), values);
+   if (lookup != WsfEM_CoherenceCacheBase::cHIT)
+   {
+      WsfEM_CoherenceCache<1>::Values cachedValues = values;
+      values[0]                                    = aComputeFunction();
+      mCoherenceCache.Store(key,
+                            path,
+                            aFrequency,
+                            values,
+                            (lookup == WsfEM_CoherenceCacheBase::cVERIFY) ? &cachedValues : nullptr);
+   }
+   return values[0];
+}
+
 // =================================================================================================
 // private
 void WsfEM_Attenuation::GetRangeElevationAltitude(WsfPlatform*                           aSrcPlatformPtr,
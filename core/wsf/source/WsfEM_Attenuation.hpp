@@ -14,7 +14,10 @@
 
 #include "wsf_export.h"
 
+#include <functional>
+
 class UtInput;
+#include "WsfEM_CoherenceCache.hpp"
 #include "WsfEM_Interaction.hpp"
 class WsfEM_Xmtr;
 class WsfEM_XmtrRcvr;
@@ -81,6 +84,15 @@ protected:
                                   double&                     aElevation,
                                   double&                     aAltitude);
 
+   double CachedAttenuationFactor(WsfEM_Interaction&             aInteraction,
+                                  WsfEnvironment&                aEnvironment,
+                                  WsfEM_Interaction::Geometry    aGeometry,
+                                  double                         aRange,
+                                  double                         aElevation,
+                                  double                         aAltitude,
+                                  double                         aFrequency,
+                                  const std::function<double()>& aComputeFunction);
+
    bool mDebugEnabled;
 
    //! True if the end points of the path should be sorted so the path goes from the lowest to highest point.
@@ -88,6 +100,9 @@ protected:
    //! Derived classes may change the default and may provide means for the user to change it.
    bool mSortEndPoints;
 
+   //! The optional cache of the attenuation factor of each path ('coherence_cache').
+   WsfEM_CoherenceCache<1> mCoherenceCache;
+
 private:
    //! Assignment operator declared but not defined to prevent use.
    WsfEM_Attenuation& operator=(const WsfEM_Attenuation& aRhs) = delete;
@@ -211,6 +211,14 @@ WsfEM_AttenuationTypes::LoadResult WsfEM_AttenuationTypes::LoadType(UtInput& aIn
    return result;
 }
 
+// =================================================================================================
+bool WsfEM_AttenuationTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("attenuation");
+   aKeywords.push_back("attenuation_model");
+   return true;
+}
+
 WsfEM_Attenuation* WsfEM_AttenuationTypes::CreateInstance(const std::string& aTypeName) const
 {
    WsfEM_Attenuation* instancePtr = nullptr;
@@ -34,6 +34,7 @@ public:
 
    WSF_EXPORT void    AddObjectFactory(const Factory& aFactory);
    LoadResult         LoadType(UtInput& aInput) override;
+   bool               GetInputKeywords(std::vector<std::string>& aKeywords) const override;
    bool               LoadReference(UtInput& aInput, WsfStringId& aTypeName);
    WsfEM_Attenuation* Clone(WsfStringId aTypeName) const override;
 
@@ -188,6 +188,14 @@ WsfEM_ClutterTypes::LoadResult WsfEM_ClutterTypes::LoadType(UtInput& aInput)
    return result;
 }
 
+// =================================================================================================
+bool WsfEM_ClutterTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("clutter");
+   aKeywords.push_back("clutter_model");
+   return true;
+}
+
 // =================================================================================================
 WsfEM_Clutter* WsfEM_ClutterTypes::CreateInstance(const std::string& aTypeName)
 {
@@ -31,6 +31,7 @@ public:
    WsfEM_ClutterTypes(WsfScenario& aScenario);
 
    LoadResult LoadType(UtInput& aInput) override;
+   bool       GetInputKeywords(std::vector<std::string>& aKeywords) const override;
 
    WSF_EXPORT void AddObjectFactory(FactoryPtr aFactoryPtr);
 
@@ -0,0 +1,225 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_CoherenceCache.hpp"
+
+#include "UtInput.hpp"
+#include "UtInputBlock.hpp"
+#include "UtLog.hpp"
+#include "UtMath.hpp"
+#include "WsfEM_Rcvr.hpp"
+#include "WsfEM_Xmtr.hpp"
+#include "WsfEM_XmtrRcvr.hpp"
+#include "WsfPlatform.hpp"
+#include "WsfPlatformObserver.hpp"
+#include "WsfSimulation.hpp"
+
+// =================================================================================================
+WsfEM_CoherenceCacheBase::WsfEM_CoherenceCacheBase()
+   : mEnabled(false)
+   , mReportStatistics(false)
+   , mRangeTolerance(50.0)
+   , mElevationTolerance(0.05 * UtMath::cRAD_PER_DEG)
+   , mAltitudeTolerance(10.0)
+   , mVerificationInterval(0)
+   , mHitCount(0)
+   , mMissCount(0)
+   , mVerificationCount(0)
+   , mMaxRangeDeviation(0.0)
+   , mMaxElevationDeviation(0.0)
+   , mMaxAltitudeDeviation(0.0)
+   , mMaxVerifiedError(0.0)
+   , mCallbacks()
+{
+}
+
+// =================================================================================================
+//! Copy constructor. The input is copied and the statistics are reset.
+WsfEM_CoherenceCacheBase::WsfEM_CoherenceCacheBase(const WsfEM_CoherenceCacheBase& aSrc)
+   : mMutex()
+   , mEnabled(aSrc.mEnabled)
+   , mReportStatistics(aSrc.mReportStatistics)
+   , mRangeTolerance(aSrc.mRangeTolerance)
+   , mElevationTolerance(aSrc.mElevationTolerance)
+   , mAltitudeTolerance(aSrc.mAltitudeTolerance)
+   , mVerificationInterval(aSrc.mVerificationInterval)
+   , mHitCount(0)
+   , mMissCount(0)
+   , mVerificationCount(0)
+   , mMaxRangeDeviation(0.0)
+   , mMaxElevationDeviation(0.0)
+   , mMaxAltitudeDeviation(0.0)
+   , mMaxVerifiedError(0.0)
+   , mCallbacks()
+{
+}
+
+// =================================================================================================
+//! Process the 'coherence_cache' block, which enables the cache.
+bool WsfEM_CoherenceCacheBase::ProcessInput(UtInput& aInput)
+{
+   bool myCommand = false;
+   if (aInput.GetCommand() == "coherence_cache")
+   {
+      myCommand = true;
+      mEnabled  = true;
+      UtInputBlock inputBlock(aInput);
+      std::string  command;
+      while (inputBlock.ReadCommand(command))
+      {
+         if (command == "range_tolerance")
+         {
+            aInput.ReadValueOfType(mRangeTolerance, UtInput::cLENGTH);
+            aInput.ValueGreaterOrEqual(mRangeTolerance, 0.0);
+         }
+         else if (command == "elevation_tolerance")
+         {
+            aInput.ReadValueOfType(mElevationTolerance, UtInput::cANGLE);
+            aInput.ValueGreaterOrEqual(mElevationTolerance, 0.0);
+         }
+         else if (command == "altitude_tolerance")
+         {
+            aInput.ReadValueOfType(mAltitudeTolerance, UtInput::cLENGTH);
+            aInput.ValueGreaterOrEqual(mAltitudeTolerance, 0.0);
+         }
+         else if (command == "verification_interval")
+         {
+            int interval;
+            aInput.ReadValue(interval);
+            aInput.ValueGreaterOrEqual(interval, 0);
+            mVerificationInterval = static_cast<unsigned int>(interval);
+         }
+         else if (command == "report_statistics")
+         {
+            aInput.ReadValue(mReportStatistics);
+         }
+         else
+         {
+            throw UtInput::UnknownCommand(aInput);
+         }
+      }
+   }
+   return myCommand;
+}
+
+// =================================================================================================
+//! Initialize the cache for the transmitter or receiver that owns the model.
+//! If the cache is enabled, the entries of the paths to a platform are removed when the platform is deleted.
+void WsfEM_CoherenceCacheBase::Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr)
+{
+   mCallbacks.Clear();
+   if (mEnabled && (aXmtrRcvrPtr != nullptr) && (aXmtrRcvrPtr->GetSimulation() != nullptr))
+   {
+      mCallbacks.Add(WsfObserver::PlatformDeleted(aXmtrRcvrPtr->GetSimulation())
+                        .Connect(&WsfEM_CoherenceCacheBase::PlatformDeleted, this));
+   }
+}
+
+// =================================================================================================
+//! Return the key of a path of an interaction.
+//! The key contains the indices of the platforms at both ends of the path, so the entries of a transmitter or receiver
+//! that interacts with many platforms are kept apart.
+// static
+WsfEM_CoherenceCacheBase::Key WsfEM_CoherenceCacheBase::MakeKey(WsfEM_Interaction&          aInteraction,
+                                                                WsfEM_Interaction::Geometry aGeometry)
+{
+   size_t xmtrIndex = 0;
+   size_t rcvrIndex = 0;
+   size_t tgtIndex  = 0;
+   if (aInteraction.GetTransmitter() != nullptr)
+   {
+      xmtrIndex = aInteraction.GetTransmitter()->GetPlatform()->GetIndex();
+   }
+   if (aInteraction.GetReceiver() != nullptr)
+   {
+      rcvrIndex = aInteraction.GetReceiver()->GetPlatform()->GetIndex();
+   }
+   if (aInteraction.GetTarget() != nullptr)
+   {
+      tgtIndex = aInteraction.GetTarget()->GetIndex();
+   }
+
+   if (aGeometry == WsfEM_Interaction::cXMTR_TO_TARGET)
+   {
+      return Key(aGeometry, xmtrIndex, tgtIndex);
+   }
+   else if (aGeometry == WsfEM_Interaction::cTARGET_TO_RCVR)
+   {
+      return Key(aGeometry, rcvrIndex, tgtIndex);
+   }
+   return Key(aGeometry, xmtrIndex, rcvrIndex);
+}
+
+// =================================================================================================
+//! Write the statistics of the cache if 'report_statistics' was requested and the cache was used.
+//! This must not be called while the cache is in use.
+void WsfEM_CoherenceCacheBase::ReportStatistics(const std::string& aOwnerName) const
+{
+   unsigned long lookupCount = mHitCount + mMissCount + mVerificationCount;
+   if ((!mReportStatistics) || (lookupCount == 0))
+   {
+      return;
+   }
+
+   auto out = ut::log::info() << "Coherence cache statistics.";
+   out.AddNote() << "Owner: " << aOwnerName;
+   out.AddNote() << "Hits: " << mHitCount;
+   out.AddNote() << "Misses: " << mMissCount;
+   out.AddNote() << "Hit Ratio: " << static_cast<double>(mHitCount) / static_cast<double>(lookupCount);
+   out.AddNote() << "Maximum Range Deviation: " << mMaxRangeDeviation << " m";
+   out.AddNote() << "Maximum Elevation Deviation: " << mMaxElevationDeviation * UtMath::cDEG_PER_RAD << " deg";
+   out.AddNote() << "Maximum Altitude Deviation: " << mMaxAltitudeDeviation << " m";
+   if (mVerificationInterval > 0)
+   {
+      out.AddNote() << "Verified Hits: " << mVerificationCount;
+      out.AddNote() << "Maximum Verified Error: " << mMaxVerifiedError;
+   }
+}
+
+// =================================================================================================
+// protected
+bool WsfEM_CoherenceCacheBase::WithinTolerance(const Path& aCachedPath, const Path& aPath) const
+{
+   return (std::abs(aPath.mRange - aCachedPath.mRange) <= mRangeTolerance) &&
+          (std::abs(aPath.mElevation - aCachedPath.mElevation) <= mElevationTolerance) &&
+          (std::abs(aPath.mAltitude - aCachedPath.mAltitude) <= mAltitudeTolerance);
+}
+
+// =================================================================================================
+//! Should a hit be recomputed to measure the error of the cache?
+//! The caller must hold the mutex.
+//! @returns true for every Nth hit, where N is the verification interval.
+// protected
+bool WsfEM_CoherenceCacheBase::VerificationDue()
+{
+   if ((mVerificationInterval > 0) && (((mHitCount + mVerificationCount + 1) % mVerificationInterval) == 0))
+   {
+      ++mVerificationCount;
+      return true;
+   }
+   return false;
+}
+
+// =================================================================================================
+// protected
+void WsfEM_CoherenceCacheBase::RecordHit(const Path& aCachedPath, const Path& aPath)
+{
+   ++mHitCount;
+   mMaxRangeDeviation     = std::max(mMaxRangeDeviation, std::abs(aPath.mRange - aCachedPath.mRange));
+   mMaxElevationDeviation = std::max(mMaxElevationDeviation, std::abs(aPath.mElevation - aCachedPath.mElevation));
+   mMaxAltitudeDeviation  = std::max(mMaxAltitudeDeviation, std::abs(aPath.mAltitude - aCachedPath.mAltitude));
+}
+
+// =================================================================================================
+// private
+void WsfEM_CoherenceCacheBase::PlatformDeleted(double /*aSimTime*/, WsfPlatform* aPlatformPtr)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   RemoveEntries(aPlatformPtr->GetIndex());
+}
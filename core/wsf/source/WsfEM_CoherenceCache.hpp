@@ -0,0 +1,214 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_COHERENCECACHE_HPP
+#define WSFEM_COHERENCECACHE_HPP
+
+#include "wsf_export.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "UtCallbackHolder.hpp"
+class UtInput;
+#include "WsfEM_Interaction.hpp"
+class WsfEM_XmtrRcvr;
+class WsfPlatform;
+
+//! The input, tolerances and statistics of a WsfEM_CoherenceCache.
+class WSF_EXPORT WsfEM_CoherenceCacheBase
+{
+public:
+   //! The result of a lookup.
+   enum Lookup
+   {
+      cMISS,  //!< The terms were not found.
+      cHIT,   //!< The terms were found.
+      cVERIFY //!< The terms were found but must be recomputed to measure the error of the cache.
+   };
+
+   //! The path for which the terms were computed.
+   struct Path
+   {
+      double mRange;     //!< The slant range (meters)
+      double mElevation; //!< The elevation angle (radians)
+      double mAltitude;  //!< The altitude (meters)
+   };
+
+   //! The geometry enumeration of the path and the indices of the platforms at each end.
+   using Key = std::tuple<int, size_t, size_t>;
+
+   WsfEM_CoherenceCacheBase();
+   WsfEM_CoherenceCacheBase(const WsfEM_CoherenceCacheBase& aSrc);
+   WsfEM_CoherenceCacheBase& operator=(const WsfEM_CoherenceCacheBase& aRhs) = delete;
+   virtual ~WsfEM_CoherenceCacheBase() = default;
+
+   bool ProcessInput(UtInput& aInput);
+   void Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr);
+
+   //! Is the cache enabled? It is disabled unless a 'coherence_cache' block has been processed.
+   bool IsEnabled() const { return mEnabled; }
+
+   static Key MakeKey(WsfEM_Interaction& aInteraction, WsfEM_Interaction::Geometry aGeometry);
+
+   void ReportStatistics(const std::string& aOwnerName) const;
+
+protected:
+   bool WithinTolerance(const Path& aCachedPath, const Path& aPath) const;
+   bool VerificationDue();
+   void RecordHit(const Path& aCachedPath, const Path& aPath);
+
+   //! Remove the entries of the paths that end at a platform. The caller must hold the mutex.
+   virtual void RemoveEntries(size_t aPlatformIndex) = 0;
+
+   //! Guards the entries and statistics. Each transmitter and receiver has its own copy of the model that owns the
+   //! cache, but the model of a transmitter is also evaluated by every passive sensor that receives it, and those
+   //! sensors may be updated on different threads.
+   std::mutex mMutex;
+
+   bool         mEnabled;
+   bool         mReportStatistics;
+   double       mRangeTolerance;
+   double       mElevationTolerance;
+   double       mAltitudeTolerance;
+   unsigned int mVerificationInterval;
+
+   //! @name Statistics
+   //@{
+   unsigned long mHitCount;
+   unsigned long mMissCount;
+   unsigned long mVerificationCount;
+   double        mMaxRangeDeviation;
+   double        mMaxElevationDeviation;
+   double        mMaxAltitudeDeviation;
+   double        mMaxVerifiedError;
+   //@}
+
+private:
+   void PlatformDeleted(double aSimTime, WsfPlatform* aPlatformPtr);
+
+   UtCallbackHolder mCallbacks;
+};
+
+//! A cache of the slowly varying terms of EM interactions, kept for each path of a transmitter or receiver.
+//!
+//! Each entry holds N terms and the path, frequency and environment for which they were computed. The terms are
+//! reused while the path stays within the tolerances of the entry and the frequency and environment are unchanged,
+//! which is the typical case for a surveillance sensor that revisits a slowly moving target every few seconds.
+//!
+//! If a verification interval is given, every Nth hit is recomputed instead of reused and the difference is recorded,
+//! which gives a measured bound on the error introduced by the tolerances.
+//!
+//! Find and Store may be called from multiple threads.
+template<size_t N>
+class WsfEM_CoherenceCache : public WsfEM_CoherenceCacheBase
+{
+public:
+   using Values = std::array<double, N>;
+
+   //! Find the terms of a path.
+   //! @param aKey                    The path, from MakeKey.
+   //! @param aPath                   The current path geometry.
+   //! @param aFrequency              The frequency of the signal (Hz).
+   //! @param aEnvironmentChangeCount The change count of the environment (WsfEnvironment::GetChangeCount).
+   //! @param aValues                 [output] The cached terms (if cHIT or cVERIFY).
+   //! @returns cHIT if the terms were found. Otherwise the terms must be computed and given to Store, along with
+   //! the cached terms if cVERIFY.
+   Lookup Find(const Key&   aKey,
+               const Path&  aPath,
+               double       aFrequency,
+               unsigned int aEnvironmentChangeCount,
+               Values&      aValues)
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (aEnvironmentChangeCount != mEnvironmentChangeCount)
+      {
+         mEntries.clear();
+         mEnvironmentChangeCount = aEnvironmentChangeCount;
+      }
+      auto iter = mEntries.find(aKey);
+      if ((iter != mEntries.end()) && (iter->second.mFrequency == aFrequency) &&
+          WithinTolerance(iter->second.mPath, aPath))
+      {
+         aValues = iter->second.mValues;
+         if (VerificationDue())
+         {
+            return cVERIFY;
+         }
+         RecordHit(iter->second.mPath, aPath);
+         return cHIT;
+      }
+      ++mMissCount;
+      return cMISS;
+   }
+
+   //! Store the terms computed for a path after Find did not return cHIT.
+   //! @param aCachedValuesPtr The terms returned by Find if it returned cVERIFY, or null.
+   void Store(const Key&    aKey,
+              const Path&   aPath,
+              double        aFrequency,
+              const Values& aValues,
+              const Values* aCachedValuesPtr = nullptr)
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (aCachedValuesPtr != nullptr)
+      {
+         for (size_t i = 0; i < N; ++i)
+         {
+            mMaxVerifiedError = std::max(mMaxVerifiedError, std::abs(aValues[i] - (*aCachedValuesPtr)[i]));
+         }
+      }
+      Entry& entry = mEntries[aKey];
+      entry.mPath      = aPath;
+      entry.mFrequency = aFrequency;
+      entry.mValues    = aValues;
+   }
+
+   //! Remove all entries (the statistics are retained).
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mEntries.clear();
+   }
+
+protected:
+   void RemoveEntries(size_t aPlatformIndex) override
+   {
+      for (auto iter = mEntries.begin(); iter != mEntries.end();)
+      {
+         if ((std::get<1>(iter->first) == aPlatformIndex) || (std::get<2>(iter->first) == aPlatformIndex))
+         {
+            iter = mEntries.erase(iter);
+         }
+         else
+         {
+            ++iter;
+         }
+      }
+   }
+
+private:
+   struct Entry
+   {
+      Path   mPath;
+      double mFrequency;
+      Values mValues;
+   };
+
+   std::map<Key, Entry> mEntries;
+   unsigned int         mEnvironmentChangeCount{0};
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include "WsfEM_FastMultipath.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <complex>
 #include <iostream>
@@ -30,11 +31,16 @@
 #include "WsfEM_Interaction.hpp"
 #include "WsfEM_Rcvr.hpp"
 #include "WsfEM_Xmtr.hpp"
+#include "WsfEnvironment.hpp"
 
 // =================================================================================================
 WsfEM_FastMultipath::WsfEM_FastMultipath()
    : mSoilMoistureFraction(0.15)
    , mSurfaceRoughness(3.0)
+   , mDielectricFrequency(-1.0)
+   , mDielectricConstant()
+   , mDielectricMutex()
+   , mCoherenceCache()
 {
 }
 
@@ -42,12 +48,19 @@ WsfEM_FastMultipath::WsfEM_FastMultipath()
 WsfEM_FastMultipath::WsfEM_FastMultipath(const WsfEM_FastMultipath& aSrc)
    : mSoilMoistureFraction(aSrc.mSoilMoistureFraction)
    , mSurfaceRoughness(aSrc.mSurfaceRoughness)
+   , mDielectricFrequency(aSrc.mDielectricFrequency)
+   , mDielectricConstant(aSrc.mDielectricConstant)
+   , mDielectricMutex()
+   , mCoherenceCache(aSrc.mCoherenceCache)
 {
 }
 
 // =================================================================================================
 // virtual
-WsfEM_FastMultipath::~WsfEM_FastMultipath() {}
+WsfEM_FastMultipath::~WsfEM_FastMultipath()
+{
+   mCoherenceCache.ReportStatistics(GetType());
+}
 
 // =================================================================================================
 //! Factory method called by WsfEM_PropagationTypes.
@@ -69,6 +82,14 @@ WsfEM_Propagation* WsfEM_FastMultipath::Clone() const
    return new WsfEM_FastMultipath(*this);
 }
 
+// =================================================================================================
+// virtual
+bool WsfEM_FastMultipath::Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr)
+{
+   mCoherenceCache.Initialize(aXmtrRcvrPtr);
+   return WsfEM_Propagation::Initialize(aXmtrRcvrPtr);
+}
+
 // =================================================================================================
 // virtual
 double WsfEM_FastMultipath::ComputePropagationFactor(WsfEM_Interaction& aInteraction, WsfEnvironment& aEnvironment)
@@ -87,10 +108,6 @@ double WsfEM_FastMultipath::ComputePropagationFactor(WsfEM_Interaction& aInterac
       frequency = rcvrPtr->GetFrequency();
    }
 
-   // Get the relative dielectric constant
-   std::complex<double> epsilon;
-   GetSoilDielectricConstant(frequency, mSoilMoistureFraction, epsilon);
-
    double localEarthRadius = UtVec3d::Magnitude(aInteraction.mRcvrLoc.mLocWCS) - aInteraction.mRcvrLoc.mAlt;
    double earthRadius      = xmtrPtr->GetEarthRadiusMultiplier() * localEarthRadius;
    double wavelength       = UtMath::cLIGHT_SPEED / frequency;
@@ -113,28 +130,40 @@ double WsfEM_FastMultipath::ComputePropagationFactor(WsfEM_Interaction& aInterac
       return 1.0;
    }
 
-   // Compute the magnitude and phase shift of the reflection
-
-   double rho_0; // The magnitude of the reflection coefficient
-   double phi;   // The phase angle of the reflection coefficient
-   ComputeReflectionCoefficient(grazingAngle, epsilon, xmtrPtr->GetPolarization(), rho_0, phi);
-
-   // -----------------------------------------------------------------------
-   // Determine the specularity coefficient which reduces the purely
-   // specular reflection due to the surface roughness.  This
-   // calculation is based on equation 6.74 on page 266 of reference 1.
-   //
-   // Note that diffuse reflection as an enhancement factor is not taken
-   // into account as described on page 268 and 269 of reference 1.
-   // -----------------------------------------------------------------------
-
-   double temp1 = (UtMath::cTWO_PI * mSurfaceRoughness * sin(grazingAngle)) / wavelength;
-   double temp2 = -2.0 * temp1 * temp1;
-   double rho_s = 0.0;
-   if (temp2 > -700.0)
+   // Get the magnitude and phase shift of the reflection. These vary slowly with the grazing angle, so they are taken
+   // from the cache if possible. The phase of the reflected signal relative to the direct signal is not cached; it
+   // goes through a full cycle when the path length difference changes by one wavelength.
+   WsfEM_CoherenceCache<2>::Values  reflection{};
+   WsfEM_CoherenceCache<2>::Key     key;
+   WsfEM_CoherenceCacheBase::Lookup lookup = WsfEM_CoherenceCacheBase::cMISS;
+   WsfEM_CoherenceCache<2>::Path    path   = {aInteraction.mXmtrToTgt.mRange, aInteraction.mXmtrToTgt.mEl, 0.0};
+   if (mCoherenceCache.IsEnabled())
    {
-      rho_s = exp(temp2);
+      WsfEM_Interaction::Geometry geometry = WsfEM_Interaction::cXMTR_TO_RCVR;
+      path.mAltitude                       = aInteraction.mRcvrLoc.mAlt;
+      if (aInteraction.GetTarget() != nullptr)
+      {
+         geometry       = WsfEM_Interaction::cXMTR_TO_TARGET;
+         path.mAltitude = aInteraction.mTgtLoc.mAlt;
+      }
+      key    = WsfEM_CoherenceCacheBase::MakeKey(aInteraction, geometry);
+      lookup = mCoherenceCache.Find(key, path, frequency, aEnvironment.GetChangeCount(), reflection);
+   }
+   if (lookup != WsfEM_CoherenceCacheBase::cHIT)
+   {
+      WsfEM_CoherenceCache<2>::Values cachedReflection = reflection;
+      ComputeReflection(grazingAngle, frequency, xmtrPtr->GetPolarization(), reflection);
+      if (mCoherenceCache.IsEnabled())
+      {
+         mCoherenceCache.Store(key,
+                               path,
+                               frequency,
+                               reflection,
+                               (lookup == WsfEM_CoherenceCacheBase::cVERIFY) ? &cachedReflection : nullptr);
+      }
    }
+   double rho = reflection[0];
+   double phi = reflection[1];
 
    // -----------------------------------------------------------------------
    // Determine the two intermediate values that will be used to
@@ -158,7 +187,6 @@ double WsfEM_FastMultipath::ComputePropagationFactor(WsfEM_Interaction& aInterac
    // -----------------------------------------------------------------------
 
    double twoCos = 2.0 * cos((UtMath::cTWO_PI * pathLengthDifference / wavelength) + phi);
-   double rho    = rho_s * rho_0;
 
    // TODO-FOR NOW we assume the geometry for transmit and receive is the same!
    double xmtElevationAngle = antElevationAngle; // TODO
@@ -205,6 +233,62 @@ double WsfEM_FastMultipath::ComputePropagationFactor(WsfEM_Interaction& aInterac
    return xmtFactor * rcvFactor;
 }
 
+// =================================================================================================
+//! Compute the magnitude and phase shift of the reflection.
+//! @param aGrazingAngle The grazing angle at the reflection point (radians).
+//! @param aFrequency    The frequency of the signal (Hz).
+//! @param aPolarization The polarization of the signal.
+//! @param aReflection   [output] The magnitude of the reflection coefficient, including the reduction due to the
+//!                      surface roughness (rho), and the phase shift of the reflection coefficient (radians).
+// private
+void WsfEM_FastMultipath::ComputeReflection(double                    aGrazingAngle,
+                                            double                    aFrequency,
+                                            WsfEM_Types::Polarization aPolarization,
+                                            std::array<double, 2>&    aReflection)
+{
+   // Get the relative dielectric constant. It depends only on the frequency and the soil moisture, so the last one
+   // is kept if the cache is enabled (the model may be evaluated on different threads).
+   std::complex<double> epsilon;
+   if (mCoherenceCache.IsEnabled())
+   {
+      std::lock_guard<std::mutex> lock(mDielectricMutex);
+      if (aFrequency != mDielectricFrequency)
+      {
+         GetSoilDielectricConstant(aFrequency, mSoilMoistureFraction, mDielectricConstant);
+         mDielectricFrequency = aFrequency;
+      }
+      epsilon = mDielectricConstant;
+   }
+   else
+   {
+      GetSoilDielectricConstant(aFrequency, mSoilMoistureFraction, epsilon);
+   }
+
+   double rho_0; // The magnitude of the reflection coefficient
+   double phi;   // The phase angle of the reflection coefficient
+   ComputeReflectionCoefficient(aGrazingAngle, epsilon, aPolarization, rho_0, phi);
+
+   // -----------------------------------------------------------------------
+   // Determine the specularity coefficient which reduces the purely
+   // specular reflection due to the surface roughness.  This
+   // calculation is based on equation 6.74 on page 266 of reference 1.
+   //
+   // Note that diffuse reflection as an enhancement factor is not taken
+   // into account as described on page 268 and 269 of reference 1.
+   // -----------------------------------------------------------------------
+
+   double wavelength = UtMath::cLIGHT_SPEED / aFrequency;
+   double temp1      = (UtMath::cTWO_PI * mSurfaceRoughness * sin(aGrazingAngle)) / wavelength;
+   double temp2      = -2.0 * temp1 * temp1;
+   double rho_s      = 0.0;
+   if (temp2 > -700.0)
+   {
+      rho_s = exp(temp2);
+   }
+
+   aReflection = {rho_s * rho_0, phi};
+}
+
 // =================================================================================================
 //! Compute the antenna gain in the direction of the reflection point.
 //! @param aXmtrRcvrPtr     Pointer to the transmitter/receiver.
@@ -276,6 +360,9 @@ bool WsfEM_FastMultipath::ProcessInput(UtInput& aInput)
       aInput.ValueGreater(surfaceRoughness, 0.0);
       SetSurfaceRoughness(surfaceRoughness);
    }
+   else if (mCoherenceCache.ProcessInput(aInput))
+   {
+   }
    else
    {
       myCommand = WsfEM_Propagation::ProcessInput(aInput);
@@ -286,13 +373,19 @@ bool WsfEM_FastMultipath::ProcessInput(UtInput& aInput)
 // =================================================================================================
 void WsfEM_FastMultipath::SetSoilMoistureFraction(double aSoilMoistureFraction)
 {
-   mSoilMoistureFraction = aSoilMoistureFraction;
+   {
+      std::lock_guard<std::mutex> lock(mDielectricMutex);
+      mSoilMoistureFraction = aSoilMoistureFraction;
+      mDielectricFrequency  = -1.0;
+   }
+   mCoherenceCache.Clear();
 }
 
 // =================================================================================================
 void WsfEM_FastMultipath::SetSurfaceRoughness(double aSurfaceRoughness)
 {
    mSurfaceRoughness = aSurfaceRoughness;
+   mCoherenceCache.Clear();
 }
 
 // =================================================================================================
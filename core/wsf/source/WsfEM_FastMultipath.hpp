@@ -14,9 +14,12 @@
 
 #include "wsf_export.h"
 
+#include <array>
 #include <complex>
+#include <mutex>
 
 #include "WsfEM_Antenna.hpp"
+#include "WsfEM_CoherenceCache.hpp"
 #include "WsfEM_Interaction.hpp"
 #include "WsfEM_Propagation.hpp"
 #include "WsfEM_Types.hpp"
@@ -35,6 +38,9 @@ public:
 
    WsfEM_Propagation* Clone() const override;
 
+   using WsfEM_Propagation::Initialize;
+   bool Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr) override;
+
    double ComputePropagationFactor(WsfEM_Interaction& aInteraction, WsfEnvironment& aEnvironment) override;
 
    virtual double ComputeReflectionGain(WsfEM_XmtrRcvr*                        aXmtrRcvrPtr,
@@ -70,8 +76,24 @@ public:
                                          std::complex<double>& aDielectricConstant);
 
 private:
+   void ComputeReflection(double                    aGrazingAngle,
+                          double                    aFrequency,
+                          WsfEM_Types::Polarization aPolarization,
+                          std::array<double, 2>&    aReflection);
+
    double mSoilMoistureFraction;
    double mSurfaceRoughness;
+
+   //! The dielectric constant of the soil at mDielectricFrequency (a negative frequency if not yet computed).
+   //! This is kept only if the cache is enabled, and is guarded by mDielectricMutex.
+   double               mDielectricFrequency;
+   std::complex<double> mDielectricConstant;
+   std::mutex           mDielectricMutex;
+
+   //! The optional cache of the reflection coefficient of each path ('coherence_cache'): its magnitude (including the
+   //! surface roughness) and its phase shift. The phase of the reflected signal relative to the direct signal and the
+   //! antenna gains are always computed.
+   WsfEM_CoherenceCache<2> mCoherenceCache;
 };
 
 #endif
@@ -24,6 +24,11 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 // Indicate the atmosphere model from UtAtmosphere is to be used rather than the standard atmosphere
 // model from ITU-R P.835-4. The pressure and temperature were nearly identical, but the water
@@ -46,6 +51,21 @@
 
 namespace
 {
+//! The number of elevation angles in a path attenuation table. The angles are distributed as the square of the
+//! index to give more resolution near the horizon, where the attenuation changes most rapidly with elevation.
+const size_t cPATH_ELEVATION_COUNT = 32;
+
+//! Return the elevation angle for the specified index in the path attenuation table.
+double PathElevation(size_t aIndex)
+{
+   double u = static_cast<double>(aIndex) / (cPATH_ELEVATION_COUNT - 1);
+   return u * u * UtMath::cPI_OVER_2;
+}
+
+//! The maximum number of tables retained by the cache of a definition. The least recently used table is discarded
+//! when the limit is reached.
+const size_t cMAX_CACHED_TABLES = 64;
+
 struct Factory
 {
    WsfScenario*       mScenarioPtr;
@@ -68,12 +88,116 @@ std::function<WsfEM_Attenuation*(const std::string&)> WsfEM_ITU_Attenuation::Get
    return f;
 }
 
+// =================================================================================================
+//! Specific attenuation vs. altitude for one frequency and set of environmental conditions, and the optional
+//! path attenuation table derived from it. A table is immutable once it has been generated.
+class WsfEM_ITU_Attenuation::Table
+{
+public:
+   void   BuildPathTable();
+   double PathAttenuation(double aAltitude, double aElevation, double aRange) const;
+
+   //! Specific attenuation at 1 km altitude intervals, starting at zero.
+   std::vector<Point> mGammaTable;
+
+   //! @name Path attenuation table.
+   //! There is a row for each (altitude, elevation) pair in the table, with the altitude being the start
+   //! altitude from mGammaTable. Each row contains the range and accumulated attenuation (dB) at each layer
+   //! boundary crossed by the path. The entries for row 'i' are [mPathRowBegin[i], mPathRowBegin[i+1]).
+   //@{
+   std::vector<size_t> mPathRowBegin;
+   std::vector<double> mPathRange;
+   std::vector<double> mPathAtten_dB;
+   //@}
+
+private:
+   double RowAttenuation(size_t aRow, double aRange) const;
+};
+
+// =================================================================================================
+//! The tables that have been generated for a definition, shared by the definition and its clones.
+//! The number of tables is bounded (cMAX_CACHED_TABLES); a discarded table remains valid for the instances that are
+//! using it, as they hold a reference to it.
+class WsfEM_ITU_Attenuation::TableCache
+{
+public:
+   std::shared_ptr<const Table> Find(const TableKey& aKey);
+   void                         Add(const TableKey& aKey, std::shared_ptr<const Table> aTablePtr);
+
+   std::mutex mMutex;
+
+private:
+   struct Entry
+   {
+      std::shared_ptr<const Table>  mTablePtr;
+      std::list<TableKey>::iterator mUseIter; //!< The position of the key in mUseOrder.
+   };
+
+   std::map<TableKey, Entry> mTables;
+   std::list<TableKey>       mUseOrder; //!< The keys, ordered from the most to the least recently used.
+};
+
+// =================================================================================================
+//! Return the table for the specified key, or nullptr if it is not in the cache.
+//! The caller must hold the lock.
+std::shared_ptr<const WsfEM_ITU_Attenuation::Table> WsfEM_ITU_Attenuation::TableCache::Find(const TableKey& aKey)
+{
+   auto tableIter = mTables.find(aKey);
+   if (tableIter == mTables.end())
+   {
+      return nullptr;
+   }
+   mUseOrder.splice(mUseOrder.begin(), mUseOrder, tableIter->second.mUseIter);
+   return tableIter->second.mTablePtr;
+}
+
+// =================================================================================================
+//! Add a table to the cache, discarding the least recently used table if the cache is full.
+//! The caller must hold the lock.
+void WsfEM_ITU_Attenuation::TableCache::Add(const TableKey& aKey, std::shared_ptr<const Table> aTablePtr)
+{
+   if (mTables.size() >= cMAX_CACHED_TABLES)
+   {
+      mTables.erase(mUseOrder.back());
+      mUseOrder.pop_back();
+   }
+   mUseOrder.push_front(aKey);
+   mTables[aKey] = Entry{std::move(aTablePtr), mUseOrder.begin()};
+}
+
+// =================================================================================================
+bool WsfEM_ITU_Attenuation::TableKey::operator<(const TableKey& aRhs) const
+{
+   return std::tie(mFrequency,
+                   mPolarization,
+                   mRainRate,
+                   mRainUpperAlt,
+                   mLowerCloudAlt,
+                   mUpperCloudAlt,
+                   mCloudWaterDensity) <
+          std::tie(aRhs.mFrequency,
+                   aRhs.mPolarization,
+                   aRhs.mRainRate,
+                   aRhs.mRainUpperAlt,
+                   aRhs.mLowerCloudAlt,
+                   aRhs.mUpperCloudAlt,
+                   aRhs.mCloudWaterDensity);
+}
+
+// =================================================================================================
+bool WsfEM_ITU_Attenuation::TableKey::operator==(const TableKey& aRhs) const
+{
+   return (!(*this < aRhs)) && (!(aRhs < *this));
+}
+
 // =================================================================================================
 WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const UtAtmosphere& aAtm)
    : WsfEM_Attenuation()
    , mAtmosphere(aAtm)
-   , mFrequency(-1.0)
-   , mGammaTable()
+   , mUsePathTable(false)
+   , mTableCachePtr(std::make_shared<TableCache>())
+   , mTablePtr()
+   , mTableKey()
 {
 }
 
@@ -81,8 +205,10 @@ WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const UtAtmosphere& aAtm)
 WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const WsfEM_ITU_Attenuation& aSrc)
    : WsfEM_Attenuation(aSrc)
    , mAtmosphere(aSrc.mAtmosphere)
-   , mFrequency(-1.0)
-   , mGammaTable()
+   , mUsePathTable(aSrc.mUsePathTable)
+   , mTableCachePtr(aSrc.mTableCachePtr)
+   , mTablePtr()
+   , mTableKey()
 {
 }
 
@@ -188,8 +314,18 @@ bool WsfEM_ITU_Attenuation::ProcessInput(UtInput& aInput)
       out.AddNote() << "Attenuation: " << UtMath::SafeLinearToDB(atten) << " dB (" << atten << " abs)";
       out.AddNote() << "Specific Attenuation: " << -UtMath::SafeLinearToDB(atten) / (range * 0.001) << " dB/km";
    }
+   else if (command == "path_attenuation_table")
+   {
+      aInput.ReadValue(mUsePathTable);
+      // Tables generated with the previous setting must not be shared with this definition.
+      mTableCachePtr = std::make_shared<TableCache>();
+      mTablePtr.reset();
+   }
    else if (mAtmosphere.ProcessInput(aInput))
    {
+      // Tables generated with the previous atmosphere must not be shared with this definition.
+      mTableCachePtr = std::make_shared<TableCache>();
+      mTablePtr.reset();
    }
    else
    {
@@ -208,13 +344,23 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(WsfEM_Interaction&
    double range, elevation, altitude;
    GetRangeElevationAltitude(aInteraction, aGeometry, range, elevation, altitude);
    WsfEM_Xmtr* xmtrPtr = aInteraction.GetTransmitter();
-   return ComputeAttenuationFactor(range,
-                                   elevation,
-                                   altitude,
-                                   xmtrPtr->GetFrequency(),
-                                   xmtrPtr->GetPolarization(),
-                                   xmtrPtr->GetEarthRadiusMultiplier(),
-                                   aEnvironment);
+   return CachedAttenuationFactor(aInteraction,
+                                  aEnvironment,
+                                  aGeometry,
+                                  range,
+                                  elevation,
+                                  altitude,
+                                  xmtrPtr->GetFrequency(),
+                                  [&]()
+                                  {
+                                     return ComputeAttenuationFactor(range,
+                                                                     elevation,
+                                                                     altitude,
+                                                                     xmtrPtr->GetFrequency(),
+                                                                     xmtrPtr->GetPolarization(),
+                                                                     xmtrPtr->GetEarthRadiusMultiplier(),
+                                                                     aEnvironment);
+                                  });
 }
 
 // =================================================================================================
@@ -229,20 +375,14 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
 {
    // The model is valid only from 1 GHz to 1000 GHz
 
-   double frequency = UtMath::Limit(aFrequency, 1.0E+9, 1000.0E+9);
-
-   // Regenerate the table of specific attenuation vs. altitude if there is a significant change
-   // in the frequency for which the current table was generated.
-
-   if (fabs(frequency - mFrequency) > (0.01 * aFrequency))
-   {
-      GenerateTable(frequency, aPolarization, aEnvironment);
-   }
+   double       frequency  = UtMath::Limit(aFrequency, 1.0E+9, 1000.0E+9);
+   const Table& table      = GetTable(frequency, aPolarization, aEnvironment);
+   const auto&  gammaTable = table.mGammaTable;
 
    // Return a factor of 1 for the trivial cases where the range is small or the starting
    // altitude is above the atmosphere.
 
-   if ((aRange < 1.0) || (aAltitude >= mGammaTable.back().mAltitude))
+   if ((aRange < 1.0) || (aAltitude >= gammaTable.back().mAltitude))
    {
       return 1.0;
    }
@@ -250,16 +390,50 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
    double elevation = std::min(std::max(aElevation, 0.0), 89.9 * UtMath::cRAD_PER_DEG);
    double altitude  = std::max(aAltitude, 0.0);
 
+   double atten_dB = 0.0;
+   if (table.mPathRowBegin.empty())
+   {
+      atten_dB = IntegratePath(gammaTable, altitude, elevation, aRange);
+   }
+   else
+   {
+      atten_dB = table.PathAttenuation(altitude, elevation, aRange);
+   }
+
+   // Convert to a linear attenuation factor and return. Note that the result may be zero!
+   double atten = pow(10.0, -0.1 * atten_dB);
+   return atten;
+}
+
+// =================================================================================================
+//! Integrate the specific attenuation along a path.
+//! @param aGammaTable      The table of specific attenuation vs. altitude.
+//! @param aAltitude        The altitude of the start of the path, which must be less than the last altitude
+//!                         in the table (meters).
+//! @param aElevation       The elevation angle of the path, in the range [0, pi/2) (radians).
+//! @param aRange           The length of the path (meters).
+//! @param aLayerRangesPtr  [output] If not null, the range to each layer boundary crossed by the path is appended.
+//! @param aLayerAttensPtr  [output] If not null, the attenuation (dB) at each layer boundary crossed by the path
+//!                         is appended.
+//! @returns The attenuation along the path (dB).
+// private static
+double WsfEM_ITU_Attenuation::IntegratePath(const std::vector<Point>& aGammaTable,
+                                            double                    aAltitude,
+                                            double                    aElevation,
+                                            double                    aRange,
+                                            std::vector<double>*      aLayerRangesPtr,
+                                            std::vector<double>*      aLayerAttensPtr)
+{
    // Find the lower index of the entry such that ALT(i) <= altitude < ALT(i+1).
-   // We have already ensured that the altitude is strictly less that the last
+   // The caller has ensured that the altitude is strictly less that the last
    // altitude in the table.
 
    size_t gtIndex = 0;
-   while (altitude > mGammaTable[gtIndex].mAltitude)
+   while (aAltitude > aGammaTable[gtIndex].mAltitude)
    {
       ++gtIndex;
    }
-   if (altitude != mGammaTable[gtIndex].mAltitude)
+   if (aAltitude != aGammaTable[gtIndex].mAltitude)
    {
       --gtIndex;
    }
@@ -282,16 +456,16 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
    // of this we do NOT use a scaled Earth radius in the following calculations.
 
    double re        = UtSphericalEarth::cEARTH_RADIUS;
-   double sideA     = re + altitude;
-   double angleB    = elevation + UtMath::cPI_OVER_2;
+   double sideA     = re + aAltitude;
+   double angleB    = aElevation + UtMath::cPI_OVER_2;
    double sinAngleB = sin(angleB);
 
    // Adjust the starting gamma based on the fact that we may be starting mid-layer.
-   double lowerAltitude = mGammaTable[gtIndex].mAltitude;
-   double upperAltitude = mGammaTable[gtIndex + 1].mAltitude;
-   double f             = (altitude - lowerAltitude) / (upperAltitude - lowerAltitude);
-   double lowerGamma    = mGammaTable[gtIndex].mGamma;
-   double upperGamma    = mGammaTable[gtIndex + 1].mGamma;
+   double lowerAltitude = aGammaTable[gtIndex].mAltitude;
+   double upperAltitude = aGammaTable[gtIndex + 1].mAltitude;
+   double f             = (aAltitude - lowerAltitude) / (upperAltitude - lowerAltitude);
+   double lowerGamma    = aGammaTable[gtIndex].mGamma;
+   double upperGamma    = aGammaTable[gtIndex + 1].mGamma;
    lowerGamma           = lowerGamma + f * (upperGamma - lowerGamma);
 
    // Iterate through the layers, accumulating the loss in each layer.
@@ -299,11 +473,11 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
    double atten_dB  = 0.0;
    double range     = 0.0;
    double lastRange = 0.0;
-   size_t maxIndex  = mGammaTable.size() - 1;
+   size_t maxIndex  = aGammaTable.size() - 1;
    while ((range < aRange) && (gtIndex < maxIndex))
    {
       // Use the law of sines to get the angle A.
-      double sideB     = re + mGammaTable[gtIndex + 1].mAltitude;
+      double sideB     = re + aGammaTable[gtIndex + 1].mAltitude;
       double sinAngleA = sideA / sideB * sinAngleB;
       double angleA    = asin(sinAngleA);
 
@@ -315,7 +489,7 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
       range        = sideC;
 
       // If this is the final layer, adjust the range and final gamma to reflect partial penetration.
-      upperGamma = mGammaTable[gtIndex + 1].mGamma;
+      upperGamma = aGammaTable[gtIndex + 1].mGamma;
       if (range > aRange)
       {
          f          = (aRange - lastRange) / (range - lastRange);
@@ -325,24 +499,60 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
 
       // Accumulate the attenuation.
       atten_dB += ((0.5 * (lowerGamma + upperGamma)) * ((range - lastRange) * 0.001));
+      if (aLayerRangesPtr != nullptr)
+      {
+         aLayerRangesPtr->push_back(range);
+         aLayerAttensPtr->push_back(atten_dB);
+      }
 
       lowerGamma = upperGamma;
       lastRange  = range;
       ++gtIndex;
    }
+   return atten_dB;
+}
 
-   // Convert to a linear attenuation factor and return. Note that the result may be zero!
-   double atten = pow(10.0, -0.1 * atten_dB);
-   return atten;
+// =================================================================================================
+//! Return the table for the specified frequency and polarization and the current environment.
+//! The table is taken from the cache shared with the other instances of the definition, generating it if needed.
+// private
+const WsfEM_ITU_Attenuation::Table& WsfEM_ITU_Attenuation::GetTable(double                    aFrequency,
+                                                                    WsfEM_Types::Polarization aPolarization,
+                                                                    WsfEnvironment&           aEnvironment)
+{
+   // Polarization only affects the attenuation due to rain.
+   TableKey key;
+   key.mFrequency    = aFrequency;
+   key.mRainRate     = aEnvironment.GetRainRate();
+   key.mPolarization = (key.mRainRate > 0.0) ? aPolarization : WsfEM_Types::cPOL_DEFAULT;
+   key.mRainUpperAlt = aEnvironment.GetRainUpperLevel();
+   aEnvironment.GetCloudLevel(key.mLowerCloudAlt, key.mUpperCloudAlt);
+   key.mCloudWaterDensity = aEnvironment.GetCloudWaterDensity();
+
+   if ((mTablePtr == nullptr) || (!(key == mTableKey)))
+   {
+      std::lock_guard<std::mutex> lock(mTableCachePtr->mMutex);
+      mTablePtr = mTableCachePtr->Find(key);
+      if (mTablePtr == nullptr)
+      {
+         mTablePtr = GenerateTable(key, aPolarization);
+         mTableCachePtr->Add(key, mTablePtr);
+      }
+      mTableKey = key;
+   }
+   return *mTablePtr;
 }
 
 // =================================================================================================
-//! For a given frequency, compute the table of specific attenuation as a function of altitude.
+//! Generate the table of specific attenuation as a function of altitude for the specified conditions,
+//! and the path attenuation table if requested.
 // private
-void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
-                                          WsfEM_Types::Polarization aPolarization,
-                                          WsfEnvironment&           aEnvironment)
+std::shared_ptr<const WsfEM_ITU_Attenuation::Table>
+WsfEM_ITU_Attenuation::GenerateTable(const TableKey& aKey, WsfEM_Types::Polarization aPolarization)
 {
+   auto   tablePtr  = std::make_shared<Table>();
+   double frequency = aKey.mFrequency;
+
    Point  point;
    double pressure;
    double temperature;
@@ -353,18 +563,17 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
 
    double gammaR       = 0.0; // Assume no rain
    double upperRainAlt = 0.0;
-   double rainRate     = aEnvironment.GetRainRate();
+   double rainRate     = aKey.mRainRate;
    if (rainRate > 0.0)
    {
-      upperRainAlt = aEnvironment.GetRainUpperLevel();
-      gammaR       = ComputeRainSpecificAttenuation(aFrequency, aPolarization, rainRate);
+      upperRainAlt = aKey.mRainUpperAlt;
+      gammaR       = ComputeRainSpecificAttenuation(frequency, aPolarization, rainRate);
 
       // If an upper rain altitude was not specified use the lower cloud altitude if it was specified.
       // If it wasn't specified then use 10000.0 m.
       if ((rainRate > 0.0) && (upperRainAlt <= 0.0))
       {
-         double notUsed;
-         aEnvironment.GetCloudLevel(upperRainAlt, notUsed);
+         upperRainAlt = aKey.mLowerCloudAlt;
          if (upperRainAlt <= 0.0)
          {
             upperRainAlt = 10000.0;
@@ -375,10 +584,9 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
    // Determine if the contribution of clouds/fog is to be calculated. This is only done if
    // the cloud level and water density within the cloud are defined.
 
-   double lowerCloudAlt;
-   double upperCloudAlt;
-   aEnvironment.GetCloudLevel(lowerCloudAlt, upperCloudAlt);
-   double cloudWaterDensity = aEnvironment.GetCloudWaterDensity();
+   double lowerCloudAlt     = aKey.mLowerCloudAlt;
+   double upperCloudAlt     = aKey.mUpperCloudAlt;
+   double cloudWaterDensity = aKey.mCloudWaterDensity;
    if ((cloudWaterDensity == 0.0) || (upperCloudAlt <= lowerCloudAlt))
    {
       lowerCloudAlt     = 0.0;
@@ -397,9 +605,8 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
       maxAltInt += 1000;
    }
 
-   mFrequency = aFrequency;
-   mGammaTable.clear();
-   mGammaTable.reserve(maxAltInt);
+   std::vector<Point>& gammaTable = tablePtr->mGammaTable;
+   gammaTable.reserve(maxAltInt / 1000 + 1);
    for (int ialt = 0; ialt <= maxAltInt; ialt += 1000)
    {
       point.mAltitude = ialt;
@@ -411,7 +618,7 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
       }
 
       // Compute contribution due to atmospheric gases.
-      point.mGamma = ComputeGasSpecificAttenuation(aFrequency, pressure, temperature, waterVaporDensity);
+      point.mGamma = ComputeGasSpecificAttenuation(frequency, pressure, temperature, waterVaporDensity);
 
       // Add in contribution due to rain.
       if (point.mAltitude <= upperRainAlt)
@@ -422,10 +629,100 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
       // Add in contribution due to clouds/fog.
       if ((cloudWaterDensity > 0.0) && (point.mAltitude >= lowerCloudAlt) && (point.mAltitude <= upperCloudAlt))
       {
-         point.mGamma += ComputeCloudSpecificAttenuation(aFrequency, temperature, cloudWaterDensity);
+         point.mGamma += ComputeCloudSpecificAttenuation(frequency, temperature, cloudWaterDensity);
+      }
+      gammaTable.push_back(point);
+   }
+
+   if (mUsePathTable && (gammaTable.size() >= 2))
+   {
+      tablePtr->BuildPathTable();
+   }
+   return tablePtr;
+}
+
+// =================================================================================================
+//! Build the path attenuation table by integrating along the path from each table altitude at each of the
+//! table elevation angles until the path leaves the top of the table.
+void WsfEM_ITU_Attenuation::Table::BuildPathTable()
+{
+   size_t altitudeCount = mGammaTable.size();
+   mPathRowBegin.clear();
+   mPathRowBegin.reserve(altitudeCount * cPATH_ELEVATION_COUNT + 1);
+   mPathRange.clear();
+   mPathAtten_dB.clear();
+   for (size_t altIndex = 0; altIndex < altitudeCount; ++altIndex)
+   {
+      for (size_t elevIndex = 0; elevIndex < cPATH_ELEVATION_COUNT; ++elevIndex)
+      {
+         mPathRowBegin.push_back(mPathRange.size());
+         if ((altIndex + 1) < altitudeCount)
+         {
+            double elevation = std::min(PathElevation(elevIndex), 89.9 * UtMath::cRAD_PER_DEG);
+            IntegratePath(mGammaTable,
+                          mGammaTable[altIndex].mAltitude,
+                          elevation,
+                          std::numeric_limits<double>::max(),
+                          &mPathRange,
+                          &mPathAtten_dB);
+         }
       }
-      mGammaTable.push_back(point);
    }
+   mPathRowBegin.push_back(mPathRange.size());
+}
+
+// =================================================================================================
+//! Return the path attenuation (dB) by interpolating the path attenuation table.
+//! @param aAltitude  The altitude of the start of the path (meters), less than the last table altitude.
+//! @param aElevation The elevation angle of the path (radians) in the range [0, pi/2).
+//! @param aRange     The length of the path (meters).
+double WsfEM_ITU_Attenuation::Table::PathAttenuation(double aAltitude, double aElevation, double aRange) const
+{
+   double altitudePos      = aAltitude / (mGammaTable[1].mAltitude - mGammaTable[0].mAltitude);
+   size_t altIndex         = std::min(static_cast<size_t>(altitudePos), mGammaTable.size() - 2);
+   double altitudeFraction = altitudePos - altIndex;
+
+   double elevationPos      = sqrt(aElevation / UtMath::cPI_OVER_2) * (cPATH_ELEVATION_COUNT - 1);
+   size_t elevIndex         = std::min(static_cast<size_t>(elevationPos), cPATH_ELEVATION_COUNT - 2);
+   double elevationFraction = elevationPos - elevIndex;
+
+   size_t lowerRow   = altIndex * cPATH_ELEVATION_COUNT + elevIndex;
+   size_t upperRow   = lowerRow + cPATH_ELEVATION_COUNT;
+   double lowerAtten = RowAttenuation(lowerRow, aRange);
+   lowerAtten += elevationFraction * (RowAttenuation(lowerRow + 1, aRange) - lowerAtten);
+   double upperAtten = RowAttenuation(upperRow, aRange);
+   upperAtten += elevationFraction * (RowAttenuation(upperRow + 1, aRange) - upperAtten);
+   return lowerAtten + altitudeFraction * (upperAtten - lowerAtten);
+}
+
+// =================================================================================================
+//! Return the attenuation (dB) at the specified range along the path of a row in the path attenuation table.
+// private
+double WsfEM_ITU_Attenuation::Table::RowAttenuation(size_t aRow, double aRange) const
+{
+   auto rowBegin = mPathRange.begin() + mPathRowBegin[aRow];
+   auto rowEnd   = mPathRange.begin() + mPathRowBegin[aRow + 1];
+   if (rowBegin == rowEnd)
+   {
+      return 0.0; // The path starts at the top of the table
+   }
+
+   auto   rangeIter = std::lower_bound(rowBegin, rowEnd, aRange);
+   size_t index     = static_cast<size_t>(rangeIter - mPathRange.begin());
+   if (rangeIter == rowEnd)
+   {
+      return mPathAtten_dB[index - 1]; // The path has left the top of the table
+   }
+
+   double lowerRange = 0.0;
+   double lowerAtten = 0.0;
+   if (rangeIter != rowBegin)
+   {
+      lowerRange = mPathRange[index - 1];
+      lowerAtten = mPathAtten_dB[index - 1];
+   }
+   double f = (aRange - lowerRange) / (mPathRange[index] - lowerRange);
+   return lowerAtten + f * (mPathAtten_dB[index] - lowerAtten);
 }
 
 // =================================================================================================
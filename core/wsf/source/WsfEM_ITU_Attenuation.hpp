@@ -15,6 +15,7 @@
 #include "wsf_export.h"
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include "UtAtmosphere.hpp"
@@ -30,6 +31,10 @@
 //! 2) "Recommendation ITU-R P.835-4, Reference standard atmospheres".
 //! 3) "Recommendation ITU-R P.838-3, Specific attenuation model for rain for use in prediction methods".
 //! 4) "Recommendation ITU-R P.840-4, Attenuation due to clouds and fog".
+//!
+//! The tables of specific attenuation vs. altitude are shared by all instances created from the same definition.
+//! A table is generated for each combination of frequency, polarization and environmental conditions
+//! that is encountered, so frequency agile or multi-band systems do not repeatedly regenerate their tables.
 class WSF_EXPORT WsfEM_ITU_Attenuation : public WsfEM_Attenuation
 {
 public:
@@ -71,27 +76,61 @@ public:
    static void PlotCloudFigure1();
 
 private:
+   //! Specific attenuation at an altitude.
+   struct Point
+   {
+      double mAltitude; //!< meters
+      double mGamma;    //!< dB/km
+   };
+
+   //! The frequency and the environmental conditions for which a table is generated.
+   struct TableKey
+   {
+      bool operator<(const TableKey& aRhs) const;
+      bool operator==(const TableKey& aRhs) const;
+
+      double mFrequency;
+      int    mPolarization;
+      double mRainRate;
+      double mRainUpperAlt;
+      double mLowerCloudAlt;
+      double mUpperCloudAlt;
+      double mCloudWaterDensity;
+   };
+
+   class Table;
+   class TableCache;
+
    static void ComputeAtmosphereData(UtAtmosphere& aAtmosphere,
                                      double        aAltitude,
                                      double&       aPressure,
                                      double&       aTemperature,
                                      double&       aWaterVaporDensity);
 
-   void GenerateTable(double aFrequency, WsfEM_Types::Polarization aPolarization, WsfEnvironment& aEnvironment);
+   static double IntegratePath(const std::vector<Point>& aGammaTable,
+                               double                    aAltitude,
+                               double                    aElevation,
+                               double                    aRange,
+                               std::vector<double>*      aLayerRangesPtr = nullptr,
+                               std::vector<double>*      aLayerAttensPtr = nullptr);
+
+   const Table& GetTable(double aFrequency, WsfEM_Types::Polarization aPolarization, WsfEnvironment& aEnvironment);
+
+   std::shared_ptr<const Table> GenerateTable(const TableKey& aKey, WsfEM_Types::Polarization aPolarization);
 
    //! The atmosphere for computing pressure, temperature and water vapor density.
    UtAtmosphere mAtmosphere;
 
-   //! The frequency at which the tables were last calculated
-   double mFrequency;
+   //! If true, a table of path attenuation vs. altitude, elevation and range is generated along with each
+   //! table of specific attenuation, and is used instead of integrating along the path.
+   bool mUsePathTable;
 
-   //! Specific attenuation as a function of altitude.
-   struct Point
-   {
-      double mAltitude; //!< meters
-      double mGamma;    //!< dB/km
-   };
-   std::vector<Point> mGammaTable;
+   //! The tables generated for this definition (shared by clones).
+   std::shared_ptr<TableCache> mTableCachePtr;
+
+   //! The table used by the last call and its key.
+   std::shared_ptr<const Table> mTablePtr;
+   TableKey                     mTableKey;
 };
 
 #endif
@@ -189,6 +189,14 @@ WsfEM_PropagationTypes::LoadResult WsfEM_PropagationTypes::LoadType(UtInput& aIn
    return result;
 }
 
+// =================================================================================================
+bool WsfEM_PropagationTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("propagation");
+   aKeywords.push_back("propagation_model");
+   return true;
+}
+
 
 // =================================================================================================
 // private
@@ -38,6 +38,7 @@ WsfEnvironment::WsfEnvironment(WsfScenario& aScenario)
    , mPolarOffsetAngleY(0.0)
    , mWindAltitudeTablePtr(nullptr)
    , mCentralPointPtr(ut::make_unique<ut::EarthWGS84>())
+   , mChangeCount(0)
 {
    mNoiseCloudTypes = new WsfNoiseCloudTypes(aScenario);
 }
@@ -552,4 +553,5 @@ bool WsfEnvironment::LOS_AdjustedClearOfClouds(const double aEmissionPointWCS[3]
 void WsfEnvironment::SetLandCoverStrategy(const GetLandCoverFunction& aFunction)
 {
    mGetLandCoverFunction = aFunction;
+   ++mChangeCount;
 }
@@ -124,11 +124,19 @@ public:
 
    double GetWindSpeed() const { return mWindSpeed; }
 
-   void SetWindSpeed(double aSpeed) { mWindSpeed = aSpeed; }
+   void SetWindSpeed(double aSpeed)
+   {
+      mWindSpeed = aSpeed;
+      ++mChangeCount;
+   }
 
    double GetWindDirection() const { return mWindDirection; }
 
-   void SetWindDirection(double aDirection) { mWindDirection = aDirection; }
+   void SetWindDirection(double aDirection)
+   {
+      mWindDirection = aDirection;
+      ++mChangeCount;
+   }
 
    void GetWind(double aLat, double aLon, double aAlt, double& aWindHeading, double& aWindSpeed);
 
@@ -175,6 +183,10 @@ public:
 
    void GetPolarOffsetAngles(double& aPolarOffsetAngleX, double& aPolarOffsetAngleY) const;
 
+   //! Return the number of times the environment has been changed after input processing.
+   //! Objects that cache values derived from the environment compare this to detect that they are stale.
+   unsigned int GetChangeCount() const { return mChangeCount; }
+
 private:
    ut::CentralBody& GetCentralBodyP() { return mCentralPointPtr->GetAsCentralBody(); }
 
@@ -198,6 +210,7 @@ private:
 
    WsfNoiseCloudTypes*                mNoiseCloudTypes;
    ut::CloneablePtr<ut::CentralPoint> mCentralPointPtr;
+   unsigned int                       mChangeCount;
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include "WsfSystemLog.hpp"
 #include "WsfTaskObserver.hpp"
 #include "WsfTrackObserver.hpp"
+#include "WsfZoneObserver.hpp"
 
 namespace wsf
 {
@@ -425,6 +426,8 @@ void SimulationExtension::AddedToSimulation()
    AddEvent<TaskCanceled>("TASK_CANCELED", WsfObserver::TaskCanceled(simPtr));
    AddEvent<TaskCompleted>("TASK_COMPLETED", WsfObserver::TaskCompleted(simPtr));
    AddEvent<PlatformAddedTeamName>("TEAM_NAME_DEFINITION", WsfObserver::PlatformAdded(simPtr));
+   AddEvent<ZoneEntered>("ZONE_ENTERED", WsfObserver::ZoneEntered(simPtr));
+   AddEvent<ZoneExited>("ZONE_EXITED", WsfObserver::ZoneExited(simPtr));
 
    // Included for backward compatibility
    AddEventAlias("AUTONOMY_LEVEL_CHANGED", "OPERATING_LEVEL_CHANGED");
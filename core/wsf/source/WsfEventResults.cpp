@@ -14,6 +14,7 @@
 #include <iomanip>
 #include <iostream>
 
+#include "UtEllipsoidalEarth.hpp"
 #include "WsfBehaviorTreeNode.hpp"
 #include "WsfCallback.hpp"
 #include "WsfComm.hpp"
@@ -35,6 +36,7 @@
 #include "WsfSimulation.hpp"
 #include "WsfTankedFuel.hpp"
 #include "WsfTask.hpp"
+#include "WsfZone.hpp"
 
 namespace wsf
 {
@@ -2744,5 +2746,84 @@ void TaskCompleted::PrintCSV(std::ostream& aStream) const
    // clang-format on
 }
 
+namespace
+{
+// =================================================================================================
+//! Print the location at which a platform crossed a zone boundary, in the format of utils::PrintLocationData.
+void PrintZoneCrossingLocation(std::ostream&   aStream,
+                               WsfPlatform*    aPlatformPtr,
+                               const UtVec3d&  aCrossingLocationWCS,
+                               const Settings& aSettings)
+{
+   if (aSettings.PrintLLA_Locations())
+   {
+      double lat;
+      double lon;
+      double alt;
+      UtEllipsoidalEarth::ConvertECEFToLLA(aCrossingLocationWCS.GetData(), lat, lon, alt);
+      utils::PrintLocationDataLLA(aStream, lat, lon, alt, aSettings.GetLatLonFormat());
+   }
+   else // Use ECI
+   {
+      double locationECI[3];
+      aPlatformPtr->ConvertWCSToECI(aCrossingLocationWCS.GetData(), locationECI);
+      utils::PrintLocationDataECI(aStream, locationECI);
+   }
+}
+
+// =================================================================================================
+//! Print the location at which a platform crossed a zone boundary, in the format of utilsCSV::PrintLocationData.
+void PrintZoneCrossingLocationCSV(std::ostream& aStream, WsfPlatform* aPlatformPtr, const UtVec3d& aCrossingLocationWCS)
+{
+   double lat;
+   double lon;
+   double alt;
+   UtEllipsoidalEarth::ConvertECEFToLLA(aCrossingLocationWCS.GetData(), lat, lon, alt);
+   utilsCSV::PrintLocationDataLLA(aStream, lat, lon, alt);
+
+   double locationECI[3];
+   aPlatformPtr->ConvertWCSToECI(aCrossingLocationWCS.GetData(), locationECI);
+   utilsCSV::PrintLocationDataECI(aStream, locationECI);
+}
+} // namespace
+
+void ZoneEntered::Print(std::ostream& aStream) const
+{
+   utils::PrintTime(aStream, mSimTime, mSettings.GetTimeFormat());
+   aStream << "ZONE_ENTERED " << mPlatformPtr->GetName() << " Zone: " << mZonePtr->GetName()
+           << utils::ContinueChar(mSettings.PrintSingleLinePerEvent())
+           << " Crossing_Time: " << UtTime(mCrossingTime, mSettings.GetTimeFormat());
+   PrintZoneCrossingLocation(aStream, mPlatformPtr, mCrossingLocationWCS, mSettings);
+   aStream << '\n';
+}
+
+void ZoneEntered::PrintCSV(std::ostream& aStream) const
+{
+   utilsCSV::PrintTime(aStream, mSimTime);
+   aStream << ',' << "ZONE_ENTERED" << ',' << mPlatformPtr->GetName() << ',' << mPlatformPtr->GetSide() << ','
+           << mZonePtr->GetName() << ',' << mCrossingTime;
+   PrintZoneCrossingLocationCSV(aStream, mPlatformPtr, mCrossingLocationWCS);
+   aStream << '\n';
+}
+
+void ZoneExited::Print(std::ostream& aStream) const
+{
+   utils::PrintTime(aStream, mSimTime, mSettings.GetTimeFormat());
+   aStream << "ZONE_EXITED " << mPlatformPtr->GetName() << " Zone: " << mZonePtr->GetName()
+           << utils::ContinueChar(mSettings.PrintSingleLinePerEvent())
+           << " Crossing_Time: " << UtTime(mCrossingTime, mSettings.GetTimeFormat());
+   PrintZoneCrossingLocation(aStream, mPlatformPtr, mCrossingLocationWCS, mSettings);
+   aStream << '\n';
+}
+
+void ZoneExited::PrintCSV(std::ostream& aStream) const
+{
+   utilsCSV::PrintTime(aStream, mSimTime);
+   aStream << ',' << "ZONE_EXITED" << ',' << mPlatformPtr->GetName() << ',' << mPlatformPtr->GetSide() << ','
+           << mZonePtr->GetName() << ',' << mCrossingTime;
+   PrintZoneCrossingLocationCSV(aStream, mPlatformPtr, mCrossingLocationWCS);
+   aStream << '\n';
+}
+
 } // namespace event
 } // namespace wsf
@@ -16,6 +16,7 @@
 
 #include <ostream>
 
+#include "UtVec3.hpp"
 class WsfBehaviorTreeNode;
 class WsfCallback;
 #include "WsfComm.hpp"
@@ -29,6 +30,7 @@ class WsfImage;
 class WsfProcessor;
 class WsfSensorMode;
 class WsfTask;
+class WsfZone;
 
 namespace wsf
 {
@@ -2420,6 +2422,74 @@ private:
    WsfStringId    mStatus;
 };
 
+// ===================================================================================================
+class WSF_EXPORT ZoneEntered : public Result
+{
+public:
+   static constexpr const char* cNAME = "ZONE_ENTERED";
+   ZoneEntered(double         aSimTime,
+               WsfPlatform*   aPlatformPtr,
+               WsfZone*       aZonePtr,
+               double         aCrossingTime,
+               const UtVec3d& aCrossingLocationWCS,
+               Settings       aSettings = Settings())
+      : Result(aSimTime, std::move(aSettings), cNAME)
+      , mPlatformPtr(aPlatformPtr)
+      , mZonePtr(aZonePtr)
+      , mCrossingTime(aCrossingTime)
+      , mCrossingLocationWCS(aCrossingLocationWCS)
+   {
+   }
+
+   void Print(std::ostream& aStream) const override;
+   void PrintCSV(std::ostream& aStream) const override;
+
+   const WsfPlatform* GetPlatform() const { return mPlatformPtr; }
+   const WsfZone*     GetZone() const { return mZonePtr; }
+   double             GetCrossingTime() const { return mCrossingTime; }
+   const UtVec3d&     GetCrossingLocationWCS() const { return mCrossingLocationWCS; }
+
+private:
+   WsfPlatform* mPlatformPtr;
+   WsfZone*     mZonePtr;
+   double       mCrossingTime;
+   UtVec3d      mCrossingLocationWCS;
+};
+
+// ===================================================================================================
+class WSF_EXPORT ZoneExited : public Result
+{
+public:
+   static constexpr const char* cNAME = "ZONE_EXITED";
+   ZoneExited(double         aSimTime,
+               WsfPlatform*   aPlatformPtr,
+               WsfZone*       aZonePtr,
+               double         aCrossingTime,
+               const UtVec3d& aCrossingLocationWCS,
+               Settings       aSettings = Settings())
+      : Result(aSimTime, std::move(aSettings), cNAME)
+      , mPlatformPtr(aPlatformPtr)
+      , mZonePtr(aZonePtr)
+      , mCrossingTime(aCrossingTime)
+      , mCrossingLocationWCS(aCrossingLocationWCS)
+   {
+   }
+
+   void Print(std::ostream& aStream) const override;
+   void PrintCSV(std::ostream& aStream) const override;
+
+   const WsfPlatform* GetPlatform() const { return mPlatformPtr; }
+   const WsfZone*     GetZone() const { return mZonePtr; }
+   double             GetCrossingTime() const { return mCrossingTime; }
+   const UtVec3d&     GetCrossingLocationWCS() const { return mCrossingLocationWCS; }
+
+private:
+   WsfPlatform* mPlatformPtr;
+   WsfZone*     mZonePtr;
+   double       mCrossingTime;
+   UtVec3d      mCrossingLocationWCS;
+};
+
 } // namespace event
 } // namespace wsf
 
@@ -29,48 +29,56 @@ namespace wsf
 // =================================================================================================
 bool ExternalLinks::ExternalLink::AddAddressRecipient(const Address& aAddress)
 {
+   mRecipientsPtr.reset();
    return mAddressRecipients.insert(aAddress).second;
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::AddGroupRecipient(WsfStringId aGroupName)
 {
+   mRecipientsPtr.reset();
    return mGroups.insert(aGroupName).second;
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::AddCommandRecipient(const CommandChainTarget& aCommandChainTarget)
 {
+   mRecipientsPtr.reset();
    return mCommandRecipients.insert(aCommandChainTarget).second;
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::AddCommRecipient(const CommPair& aCommPair)
 {
+   mRecipientsPtr.reset();
    return mCommRecipients.insert(aCommPair).second;
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::RemoveAddressRecipient(const Address& aAddress)
 {
+   mRecipientsPtr.reset();
    return (mAddressRecipients.erase(aAddress) == 1U);
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::RemoveGroupRecipient(WsfStringId aGroupName)
 {
+   mRecipientsPtr.reset();
    return (mGroups.erase(aGroupName) == 1U);
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::RemoveCommandRecipient(const CommandChainTarget& aCommandChainTarget)
 {
+   mRecipientsPtr.reset();
    return (mCommandRecipients.erase(aCommandChainTarget) == 1U);
 }
 
 // =================================================================================================
 bool ExternalLinks::ExternalLink::RemoveCommRecipient(const CommPair& aCommPair)
 {
+   mRecipientsPtr.reset();
    return (mCommRecipients.erase(aCommPair) == 1U);
 }
 
@@ -81,20 +89,81 @@ void ExternalLinks::ExternalLink::DeleteAllRecipients()
    mGroups.clear();
    mCommandRecipients.clear();
    mCommRecipients.clear();
+   mRecipientsPtr.reset();
 }
 
 // =================================================================================================
+void ExternalLinks::ExternalLink::SetParent(ExternalLinks* aParentPtr)
+{
+   mParentPtr = aParentPtr;
+   mRecipientsPtr.reset();
+}
+
+// =================================================================================================
+//! Return the recipients of the link.
+//! This returns a copy of the recipients from GetCachedRecipients.
 ExternalLinks::AddressVec ExternalLinks::ExternalLink::GetRecipients(bool aNotify) const
 {
-   AddressVec recipients;
-   auto       simPtr = mParentPtr->GetSimulation();
+   return *GetCachedRecipients(aNotify);
+}
+
+// =================================================================================================
+//! Return the recipients of the link.
+//! The recipients are resolved on the first call, and again only when the change count of the network manager,
+//! or of a group or command chain referenced by the link, has changed. Otherwise the recipients from the previous
+//! call are returned, which avoids resolving them for every message sent on the link.
+//! @param aNotify If true, a warning is written for each recipient that cannot be resolved. Recipients are only
+//!                resolved when something has changed, so the warnings are not repeated on every call.
+//! @returns The recipients. The list is never modified, so it remains valid while the pointer is held.
+std::shared_ptr<const ExternalLinks::AddressVec> ExternalLinks::ExternalLink::GetCachedRecipients(bool aNotify) const
+{
+   auto simPtr = mParentPtr->GetSimulation();
    if ((!simPtr) || (!mParentPtr->GetPlatform()))
    {
-      return recipients;
+      mRecipientsPtr.reset();
+      return std::make_shared<const AddressVec>();
    }
 
-   auto  networkManagerPtr = simPtr->GetCommNetworkManager();
-   auto& groupManager      = simPtr->GetGroupManager();
+   GetChangeCounts(*simPtr, mCurrentChangeCounts);
+   if ((!mRecipientsPtr) || (mCurrentChangeCounts != mRecipientChangeCounts))
+   {
+      mRecipientsPtr = std::make_shared<const AddressVec>(ResolveRecipients(*simPtr, aNotify));
+      mRecipientChangeCounts.swap(mCurrentChangeCounts);
+   }
+   return mRecipientsPtr;
+}
+
+// =================================================================================================
+//! Collect the change counts of the objects from which the recipients are resolved.
+//! A group or command chain that does not exist is given a count of zero.
+// protected
+void ExternalLinks::ExternalLink::GetChangeCounts(WsfSimulation& aSimulation, ChangeCounts& aChangeCounts) const
+{
+   auto& groupManager = aSimulation.GetGroupManager();
+
+   aChangeCounts.clear();
+   aChangeCounts.push_back(aSimulation.GetCommNetworkManager()->GetChangeCount());
+   aChangeCounts.push_back(groupManager.GetChangeCount());
+   for (const auto& groupName : mGroups)
+   {
+      auto groupPtr = groupManager.GetGroup(groupName);
+      aChangeCounts.push_back(groupPtr ? groupPtr->GetChangeCount() : 0U);
+   }
+   for (const auto& chainRecipient : mCommandRecipients)
+   {
+      auto commandChainPtr = mParentPtr->GetPlatform()->GetComponent<WsfCommandChain>(chainRecipient.mChainName);
+      aChangeCounts.push_back(commandChainPtr ? commandChainPtr->GetChangeCount() : 0U);
+   }
+}
+
+// =================================================================================================
+//! Resolve the recipients of the link from its addresses, groups, command chains and platform/comm names.
+// protected
+ExternalLinks::AddressVec ExternalLinks::ExternalLink::ResolveRecipients(WsfSimulation& aSimulation, bool aNotify) const
+{
+   AddressVec recipients;
+   auto       networkManagerPtr = aSimulation.GetCommNetworkManager();
+   auto&      groupManager      = aSimulation.GetGroupManager();
 
    //! Add recipients identified by an address.
    for (const auto& address : mAddressRecipients)
@@ -119,13 +188,13 @@ ExternalLinks::AddressVec ExternalLinks::ExternalLink::GetRecipients(bool aNotif
       auto groupPtr = groupManager.GetGroup(groupName);
       if (groupPtr)
       {
-         auto members = groupPtr->GetMembers();
+         const auto& members = groupPtr->GetMembers();
          for (const auto& member : members)
          {
             //! We only allow platform parts, specifically comms.
             if (member.second != 0U)
             {
-               auto platformPtr = simPtr->GetPlatformByIndex(member.first);
+               auto platformPtr = aSimulation.GetPlatformByIndex(member.first);
                if (platformPtr)
                {
                   auto partPtr = platformPtr->GetArticulatedPart(member.second);
@@ -173,7 +242,7 @@ ExternalLinks::AddressVec ExternalLinks::ExternalLink::GetRecipients(bool aNotif
          }
          case CommandChainRecipient::cSUBORDINATES:
          {
-            auto subs = commandChainPtr->GetSubordinates();
+            const auto& subs = commandChainPtr->GetSubordinates();
             for (const auto& sub : subs)
             {
                auto commPtr = sub->GetComponent<comm::Comm>(chainRecipient.mRcvrName);
@@ -191,7 +260,7 @@ ExternalLinks::AddressVec ExternalLinks::ExternalLink::GetRecipients(bool aNotif
          }
          case CommandChainRecipient::cPEERS:
          {
-            auto peers = commandChainPtr->GetPeers();
+            const auto& peers = commandChainPtr->GetPeers();
             for (const auto& peer : peers)
             {
                auto commPtr = peer->GetComponent<comm::Comm>(chainRecipient.mRcvrName);
@@ -218,7 +287,7 @@ ExternalLinks::AddressVec ExternalLinks::ExternalLink::GetRecipients(bool aNotif
    //! Add recipients identified by platform-name comm-name pair
    for (const auto& namePair : mCommRecipients)
    {
-      auto platformPtr = simPtr->GetPlatformByName(namePair.first);
+      auto platformPtr = aSimulation.GetPlatformByName(namePair.first);
       if (platformPtr)
       {
          auto commPtr = platformPtr->GetComponent<comm::Comm>(namePair.second);
@@ -264,7 +333,7 @@ size_t ExternalLinks::ExternalLink::GetRecipientCount() const
 
    if (mParentPtr)
    {
-      auto groupManager = mParentPtr->GetSimulation()->GetGroupManager();
+      auto& groupManager = mParentPtr->GetSimulation()->GetGroupManager();
       for (const auto& curGroup : mGroups)
       {
          auto groupPtr = groupManager.GetGroup(curGroup);
@@ -616,27 +685,14 @@ bool ExternalLinks::CommandChainCommand(const std::string& aCommand, CommandChai
 
 // =================================================================================================
 #undef SendMessage // Avoid conflict with Windows macro
+//! Send a message to the recipients of each link.
+//! The recipients of a link are resolved only when they may have changed (see ExternalLink::GetCachedRecipients).
 void ExternalLinks::SendMessage(double aSimTime, const WsfMessage& aMessage)
 {
    for (const auto& link : mLinks)
    {
-      auto xmtrPtr    = link.GetXmtr();
-      auto recipients = link.GetRecipients(mDebug);
-
-      for (const auto& recipient : recipients)
-      {
-         if (xmtrPtr->GetAddress() != recipient)
-         {
-            xmtrPtr->Send(aSimTime, ut::clone(aMessage), recipient);
-         }
-         else if (mDebug)
-         {
-            auto out = ut::log::warning() << "External link message send aborted.";
-            out.AddNote() << "Sender and recipient was the same address.";
-            out.AddNote() << "Address: " << recipient;
-            out.AddNote() << "Platform: " << GetPlatform()->GetName();
-         }
-      }
+      auto recipientsPtr = link.GetCachedRecipients(mDebug);
+      SendToRecipients(aSimTime, aMessage, *link.GetXmtr(), *recipientsPtr);
    }
 }
 
@@ -658,12 +714,13 @@ void ExternalLinks::SendMessage(double aSimTime, const WsfMessage& aMessage, Wsf
 
    auto networkManagerPtr = GetSimulation()->GetCommNetworkManager();
 
+   AddressVec recipients;
    for (const auto& link : mLinks)
    {
-      auto xmtrPtr    = link.GetXmtr();
-      auto recipients = link.GetRecipients(mDebug);
+      auto recipientsPtr = link.GetCachedRecipients(mDebug);
 
-      for (const auto& recipient : recipients)
+      recipients.clear();
+      for (const auto& recipient : *recipientsPtr)
       {
          auto commPtr = networkManagerPtr->GetComm(recipient);
          if (commPtr)
@@ -673,18 +730,32 @@ void ExternalLinks::SendMessage(double aSimTime, const WsfMessage& aMessage, Wsf
                continue;
             }
          }
+         recipients.push_back(recipient);
+      }
+      SendToRecipients(aSimTime, aMessage, *link.GetXmtr(), recipients);
+   }
+}
 
-         if (xmtrPtr->GetAddress() != recipient)
-         {
-            xmtrPtr->Send(aSimTime, ut::clone(aMessage), recipient);
-         }
-         else if (mDebug)
-         {
-            auto out = ut::log::warning() << "External link message send aborted.";
-            out.AddNote() << "Sender and recipient was the same address.";
-            out.AddNote() << "Address: " << recipient;
-            out.AddNote() << "Platform: " << GetPlatform()->GetName();
-         }
+// =================================================================================================
+//! Send a copy of a message to each recipient of a link, other than the transmitter itself.
+// protected
+void ExternalLinks::SendToRecipients(double            aSimTime,
+                                     const WsfMessage& aMessage,
+                                     comm::Comm&       aXmtr,
+                                     const AddressVec& aRecipients) const
+{
+   for (const auto& recipient : aRecipients)
+   {
+      if (aXmtr.GetAddress() != recipient)
+      {
+         aXmtr.Send(aSimTime, ut::clone(aMessage), recipient);
+      }
+      else if (mDebug)
+      {
+         auto out = ut::log::warning() << "External link message send aborted.";
+         out.AddNote() << "Sender and recipient was the same address.";
+         out.AddNote() << "Address: " << recipient;
+         out.AddNote() << "Platform: " << GetPlatform()->GetName();
       }
    }
 }
@@ -14,6 +14,7 @@
 
 #include "wsf_export.h"
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -148,22 +149,36 @@ public:
       //! @note Do not use these calls prior to simulation pending start.
       //! They require full initialization of the comm framework to resolve addressing.
       //@{
-      AddressVec  GetRecipients(bool aNotify = false) const;
-      comm::Comm* GetXmtr() const;
-      size_t      GetRecipientCount() const;
+      AddressVec                        GetRecipients(bool aNotify = false) const;
+      std::shared_ptr<const AddressVec> GetCachedRecipients(bool aNotify = false) const;
+      comm::Comm*                       GetXmtr() const;
+      size_t                            GetRecipientCount() const;
       //@}
 
       WsfStringId GetXmtrName() const { return mXmtrName; }
       void        SetXmtrName(WsfStringId aXmtrName) { mXmtrName = aXmtrName; }
-      void        SetParent(ExternalLinks* aParentPtr) { mParentPtr = aParentPtr; }
+      void        SetParent(ExternalLinks* aParentPtr);
 
    protected:
+      using ChangeCounts = std::vector<unsigned int>;
+
+      AddressVec ResolveRecipients(WsfSimulation& aSimulation, bool aNotify) const;
+      void       GetChangeCounts(WsfSimulation& aSimulation, ChangeCounts& aChangeCounts) const;
+
       WsfStringId    mXmtrName{};
       AddressSet     mAddressRecipients{};
       WsfStringSet   mGroups{};
       CommandSet     mCommandRecipients{};
       CommSet        mCommRecipients{};
       ExternalLinks* mParentPtr{nullptr};
+
+      //! The recipients last resolved by GetCachedRecipients, and the change counts of the network manager,
+      //! groups and command chains from which they were resolved. A null pointer indicates they must be resolved.
+      //@{
+      mutable std::shared_ptr<const AddressVec> mRecipientsPtr{};
+      mutable ChangeCounts                      mRecipientChangeCounts{};
+      mutable ChangeCounts                      mCurrentChangeCounts{};
+      //@}
    };
 
    ExternalLinks()          = default;
@@ -212,6 +227,11 @@ protected:
    LinkIt      FindLink(WsfStringId aXmtrName);
    LinkConstIt FindLink(WsfStringId aXmtrName) const;
 
+   void SendToRecipients(double            aSimTime,
+                         const WsfMessage& aMessage,
+                         comm::Comm&       aXmtr,
+                         const AddressVec& aRecipients) const;
+
    LinkVec      mLinks{};
    WsfPlatform* mPlatformPtr{nullptr};
    bool         mDebug{false};
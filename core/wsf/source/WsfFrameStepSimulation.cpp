@@ -12,6 +12,8 @@
 #include "WsfFrameStepSimulation.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include "UtInput.hpp"
 #include "UtLog.hpp"
@@ -32,6 +34,9 @@
 
 namespace
 {
+//! The weight given to the latest measurement when smoothing the update cost history.
+const double cCOST_SMOOTHING_FACTOR = 0.25;
+
 template<typename T>
 void Erase(std::vector<T>& aVector, T aElement)
 {
@@ -68,6 +73,11 @@ WsfFrameStepSimulation::WsfFrameStepSimulation(WsfScenario& aScenario, unsigned
    , mTotalFrameOverCount(0.0)
    , mSkippedFrameCount(0.0)
    , mWorstFrameOverTime(0.0)
+   , mDeferredSensorCount(0.0)
+   , mSensorHistory()
+   , mDueSensors()
+   , mSensorUpdateCost(0.0)
+   , mPostSensorCost(0.0)
    , mPlatforms()
    , mComms()
    , mProcessors()
@@ -138,27 +148,9 @@ double WsfFrameStepSimulation::AdvanceFrame()
 
    // Now update subsystems.
 
-   for (i = 0; i < mComms.size(); ++i)
-   {
-      mComms[i]->Update(currentFrameTime);
-   }
-
-   for (i = 0; i < mProcessors.size(); ++i)
-   {
-      mProcessors[i]->Update(currentFrameTime);
-   }
-
-   if (MultiThreaded())
-   {
-      GetMultiThreadManager().UpdateSensors(currentFrameTime);
-   }
-   else
-   {
-      for (i = 0; i < mSensors.size(); ++i)
-      {
-         mSensors[i]->Update(currentFrameTime);
-      }
-   }
+   bool deadlineScheduling = mIsRealTime && mFrameStepInput->mDeadlineScheduling;
+   UpdateSubsystems(currentFrameTime, deadlineScheduling);
+   double postSensorStartTime = deadlineScheduling ? GetWallClock() : 0.0;
 
    AdvanceFrameObjects(currentFrameTime);
 
@@ -197,6 +189,10 @@ double WsfFrameStepSimulation::AdvanceFrame()
    double clockTime = mClockSourcePtr->GetClock(1.0E+37);
    mRealTime        = currentFrameTime;
    double timeLeft  = 0.0;
+   if (deadlineScheduling)
+   {
+      SmoothCost(mPostSensorCost, clockTime - postSensorStartTime);
+   }
    if (mIsRealTime)
    {
       timeLeft  = mNextFrameTime - clockTime;
@@ -251,6 +247,138 @@ double WsfFrameStepSimulation::AdvanceFrame()
    return currentFrameTime;
 }
 
+// =================================================================================================
+//! Update the comms, processors and sensors for the current frame.
+//! @param aCurrentFrameTime  The time of the current frame.
+//! @param aDeadlineScheduling 'true' if sensor updates are to be deferred when they are not predicted to complete
+//!                           before the end of the frame.
+// protected
+void WsfFrameStepSimulation::UpdateSubsystems(double aCurrentFrameTime, bool aDeadlineScheduling)
+{
+   for (wsf::comm::Comm* commPtr : mComms)
+   {
+      commPtr->Update(aCurrentFrameTime);
+   }
+   for (WsfProcessor* processorPtr : mProcessors)
+   {
+      processorPtr->Update(aCurrentFrameTime);
+   }
+   if (aDeadlineScheduling)
+   {
+      DeferSensorUpdates(aCurrentFrameTime);
+   }
+   UpdateSensors(aCurrentFrameTime, aDeadlineScheduling);
+}
+
+// =================================================================================================
+//! Update the sensors for the current frame.
+//! @param aCurrentFrameTime   The time of the current frame.
+//! @param aDeadlineScheduling 'true' if the cost of the sensor updates is to be recorded.
+// protected
+void WsfFrameStepSimulation::UpdateSensors(double aCurrentFrameTime, bool aDeadlineScheduling)
+{
+   if (MultiThreaded())
+   {
+      double startTime = aDeadlineScheduling ? GetWallClock() : 0.0;
+      GetMultiThreadManager().UpdateSensors(aCurrentFrameTime);
+      if (aDeadlineScheduling && (!mDueSensors.empty()))
+      {
+         SmoothCost(mSensorUpdateCost, (GetWallClock() - startTime) / mDueSensors.size());
+      }
+   }
+   else
+   {
+      for (WsfSensor* sensorPtr : mSensors)
+      {
+         // Only the cost of updates that are due is recorded. Updates that are not due (including those that
+         // have just been deferred) typically return without doing anything.
+         if (aDeadlineScheduling && (sensorPtr->GetNextUpdateTime() <= (aCurrentFrameTime + 1.0E-5)))
+         {
+            double startTime = GetWallClock();
+            sensorPtr->Update(aCurrentFrameTime);
+            SmoothCost(mSensorHistory[sensorPtr].mCost, GetWallClock() - startTime);
+         }
+         else
+         {
+            sensorPtr->Update(aCurrentFrameTime);
+         }
+      }
+   }
+}
+
+// =================================================================================================
+//! Select the sensors to be updated in the current frame and defer the remainder to the next frame.
+//!
+//! The sensors that are due for an update are considered in order of priority: sensors that were deferred
+//! in the previous frame first, and then in order of the time their update was due. Each sensor is selected
+//! if its predicted cost (from its update history) fits in the time remaining before the end of the frame,
+//! less the deadline margin and the predicted cost of the work that follows the sensor updates. A sensor
+//! that was deferred in the previous frame is always selected, so no sensor is deferred for more than one
+//! frame. The selected sensors are left in mDueSensors.
+// protected
+void WsfFrameStepSimulation::DeferSensorUpdates(double aCurrentFrameTime)
+{
+   // The history of each due sensor is created here (if it does not exist) so the sort does not modify the map.
+   mDueSensors.clear();
+   for (WsfSensor* sensorPtr : mSensors)
+   {
+      if (sensorPtr->GetNextUpdateTime() <= (aCurrentFrameTime + 1.0E-5))
+      {
+         mDueSensors.push_back(sensorPtr);
+         mSensorHistory.emplace(sensorPtr, SensorHistory());
+      }
+   }
+   std::stable_sort(mDueSensors.begin(),
+                    mDueSensors.end(),
+                    [this](WsfSensor* aLhsPtr, WsfSensor* aRhsPtr)
+                    {
+                       bool lhsDeferred = mSensorHistory.at(aLhsPtr).mDeferred;
+                       bool rhsDeferred = mSensorHistory.at(aRhsPtr).mDeferred;
+                       if (lhsDeferred != rhsDeferred)
+                       {
+                          return lhsDeferred;
+                       }
+                       return aLhsPtr->GetNextUpdateTime() < aRhsPtr->GetNextUpdateTime();
+                    });
+
+   double timeAvailable = mNextFrameTime - GetWallClock() - mFrameStepInput->mDeadlineMargin - mPostSensorCost;
+   size_t selectedCount = 0;
+   for (WsfSensor* sensorPtr : mDueSensors)
+   {
+      SensorHistory& history = mSensorHistory.at(sensorPtr);
+      double         cost    = MultiThreaded() ? mSensorUpdateCost : history.mCost;
+      if (history.mDeferred || (cost <= timeAvailable))
+      {
+         timeAvailable -= cost;
+         history.mDeferred           = false;
+         mDueSensors[selectedCount++] = sensorPtr;
+      }
+      else
+      {
+         sensorPtr->AdjustNextUpdateTime(mNextFrameTime);
+         history.mDeferred = true;
+         mDeferredSensorCount += 1.0;
+      }
+   }
+   mDueSensors.resize(selectedCount);
+}
+
+// =================================================================================================
+//! Return the current value of the real-time clock.
+// protected
+double WsfFrameStepSimulation::GetWallClock() const
+{
+   return mClockSourcePtr->GetClock(1.0E+37);
+}
+
+// =================================================================================================
+//! Update a smoothed cost with the latest measurement.
+// protected
+void WsfFrameStepSimulation::SmoothCost(double& aAverageCost, double aCost) const
+{
+   aAverageCost += cCOST_SMOOTHING_FACTOR * (aCost - aAverageCost);
+}
+
 // =================================================================================================
 // virtual
 double WsfFrameStepSimulation::AdvanceTime()
@@ -368,6 +496,7 @@ void WsfFrameStepSimulation::DeletePlatform(double aSimTime, WsfPlatform* aPlatf
    for (WsfComponentList::RoleIterator<WsfSensor> iter(*aPlatformPtr); !iter.AtEnd(); ++iter)
    {
       Erase(mSensors, *iter);
+      mSensorHistory.erase(*iter);
    }
 
    // Now let the base class delete the platform.
@@ -404,6 +533,11 @@ void WsfFrameStepSimulation::Initialize()
    mTotalFrameOverCount  = 0.0;
    mSkippedFrameCount    = 0.0;
    mWorstFrameOverTime   = 0.0;
+   mDeferredSensorCount  = 0.0;
+   mSensorHistory.clear();
+   mDueSensors.clear();
+   mSensorUpdateCost = 0.0;
+   mPostSensorCost   = 0.0;
 
    if (MultiThreaded())
    {
@@ -431,6 +565,7 @@ void WsfFrameStepSimulation::Start()
    mTotalFrameOverCount  = 0.0;
    mSkippedFrameCount    = 0.0;
    mWorstFrameOverTime   = 0.0;
+   mDeferredSensorCount  = 0.0;
 }
 
 // =================================================================================================
@@ -459,6 +594,10 @@ void WsfFrameStepSimulation::Complete(double aSimTime)
          out.AddNote() << "# Frames Skipped: " << mSkippedFrameCount;
          out.AddNote() << "Worst Frame Over: " << mWorstFrameOverTime;
       }
+      if (mDeferredSensorCount > 0.0)
+      {
+         out.AddNote() << "# Sensor Updates Deferred: " << mDeferredSensorCount;
+      }
    }
 }
 
@@ -478,6 +617,7 @@ bool WsfFrameStepSimulation::TurnPartOffP(double aSimTime, WsfPlatformPart* aPar
          break;
       case cCOMPONENT_ROLE<WsfSensor>():
          Erase(mSensors, static_cast<WsfSensor*>(aPartPtr));
+         mSensorHistory.erase(static_cast<WsfSensor*>(aPartPtr));
          if (MultiThreaded())
          {
             GetMultiThreadManager().TurnSensorOff(aSimTime, static_cast<WsfSensor*>(aPartPtr));
@@ -558,29 +698,18 @@ void WsfFrameStepSimulation::WaitForAdvanceTime()
 {
    if (!mClockSourcePtr->IsStopped())
    {
-      double clockTime = mClockSourcePtr->GetClock(mNextFrameTime);
-      double sleepTime = mNextFrameTime - clockTime;
-      if (sleepTime > 0.0)
+      // Sleep until the wall clock time at which the next frame starts. The processor is relinquished for the
+      // entire wait rather than spinning on the clock for the end of it. The loop handles early wakeups.
+      double clockRate = mClockSourcePtr->GetClockRate();
+      double sleepTime = mNextFrameTime - mClockSourcePtr->GetClock(mNextFrameTime);
+      while ((sleepTime > 0.0) && (!mClockSourcePtr->IsStopped()))
       {
-         // The following logic provides better timing when running on a system that
-         // isn't really set up for 'real-time'.  In Windows, relinquishing the CPU
-         // means that you may not get it back EXACTLY when you want to (it may give
-         // control to a higher priority thread and it may not give it back in time).
-         //
-         // So, what we do is sleep for all but the last 4 ms and then burn up the
-         // remainder in a loop.  This isn't very elegant and is a waste of CPU but it
-         // gives better results on a machine that may not be dedicated to real-time work.
-
-         if (sleepTime > 0.004)
-         {
-            sleepTime -= 0.004;
-            UtSleep::Sleep(sleepTime);
-         }
-
-         // Burn off any residual time by using the CPU.
-         while (mClockSourcePtr->GetClock(mNextFrameTime) < mNextFrameTime)
-         {
-         }
+         double wallSleepTime = (clockRate > 0.0) ? (sleepTime / clockRate) : sleepTime;
+         auto   deadline      = std::chrono::steady_clock::now() +
+                         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(wallSleepTime));
+         std::this_thread::sleep_until(deadline);
+         sleepTime = mNextFrameTime - mClockSourcePtr->GetClock(mNextFrameTime);
       }
       mRealTime = mNextFrameTime;
    }
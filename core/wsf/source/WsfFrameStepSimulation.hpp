@@ -14,6 +14,9 @@
 
 #include "wsf_export.h"
 
+#include <unordered_map>
+#include <vector>
+
 #include "UtCallback.hpp"
 class WsfFrameStepSimulationInput;
 #include "WsfSimulation.hpp"
@@ -63,6 +66,16 @@ protected:
 
    void CreateClock() override;
 
+   void UpdateSubsystems(double aCurrentFrameTime, bool aDeadlineScheduling);
+
+   void UpdateSensors(double aCurrentFrameTime, bool aDeadlineScheduling);
+
+   void DeferSensorUpdates(double aCurrentFrameTime);
+
+   double GetWallClock() const;
+
+   void SmoothCost(double& aAverageCost, double aCost) const;
+
 
    bool TurnPartOffP(double aSimTime, WsfPlatformPart* aPartPtr) override;
 
@@ -87,6 +100,25 @@ protected:
    double mTotalFrameOverCount;
    double mSkippedFrameCount;
    double mWorstFrameOverTime;
+   double mDeferredSensorCount;
+
+   //! The update history of a sensor, as used by deadline scheduling.
+   struct SensorHistory
+   {
+      //! The smoothed wall clock time of an update (seconds).
+      double mCost = 0.0;
+      //! 'true' if the last update of the sensor was deferred to the next frame.
+      bool mDeferred = false;
+   };
+
+   //! The update history of each sensor (deadline scheduling only).
+   std::unordered_map<WsfSensor*, SensorHistory> mSensorHistory;
+   //! The sensors selected for update in the current frame (deadline scheduling only).
+   std::vector<WsfSensor*> mDueSensors;
+   //! The smoothed wall clock time per sensor of the multi-threaded sensor updates (seconds).
+   double mSensorUpdateCost;
+   //! The smoothed wall clock time of the frame objects and events that follow the sensor updates (seconds).
+   double mPostSensorCost;
 
    std::vector<WsfPlatform*>     mPlatforms;
    std::vector<wsf::comm::Comm*> mComms;
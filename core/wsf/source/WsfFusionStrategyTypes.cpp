@@ -101,6 +101,15 @@ bool WsfFusionStrategyTypes::ProcessInput(UtInput& aInput)
    return processed;
 }
 
+// =================================================================================================
+bool WsfFusionStrategyTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("default_fusion_strategy");
+   aKeywords.push_back("check_fuse_estimates");
+   aKeywords.push_back(GetBlockName());
+   return true;
+}
+
 // =================================================================================================
 //! (Factory Method) Create a new instance of a strategy with the given name.
 //! @param aName The name of the desired strategy.
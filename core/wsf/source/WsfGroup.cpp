@@ -47,6 +47,7 @@ void WsfGroup::JoinGroup(size_t aPlatformIndex, unsigned int aPlatformPartId /*=
    if (!IsGroupMember(aPlatformIndex, aPlatformPartId))
    {
       mMembers.emplace_back(aPlatformIndex, aPlatformPartId);
+      ++mChangeCount;
    }
 }
 
@@ -58,6 +59,7 @@ void WsfGroup::LeaveGroup(size_t aPlatformIndex, unsigned int aPlatformPartId /*
    if (it != mMembers.end())
    {
       mMembers.erase(it);
+      ++mChangeCount;
    }
 }
 
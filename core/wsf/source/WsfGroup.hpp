@@ -56,13 +56,18 @@ public:
    MemberList&       GetMembers() { return mMembers; }
    const MemberList& GetMembers() const { return mMembers; }
 
+   //! Return a count that is incremented whenever a member joins or leaves the group.
+   //! Users that cache information derived from the members may compare it to detect a change.
+   unsigned int GetChangeCount() const { return mChangeCount; }
+
    bool ProcessInput(UtInput& aInput) override;
 
 protected:
    WsfGroup(const WsfGroup& aSrc) = default;
 
 private:
-   MemberList mMembers; //!< <platform index, platform part id> platform part id is 0 if it is a platform
+   MemberList   mMembers; //!< <platform index, platform part id> platform part id is 0 if it is a platform
+   unsigned int mChangeCount{0};
 };
 
 #endif
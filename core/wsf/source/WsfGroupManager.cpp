@@ -52,6 +52,7 @@ bool WsfGroupManager::AddGroup(WsfGroup* aNewGroupPtr)
       if (GetGroup(aNewGroupPtr->GetName()) == nullptr)
       {
          mGroups[aNewGroupPtr->GetName()] = aNewGroupPtr;
+         ++mChangeCount;
          return true;
       }
    }
@@ -46,6 +46,10 @@ public:
 
    GroupMap& GetGroups() { return mGroups; }
 
+   //! Return a count that is incremented whenever a group is added.
+   //! Changes to the members of a group are reported by WsfGroup::GetChangeCount.
+   unsigned int GetChangeCount() const { return mChangeCount; }
+
    bool LoadInstance(const std::string& aGroupName, WsfPlatformPart* aPlatformPartPtr);
    bool LoadInstance(const std::string& aGroupName, WsfPlatform* aPlatformPtr);
 
@@ -54,6 +58,7 @@ private:
 
    WsfSimulation* mSimPtr{nullptr};
    GroupMap       mGroups;
+   unsigned int   mChangeCount{0};
 };
 
 #endif
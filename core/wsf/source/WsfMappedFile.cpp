@@ -0,0 +1,127 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfMappedFile.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// =================================================================================================
+WsfMappedFile::WsfMappedFile()
+   : mDataPtr(nullptr)
+   , mDataSize(0)
+#if defined(_WIN32)
+   , mFileHandle(INVALID_HANDLE_VALUE)
+   , mMappingHandle(nullptr)
+#endif
+{
+}
+
+// =================================================================================================
+WsfMappedFile::~WsfMappedFile()
+{
+   Close();
+}
+
+// =================================================================================================
+//! Map the specified file into memory (read-only), closing any file that is currently mapped.
+//! @returns 'true' if successful or 'false' if the file could not be mapped or is empty.
+bool WsfMappedFile::Open(const std::string& aFileName)
+{
+   Close();
+#if defined(_WIN32)
+   mFileHandle = CreateFileA(aFileName.c_str(),
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             nullptr,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+   if (mFileHandle == INVALID_HANDLE_VALUE)
+   {
+      return false;
+   }
+   LARGE_INTEGER fileSize;
+   if ((!GetFileSizeEx(mFileHandle, &fileSize)) || (fileSize.QuadPart == 0))
+   {
+      Close();
+      return false;
+   }
+   mMappingHandle = CreateFileMappingA(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   if (mMappingHandle == nullptr)
+   {
+      Close();
+      return false;
+   }
+   mDataPtr = static_cast<const char*>(MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+   if (mDataPtr == nullptr)
+   {
+      Close();
+      return false;
+   }
+   mDataSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+   int fd = open(aFileName.c_str(), O_RDONLY);
+   if (fd < 0)
+   {
+      return false;
+   }
+   struct stat fileStat;
+   if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size == 0))
+   {
+      close(fd);
+      return false;
+   }
+   // The mapping remains valid after the file descriptor is closed, so a descriptor is not held.
+   void* dataPtr = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (dataPtr == MAP_FAILED)
+   {
+      return false;
+   }
+   mDataPtr  = static_cast<const char*>(dataPtr);
+   mDataSize = static_cast<size_t>(fileStat.st_size);
+#endif
+   return true;
+}
+
+// =================================================================================================
+//! Unmap the file (if any).
+void WsfMappedFile::Close()
+{
+#if defined(_WIN32)
+   if (mDataPtr != nullptr)
+   {
+      UnmapViewOfFile(mDataPtr);
+   }
+   if (mMappingHandle != nullptr)
+   {
+      CloseHandle(mMappingHandle);
+   }
+   if (mFileHandle != INVALID_HANDLE_VALUE)
+   {
+      CloseHandle(mFileHandle);
+   }
+   mMappingHandle = nullptr;
+   mFileHandle    = INVALID_HANDLE_VALUE;
+#else
+   if (mDataPtr != nullptr)
+   {
+      munmap(const_cast<char*>(mDataPtr), mDataSize);
+   }
+#endif
+   mDataPtr  = nullptr;
+   mDataSize = 0;
+}
@@ -0,0 +1,44 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFMAPPEDFILE_HPP
+#define WSFMAPPEDFILE_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <string>
+
+//! A file that is mapped read-only into memory.
+//! The contents are accessed in place, so large binary files may be used without reading or parsing them.
+class WSF_EXPORT WsfMappedFile
+{
+public:
+   WsfMappedFile();
+   ~WsfMappedFile();
+   WsfMappedFile(const WsfMappedFile& aSrc) = delete;
+   WsfMappedFile& operator=(const WsfMappedFile& aRhs) = delete;
+
+   bool Open(const std::string& aFileName);
+   void Close();
+
+   bool        IsOpen() const { return mDataPtr != nullptr; }
+   const char* GetData() const { return mDataPtr; }
+   size_t      GetSize() const { return mDataSize; }
+
+private:
+   const char* mDataPtr;
+   size_t      mDataSize;
+#if defined(_WIN32)
+   void* mFileHandle;
+   void* mMappingHandle;
+#endif
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 class UtInput;
@@ -45,6 +46,13 @@ public:
    virtual bool ProcessInput(UtInput& aInput) = 0;
    virtual void CompleteLoad() {}
 
+   //! Append the top-level commands that ProcessInput may accept.
+   //! The scenario dispatches these commands directly to the type list. The list must include every command
+   //! ProcessInput may accept, so only type lists whose input has been audited override this.
+   //! @returns false if the commands cannot be enumerated, in which case ProcessInput is tried for every command
+   //! that is not owned by a registered keyword.
+   virtual bool GetInputKeywords(std::vector<std::string>& aKeywords) const { return false; }
+
    virtual WsfObject*         Clone(WsfStringId aId) const             = 0;
    virtual WsfObject*         Find(WsfStringId aId) const              = 0;
    virtual const std::string& GetBlockName() const                     = 0;
@@ -68,6 +76,11 @@ public:
 
    bool ProcessInput(UtInput& aInput) override { return mActualTypeListPtr->ProcessInput(aInput); }
 
+   bool GetInputKeywords(std::vector<std::string>& aKeywords) const override
+   {
+      return mActualTypeListPtr->GetInputKeywords(aKeywords);
+   }
+
    void CompleteLoad() override { return mActualTypeListPtr->CompleteLoad(); }
 
    T* Clone(WsfStringId aId) const override { return (T*)mActualTypeListPtr->Clone(aId); }
@@ -899,8 +899,9 @@ void WsfPlatform::OnBrokenEvent(double aSimTime)
 // =================================================================================================
 //! Some other platform has been added to the simulation.
 //!
-//! This method is called by WsfSimulation whenever another platform has been added to the simulation.
-//! This platform can then take whatever action it deems necessary.
+//! This method is called by WsfSimulation whenever another platform in which this platform is interested has been
+//! added to the simulation (see WsfPlatformInterestRegistry). This platform can then take whatever action it deems
+//! necessary.
 //!
 //! @param aSimTime     The current simulation time.
 //! @param aPlatformPtr Pointer to the platform being added.
@@ -927,8 +928,9 @@ void WsfPlatform::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 // =================================================================================================
 //! Some other platform has been deleted from the simulation.
 //!
-//! WsfSimulation invokes this method whenever another platform has been deleted from the simulation.
-//! This platform can then take whatever action it deems necessary.
+//! WsfSimulation invokes this method whenever another platform in which this platform is interested has been deleted
+//! from the simulation (see WsfPlatformInterestRegistry). This platform can then take whatever action it deems
+//! necessary.
 //!
 //! @param aPlatformPtr Pointer to the platform being deleted.
 // virtual
@@ -1106,6 +1108,10 @@ WsfArticulatedPart* WsfPlatform::GetArticulatedPart(unsigned int aUniqueId) cons
 void WsfPlatform::ComponentAdded(WsfComponent* aComponentPtr)
 {
    UpdatePersistentPointers(aComponentPtr, true);
+   if (mSimulationPtr != nullptr)
+   {
+      mSimulationPtr->PlatformInterestChanged(*this);
+   }
 }
 
 // =================================================================================================
@@ -1114,6 +1120,12 @@ void WsfPlatform::ComponentAdded(WsfComponent* aComponentPtr)
 void WsfPlatform::ComponentDeleted(WsfComponent* aComponentPtr)
 {
    UpdatePersistentPointers(aComponentPtr, false);
+   // The component is still on the list, so its interests are kept until the next change.
+   // At worst this causes the platform to be told about platforms in which it is no longer interested.
+   if (mSimulationPtr != nullptr)
+   {
+      mSimulationPtr->PlatformInterestChanged(*this);
+   }
 }
 
 // =================================================================================================
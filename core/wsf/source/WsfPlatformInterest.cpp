@@ -0,0 +1,490 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfPlatformInterest.hpp"
+
+#include <algorithm>
+#include <typeinfo>
+
+#include "UtLog.hpp"
+#include "WsfCommandChain.hpp"
+#include "WsfPlatform.hpp"
+#include "WsfPlatformPart.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+template<typename KEY>
+void InsertIndex(std::map<KEY, std::vector<size_t>>& aIndex, const KEY& aKey, size_t aPlatformIndex)
+{
+   aIndex[aKey].push_back(aPlatformIndex);
+}
+
+template<typename KEY>
+void EraseIndex(std::map<KEY, std::vector<size_t>>& aIndex, const KEY& aKey, size_t aPlatformIndex)
+{
+   auto iter = aIndex.find(aKey);
+   if (iter != aIndex.end())
+   {
+      std::vector<size_t>& indices = iter->second;
+      indices.erase(std::remove(indices.begin(), indices.end(), aPlatformIndex), indices.end());
+      if (indices.empty())
+      {
+         aIndex.erase(iter);
+      }
+   }
+}
+
+template<typename KEY>
+void AppendIndex(const std::map<KEY, std::vector<size_t>>& aIndex, const KEY& aKey, std::vector<size_t>& aIndices)
+{
+   auto iter = aIndex.find(aKey);
+   if (iter != aIndex.end())
+   {
+      aIndices.insert(aIndices.end(), iter->second.begin(), iter->second.end());
+   }
+}
+
+void AppendPlatform(const WsfPlatform* aPlatformPtr, std::vector<size_t>& aIndices)
+{
+   if (aPlatformPtr != nullptr)
+   {
+      aIndices.push_back(aPlatformPtr->GetIndex());
+   }
+}
+} // namespace
+
+// =================================================================================================
+//! Request the addition and deletion of the platform with the specified name.
+void WsfPlatformInterest::AddPlatformName(WsfStringId aNameId)
+{
+   if ((!aNameId.IsNull()) && (std::find(mNames.begin(), mNames.end(), aNameId) == mNames.end()))
+   {
+      mNames.push_back(aNameId);
+   }
+}
+
+// =================================================================================================
+//! Request the addition and deletion of the platforms that are members of the specified category.
+void WsfPlatformInterest::AddCategory(WsfStringId aCategoryId)
+{
+   if ((!aCategoryId.IsNull()) && (std::find(mCategories.begin(), mCategories.end(), aCategoryId) == mCategories.end()))
+   {
+      mCategories.push_back(aCategoryId);
+   }
+}
+
+// =================================================================================================
+//! Add the platforms requested by another interest.
+void WsfPlatformInterest::Add(const WsfPlatformInterest& aInterest)
+{
+   mAllAdded   = mAllAdded || aInterest.mAllAdded;
+   mAllDeleted = mAllDeleted || aInterest.mAllDeleted;
+   for (WsfStringId nameId : aInterest.mNames)
+   {
+      AddPlatformName(nameId);
+   }
+   for (WsfStringId categoryId : aInterest.mCategories)
+   {
+      AddCategory(categoryId);
+   }
+}
+
+// =================================================================================================
+//! Return 'true' if the interest includes the specified platform.
+//! @param aPlatform The platform being added or deleted.
+//! @param aIsAdded  'true' if the platform is being added or 'false' if it is being deleted.
+bool WsfPlatformInterest::Includes(const WsfPlatform& aPlatform, bool aIsAdded) const
+{
+   if (aIsAdded ? mAllAdded : mAllDeleted)
+   {
+      return true;
+   }
+   if (std::find(mNames.begin(), mNames.end(), aPlatform.GetNameId()) != mNames.end())
+   {
+      return true;
+   }
+   for (WsfStringId categoryId : mCategories)
+   {
+      if (aPlatform.IsCategoryMember(categoryId))
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Return 'true' if the interest includes no platform being added (or deleted).
+//! @param aIsAdded 'true' to test the platforms being added or 'false' to test the platforms being deleted.
+bool WsfPlatformInterest::IsEmpty(bool aIsAdded) const
+{
+   return (!(aIsAdded ? mAllAdded : mAllDeleted)) && mNames.empty() && mCategories.empty();
+}
+
+// =================================================================================================
+WsfPlatformInterestRegistry::WsfPlatformInterestRegistry(WsfSimulation* aSimulationPtr)
+   : mSimulationPtr(aSimulationPtr)
+   , mEntries()
+   , mAllAdded()
+   , mAllDeleted()
+   , mByName()
+   , mByCategory()
+   , mByChain()
+   , mGeneration(0)
+   , mProbes()
+   , mProbedTypes()
+{
+}
+
+// =================================================================================================
+//! Gather the interests of the parts and command chains of a platform that is in the simulation.
+//! If the platform is already registered its interests are replaced.
+void WsfPlatformInterestRegistry::Register(WsfPlatform& aPlatform)
+{
+   Unregister(aPlatform);
+
+   size_t platformIndex = aPlatform.GetIndex();
+   Entry& entry         = mEntries[platformIndex];
+   for (WsfComponentList::RoleIterator<WsfPlatformPart> iter(aPlatform); !iter.AtEnd(); ++iter)
+   {
+      WsfPlatformInterest partInterest;
+      iter->AddPlatformInterest(partInterest);
+      AddProbe(platformIndex, **iter, partInterest, true);
+      AddProbe(platformIndex, **iter, partInterest, false);
+      entry.mInterest.Add(partInterest);
+   }
+   for (WsfComponentList::RoleIterator<WsfCommandChain> iter(aPlatform); !iter.AtEnd(); ++iter)
+   {
+      entry.mChains.emplace_back(iter->GetNameId(), iter->GetCommanderNameId());
+   }
+
+   if (entry.mInterest.IsAllAdded())
+   {
+      mAllAdded.insert(platformIndex);
+   }
+   if (entry.mInterest.IsAllDeleted())
+   {
+      mAllDeleted.insert(platformIndex);
+   }
+   for (WsfStringId nameId : entry.mInterest.GetPlatformNames())
+   {
+      InsertIndex(mByName, nameId, platformIndex);
+   }
+   for (WsfStringId categoryId : entry.mInterest.GetCategories())
+   {
+      InsertIndex(mByCategory, categoryId, platformIndex);
+   }
+   for (const ChainKey& chain : entry.mChains)
+   {
+      InsertIndex(mByChain, chain, platformIndex);
+   }
+   ++mGeneration;
+}
+
+// =================================================================================================
+//! Remove the interests of a platform.
+void WsfPlatformInterestRegistry::Unregister(const WsfPlatform& aPlatform)
+{
+   size_t platformIndex = aPlatform.GetIndex();
+   auto isPlatformProbe = [platformIndex](const Probe& aProbe) { return aProbe.mPlatformIndex == platformIndex; };
+   mProbes.erase(std::remove_if(mProbes.begin(), mProbes.end(), isPlatformProbe), mProbes.end());
+
+   auto iter = mEntries.find(platformIndex);
+   if (iter != mEntries.end())
+   {
+      const Entry& entry = iter->second;
+      mAllAdded.erase(platformIndex);
+      mAllDeleted.erase(platformIndex);
+      for (WsfStringId nameId : entry.mInterest.GetPlatformNames())
+      {
+         EraseIndex(mByName, nameId, platformIndex);
+      }
+      for (WsfStringId categoryId : entry.mInterest.GetCategories())
+      {
+         EraseIndex(mByCategory, categoryId, platformIndex);
+      }
+      for (const ChainKey& chain : entry.mChains)
+      {
+         EraseIndex(mByChain, chain, platformIndex);
+      }
+      mEntries.erase(iter);
+   }
+}
+
+// =================================================================================================
+void WsfPlatformInterestRegistry::Clear()
+{
+   mEntries.clear();
+   mAllAdded.clear();
+   mAllDeleted.clear();
+   mByName.clear();
+   mByCategory.clear();
+   mByChain.clear();
+   mProbes.clear();
+   mProbedTypes.clear();
+   ++mGeneration;
+}
+
+// =================================================================================================
+bool WsfPlatformInterestRegistry::IsRegistered(const WsfPlatform& aPlatform) const
+{
+   return mEntries.find(aPlatform.GetIndex()) != mEntries.end();
+}
+
+// =================================================================================================
+//! Return 'true' if a platform must be told about the addition or deletion of another platform.
+//! A platform that is not registered is assumed to be interested in every platform.
+//! @param aPlatform      The platform that may be interested.
+//! @param aOtherPlatform The platform being added or deleted.
+//! @param aIsAdded       'true' if the other platform is being added or 'false' if it is being deleted.
+bool WsfPlatformInterestRegistry::IsInterested(const WsfPlatform& aPlatform,
+                                               const WsfPlatform& aOtherPlatform,
+                                               bool               aIsAdded) const
+{
+   auto iter = mEntries.find(aPlatform.GetIndex());
+   if ((iter == mEntries.end()) || iter->second.mInterest.Includes(aOtherPlatform, aIsAdded))
+   {
+      return true;
+   }
+
+   // Command chains are interested in their commander, peers and subordinates. The current chains are used rather
+   // than the registered ones, as the commander may have changed during the current introduction.
+   for (WsfComponentList::RoleIterator<WsfCommandChain> chainIter(aPlatform); !chainIter.AtEnd(); ++chainIter)
+   {
+      WsfStringId commanderNameId = chainIter->GetCommanderNameId();
+      if (aOtherPlatform.GetNameId() == commanderNameId)
+      {
+         return true;
+      }
+      auto otherChainPtr = aOtherPlatform.GetComponent<WsfCommandChain>(chainIter->GetNameId());
+      if ((otherChainPtr != nullptr) && ((otherChainPtr->GetCommanderNameId() == aPlatform.GetNameId()) ||
+                                         (otherChainPtr->GetCommanderNameId() == commanderNameId)))
+      {
+         return true;
+      }
+      if (!aIsAdded)
+      {
+         const WsfCommandChain::PlatformList& peers        = chainIter->GetPeers();
+         const WsfCommandChain::PlatformList& subordinates = chainIter->GetSubordinates();
+         if ((chainIter->GetCommander() == &aOtherPlatform) ||
+             (std::find(peers.begin(), peers.end(), &aOtherPlatform) != peers.end()) ||
+             (std::find(subordinates.begin(), subordinates.end(), &aOtherPlatform) != subordinates.end()))
+         {
+            return true;
+         }
+      }
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Find the platforms that must be introduced to a new platform.
+//! These are the platforms in which the new platform is interested and the platforms that are interested in it.
+//! @param aPlatform   The new platform.
+//! @param aAfterIndex Only platforms with an index greater than this are returned.
+//! @param aPlatforms  [output] The platforms, in platform list order. This may include platforms in which neither
+//!                    is interested, so the caller must check each with IsInterested.
+void WsfPlatformInterestRegistry::FindIntroductions(const WsfPlatform&         aPlatform,
+                                                    size_t                     aAfterIndex,
+                                                    std::vector<WsfPlatform*>& aPlatforms) const
+{
+   IndexList indices;
+   auto      iter = mEntries.find(aPlatform.GetIndex());
+   if ((iter == mEntries.end()) || iter->second.mInterest.IsAllAdded() ||
+       (!iter->second.mInterest.GetCategories().empty()))
+   {
+      // Categories are not indexed, so a platform interested in a category must consider every platform.
+      for (size_t i = 0; i < mSimulationPtr->GetPlatformCount(); ++i)
+      {
+         indices.push_back(mSimulationPtr->GetPlatformEntry(i)->GetIndex());
+      }
+   }
+   else
+   {
+      for (WsfStringId nameId : iter->second.mInterest.GetPlatformNames())
+      {
+         AddByName(nameId, indices);
+      }
+   }
+   AddInterested(aPlatform, true, indices);
+   GetPlatforms(aAfterIndex, indices, aPlatforms);
+}
+
+// =================================================================================================
+//! Find the platforms that must be told about the deletion of a platform.
+//! @param aPlatform  The platform being deleted. It is included if it is still in the platform list.
+//! @param aPlatforms [output] The platforms, in platform list order. This may include platforms that are not
+//!                   interested, so the caller must check each with IsInterested.
+void WsfPlatformInterestRegistry::FindInterestedInDeletion(const WsfPlatform&         aPlatform,
+                                                           std::vector<WsfPlatform*>& aPlatforms) const
+{
+   IndexList indices(1, aPlatform.GetIndex());
+   AddInterested(aPlatform, false, indices);
+   GetPlatforms(0, indices, aPlatforms);
+}
+
+// =================================================================================================
+//! Check the parts that declared no interest in other platforms for overrides of PlatformAdded or PlatformDeleted.
+//!
+//! Such a part is never told about other platforms, which is almost certainly an error. Each part that is waiting to
+//! be checked is told once about a platform being added (or deleted) that its own platform was not told about. If the
+//! part handles it rather than reaching the default WsfPlatformPart implementation, a warning is written. Each type of
+//! part is checked only once.
+//!
+//! @param aSimTime  The current simulation time.
+//! @param aPlatform The platform being added or deleted. Its introductions or deletion notices have been made.
+//! @param aIsAdded  'true' if the platform is being added or 'false' if it is being deleted.
+void WsfPlatformInterestRegistry::ProbeParts(double aSimTime, WsfPlatform& aPlatform, bool aIsAdded)
+{
+   // The probes are removed before any part is told, as a part may change the interests of its platform.
+   std::vector<Probe> probes;
+   std::vector<Probe> remainingProbes;
+   for (const Probe& probe : mProbes)
+   {
+      bool ready = (probe.mIsAdded == aIsAdded) && (probe.mPlatformIndex != aPlatform.GetIndex());
+      (ready ? probes : remainingProbes).push_back(probe);
+   }
+   mProbes.swap(remainingProbes);
+
+   for (const Probe& probe : probes)
+   {
+      WsfPlatform* platformPtr = mSimulationPtr->GetPlatformByIndex(probe.mPlatformIndex);
+      if ((platformPtr == nullptr) || (!IsPart(*platformPtr, probe.mPartPtr)) ||
+          IsInterested(*platformPtr, aPlatform, aIsAdded))
+      {
+         // The part is gone, or its platform was told because of the interests of its other components.
+         continue;
+      }
+      if (!mProbedTypes.emplace(std::type_index(typeid(*probe.mPartPtr)), aIsAdded).second)
+      {
+         continue; // Another part of the same type has been checked.
+      }
+      bool overridden = aIsAdded ? probe.mPartPtr->ProbePlatformAdded(aSimTime, &aPlatform) :
+                                   probe.mPartPtr->ProbePlatformDeleted(&aPlatform);
+      if (overridden)
+      {
+         auto out = ut::log::warning() << "Platform part overrides " << (aIsAdded ? "PlatformAdded" : "PlatformDeleted")
+                                       << " but does not declare an interest in other platforms.";
+         out.AddNote() << "Platform: " << platformPtr->GetName();
+         out.AddNote() << "Part: " << probe.mPartPtr->GetName();
+         out.AddNote() << "Type: " << probe.mPartPtr->GetType();
+         out.AddNote() << "The part will not be told about other platforms. It must override AddPlatformInterest.";
+      }
+   }
+}
+
+// =================================================================================================
+//! Add a part to the parts to be checked by ProbeParts if it declared no interest in the addition (or deletion) of
+//! other platforms and its type has not been checked.
+// private
+void WsfPlatformInterestRegistry::AddProbe(size_t                     aPlatformIndex,
+                                           WsfPlatformPart&           aPart,
+                                           const WsfPlatformInterest& aInterest,
+                                           bool                       aIsAdded)
+{
+   if (aInterest.IsEmpty(aIsAdded) && (mProbedTypes.count(ProbedType(std::type_index(typeid(aPart)), aIsAdded)) == 0))
+   {
+      mProbes.push_back(Probe{aPlatformIndex, &aPart, aIsAdded});
+   }
+}
+
+// =================================================================================================
+//! Return 'true' if a part is still a component of a platform.
+// private
+bool WsfPlatformInterestRegistry::IsPart(const WsfPlatform& aPlatform, const WsfPlatformPart* aPartPtr) const
+{
+   for (WsfComponentList::RoleIterator<WsfPlatformPart> iter(aPlatform); !iter.AtEnd(); ++iter)
+   {
+      if (*iter == aPartPtr)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Add the indices of the registered platforms that may be interested in the addition or deletion of a platform.
+// private
+void WsfPlatformInterestRegistry::AddInterested(const WsfPlatform& aPlatform, bool aIsAdded, IndexList& aIndices) const
+{
+   const std::set<size_t>& allIndices = aIsAdded ? mAllAdded : mAllDeleted;
+   aIndices.insert(aIndices.end(), allIndices.begin(), allIndices.end());
+   AppendIndex(mByName, aPlatform.GetNameId(), aIndices);
+   for (WsfStringId categoryId : aPlatform.GetCategories().GetCategoryList())
+   {
+      AppendIndex(mByCategory, categoryId, aIndices);
+   }
+   AddRelatedByChain(aPlatform, aIsAdded, aIndices);
+}
+
+// =================================================================================================
+//! Add the indices of the platforms that are related to a platform by a command chain.
+//! The relation is symmetric, so these are both the platforms in which the platform is interested and the platforms
+//! that are interested in it.
+// private
+void WsfPlatformInterestRegistry::AddRelatedByChain(const WsfPlatform& aPlatform,
+                                                    bool               aIsAdded,
+                                                    IndexList&         aIndices) const
+{
+   for (WsfComponentList::RoleIterator<WsfCommandChain> iter(aPlatform); !iter.AtEnd(); ++iter)
+   {
+      WsfStringId chainNameId     = iter->GetNameId();
+      WsfStringId commanderNameId = iter->GetCommanderNameId();
+      AddByName(commanderNameId, aIndices);                                          // The commander
+      AppendIndex(mByChain, ChainKey(chainNameId, commanderNameId), aIndices);       // Peers
+      AppendIndex(mByChain, ChainKey(chainNameId, aPlatform.GetNameId()), aIndices); // Subordinates
+      if (!aIsAdded)
+      {
+         // Also include the platforms the chain has recorded, in case they were related by another name.
+         AppendPlatform(iter->GetCommander(), aIndices);
+         for (const WsfPlatform* peerPtr : iter->GetPeers())
+         {
+            AppendPlatform(peerPtr, aIndices);
+         }
+         for (const WsfPlatform* subordinatePtr : iter->GetSubordinates())
+         {
+            AppendPlatform(subordinatePtr, aIndices);
+         }
+      }
+   }
+}
+
+// =================================================================================================
+//! Add the index of the platform with the specified name, if it is in the simulation.
+// private
+void WsfPlatformInterestRegistry::AddByName(WsfStringId aNameId, IndexList& aIndices) const
+{
+   AppendPlatform(mSimulationPtr->GetPlatformByName(aNameId), aIndices);
+}
+
+// =================================================================================================
+//! Convert a list of platform indices to the platforms in platform list order.
+//! Duplicate indices and the indices of platforms that are no longer in the simulation are ignored.
+// private
+void WsfPlatformInterestRegistry::GetPlatforms(size_t                     aAfterIndex,
+                                               IndexList&                 aIndices,
+                                               std::vector<WsfPlatform*>& aPlatforms) const
+{
+   // Platform indices are assigned in increasing order as platforms are added to the platform list, so sorting by
+   // index preserves the order in which the platforms would be visited by iterating over the list.
+   std::sort(aIndices.begin(), aIndices.end());
+   aIndices.erase(std::unique(aIndices.begin(), aIndices.end()), aIndices.end());
+
+   aPlatforms.clear();
+   for (auto iter = std::upper_bound(aIndices.begin(), aIndices.end(), aAfterIndex); iter != aIndices.end(); ++iter)
+   {
+      WsfPlatform* platformPtr = mSimulationPtr->GetPlatformByIndex(*iter);
+      if (platformPtr != nullptr)
+      {
+         aPlatforms.push_back(platformPtr);
+      }
+   }
+}
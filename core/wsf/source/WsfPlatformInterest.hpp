@@ -0,0 +1,156 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFPLATFORMINTEREST_HPP
+#define WSFPLATFORMINTEREST_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class WsfPlatform;
+class WsfPlatformPart;
+class WsfSimulation;
+#include "WsfStringId.hpp"
+
+//! The other platforms whose addition to and deletion from the simulation a platform component must be told about.
+//!
+//! A platform part declares its interest by overriding WsfPlatformPart::AddPlatformInterest. A part that does not
+//! declare an interest is told about all platforms, but the part base classes in the framework (WsfMover, WsfProcessor,
+//! WsfArticulatedPart, etc.) declare no interest, so a class derived from one of them that overrides PlatformAdded or
+//! PlatformDeleted must declare the platforms it needs. A warning is written the first time such an override is found
+//! (see WsfPlatformInterestRegistry::ProbeParts). Command chains are always told about the platforms to which they are
+//! related (their commander, peers and subordinates).
+class WSF_EXPORT WsfPlatformInterest
+{
+public:
+   //! Request the addition and deletion of all platforms.
+   void AddAllPlatforms()
+   {
+      mAllAdded   = true;
+      mAllDeleted = true;
+   }
+
+   //! Request the deletion (but not the addition) of all platforms.
+   void AddAllDeletedPlatforms() { mAllDeleted = true; }
+
+   void AddPlatformName(WsfStringId aNameId);
+   void AddCategory(WsfStringId aCategoryId);
+   void Add(const WsfPlatformInterest& aInterest);
+
+   bool IsAllAdded() const { return mAllAdded; }
+   bool IsAllDeleted() const { return mAllDeleted; }
+
+   const std::vector<WsfStringId>& GetPlatformNames() const { return mNames; }
+   const std::vector<WsfStringId>& GetCategories() const { return mCategories; }
+
+   bool Includes(const WsfPlatform& aPlatform, bool aIsAdded) const;
+   bool IsEmpty(bool aIsAdded) const;
+
+private:
+   bool                     mAllAdded{false};
+   bool                     mAllDeleted{false};
+   std::vector<WsfStringId> mNames;
+   std::vector<WsfStringId> mCategories;
+};
+
+//! The platform interests of the platforms in a simulation.
+//!
+//! WsfSimulation uses the registry to introduce a new platform only to the platforms that are interested in it (and
+//! vice versa), and to tell only the interested platforms about the deletion of a platform. Platforms are found through
+//! indexes of the interested platforms by platform name, category and command chain, so the cost of adding or deleting
+//! a platform depends on the number of interested platforms rather than the number of platforms in the simulation.
+//!
+//! The interests of a platform are gathered when it is registered. They are gathered again when the components of the
+//! platform change or when a component reports a change through WsfSimulation::PlatformInterestChanged.
+class WSF_EXPORT WsfPlatformInterestRegistry
+{
+public:
+   explicit WsfPlatformInterestRegistry(WsfSimulation* aSimulationPtr);
+
+   void Register(WsfPlatform& aPlatform);
+   void Unregister(const WsfPlatform& aPlatform);
+   void Clear();
+
+   bool IsRegistered(const WsfPlatform& aPlatform) const;
+
+   //! Incremented whenever the interests of a platform change.
+   unsigned int GetGeneration() const { return mGeneration; }
+
+   bool IsInterested(const WsfPlatform& aPlatform, const WsfPlatform& aOtherPlatform, bool aIsAdded) const;
+
+   void FindIntroductions(const WsfPlatform&         aPlatform,
+                          size_t                     aAfterIndex,
+                          std::vector<WsfPlatform*>& aPlatforms) const;
+   void FindInterestedInDeletion(const WsfPlatform& aPlatform, std::vector<WsfPlatform*>& aPlatforms) const;
+
+   void ProbeParts(double aSimTime, WsfPlatform& aPlatform, bool aIsAdded);
+
+private:
+   //! A command chain key: the name of the chain and the name of the commander.
+   using ChainKey = std::pair<WsfStringId, WsfStringId>;
+
+   using IndexList = std::vector<size_t>;
+
+   struct Entry
+   {
+      WsfPlatformInterest   mInterest;
+      std::vector<ChainKey> mChains;
+   };
+
+   //! A part that declared no interest in the addition (or deletion) of other platforms, and which has yet to be
+   //! checked for an override of PlatformAdded (or PlatformDeleted).
+   struct Probe
+   {
+      size_t           mPlatformIndex;
+      WsfPlatformPart* mPartPtr;
+      bool             mIsAdded;
+   };
+
+   //! A type of part and whether it has been checked for an override of PlatformAdded or PlatformDeleted.
+   using ProbedType = std::pair<std::type_index, bool>;
+
+   void AddProbe(size_t aPlatformIndex, WsfPlatformPart& aPart, const WsfPlatformInterest& aInterest, bool aIsAdded);
+   bool IsPart(const WsfPlatform& aPlatform, const WsfPlatformPart* aPartPtr) const;
+
+   void AddInterested(const WsfPlatform& aPlatform, bool aIsAdded, IndexList& aIndices) const;
+   void AddRelatedByChain(const WsfPlatform& aPlatform, bool aIsAdded, IndexList& aIndices) const;
+   void AddByName(WsfStringId aNameId, IndexList& aIndices) const;
+   void GetPlatforms(size_t aAfterIndex, IndexList& aIndices, std::vector<WsfPlatform*>& aPlatforms) const;
+
+   WsfSimulation* mSimulationPtr;
+
+   //! The interests of each registered platform, by platform index.
+   std::unordered_map<size_t, Entry> mEntries;
+
+   //! @name Indexes of the registered platforms by what they are interested in.
+   //@{
+   std::set<size_t>                 mAllAdded;
+   std::set<size_t>                 mAllDeleted;
+   std::map<WsfStringId, IndexList> mByName;
+   std::map<WsfStringId, IndexList> mByCategory;
+   std::map<ChainKey, IndexList>    mByChain;
+   //@}
+
+   unsigned int mGeneration;
+
+   //! The parts yet to be checked for overrides of PlatformAdded and PlatformDeleted (see ProbeParts).
+   std::vector<Probe> mProbes;
+
+   //! The types of parts that have been checked, so each is checked (and reported) only once.
+   std::set<ProbedType> mProbedTypes;
+};
+
+#endif
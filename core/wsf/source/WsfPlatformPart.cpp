@@ -22,11 +22,18 @@
 #include "WsfGroup.hpp"
 #include "WsfMessage.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfProcessor.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfStatusMessage.hpp"
 #include "WsfStringId.hpp"
 
+namespace
+{
+//! Set by the default PlatformAdded and PlatformDeleted, so a probe can tell whether a part overrides them.
+thread_local bool sDefaultNotificationCalled = false;
+} // namespace
+
 // ========================== start sub-class PartRestorationEvent ==========================
 class PartRestorationEvent : public WsfEvent
 {
@@ -321,26 +328,76 @@ bool WsfPlatformPart::IsGroupMember(WsfStringId aGroupId)
 // virtual
 void WsfPlatformPart::Update(double /* aSimTime */) {}
 
+// =================================================================================================
+//! Add the other platforms whose addition and deletion the part must be told about.
+//!
+//! This is invoked when the platform is added to the simulation, and again whenever the components of the platform
+//! change or WsfSimulation::PlatformInterestChanged is called. The default is all platforms, so a part that overrides
+//! PlatformAdded or PlatformDeleted is told about every platform unless it declares a narrower interest. The part
+//! base classes in this library (e.g. WsfMover and WsfProcessor) narrow this to no platforms, so a class derived from
+//! one of them must override this method if it overrides PlatformAdded or PlatformDeleted.
+//!
+//! @param aInterest [updated] The interests of the platform.
+// virtual
+void WsfPlatformPart::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 // =================================================================================================
 //! Some other platform has been added to the simulation.
 //!
-//! This is invoked (via WsfPlatform::PlatformAdded) whenever another platform
-//! has been added to the simulation.
+//! This is invoked (via WsfPlatform::PlatformAdded) whenever another platform in which the part
+//! is interested has been added to the simulation.
 //!
 //! @param aSimTime     The current simulation time.
 //! @param aPlatformPtr Pointer to the platform being added.
 // virtual
-void WsfPlatformPart::PlatformAdded(double /* aSimTime */, WsfPlatform* /* aPlatformPtr */) {}
+void WsfPlatformPart::PlatformAdded(double /* aSimTime */, WsfPlatform* /* aPlatformPtr */)
+{
+   sDefaultNotificationCalled = true;
+}
 
 // =================================================================================================
 //! Some other platform has been deleted from the simulation.
 //!
-//! This is invoked (via WsfPlatform::PlatformDeleted) whenever another platform has
-//! been deleted from the simulation.
+//! This is invoked (via WsfPlatform::PlatformDeleted) whenever another platform in which the
+//! part is interested has been deleted from the simulation.
 //!
 //! @param aPlatformPtr Pointer to the platform being deleted.
 // virtual
-void WsfPlatformPart::PlatformDeleted(WsfPlatform* /* aPlatformPtr */) {}
+void WsfPlatformPart::PlatformDeleted(WsfPlatform* /* aPlatformPtr */)
+{
+   sDefaultNotificationCalled = true;
+}
+
+// =================================================================================================
+//! Tell the part about the addition of another platform, and return whether the part overrides PlatformAdded.
+//!
+//! This is used by WsfPlatformInterestRegistry to find parts that override PlatformAdded without declaring an
+//! interest in other platforms. An override that calls the base class implementation is not detected.
+//!
+//! @param aSimTime     The current simulation time.
+//! @param aPlatformPtr Pointer to the platform being added.
+//! @returns 'true' if the default implementation of PlatformAdded was not reached.
+bool WsfPlatformPart::ProbePlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
+{
+   sDefaultNotificationCalled = false;
+   PlatformAdded(aSimTime, aPlatformPtr);
+   return !sDefaultNotificationCalled;
+}
+
+// =================================================================================================
+//! Tell the part about the deletion of another platform, and return whether the part overrides PlatformDeleted.
+//! @see ProbePlatformAdded.
+//! @param aPlatformPtr Pointer to the platform being deleted.
+//! @returns 'true' if the default implementation of PlatformDeleted was not reached.
+bool WsfPlatformPart::ProbePlatformDeleted(WsfPlatform* aPlatformPtr)
+{
+   sDefaultNotificationCalled = false;
+   PlatformDeleted(aPlatformPtr);
+   return !sDefaultNotificationCalled;
+}
 
 // =================================================================================================
 // virtual
@@ -25,6 +25,7 @@ class WsfGroup;
 #include "WsfInternalLinks.hpp"
 #include "WsfObject.hpp"
 class WsfPlatform;
+class WsfPlatformInterest;
 class WsfScenario;
 class WsfSimulation;
 #include "WsfTypes.hpp"
@@ -114,11 +115,17 @@ public:
    //@}
 
    //! @name Platform notification methods.
-   //! These methods are invoked whenever another platform is added or deleted from the simulation.
+   //! These methods are invoked whenever another platform in which the part is interested (see AddPlatformInterest)
+   //! is added or deleted from the simulation.
    //@{
+   virtual void AddPlatformInterest(WsfPlatformInterest& aInterest) const;
+
    virtual void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr);
 
    virtual void PlatformDeleted(WsfPlatform* aPlatformPtr);
+
+   bool ProbePlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr);
+   bool ProbePlatformDeleted(WsfPlatform* aPlatformPtr);
    //@}
 
    //! @name Status (on/off) methods.
@@ -0,0 +1,295 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfPlatformSpatialIndex.hpp"
+
+#include <algorithm>
+
+#include "UtVec3.hpp"
+#include "WsfMover.hpp"
+#include "WsfMoverObserver.hpp"
+#include "WsfPlatform.hpp"
+#include "WsfPlatformObserver.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+//! The distance (meters) a platform may move from its location in the tree before it is displaced from the tree.
+//! Queries search the tree with their range enlarged by this amount.
+const double cDISPLACEMENT_TOLERANCE = 1000.0;
+
+//! The minimum number of displaced and deleted platforms that will cause the tree to be rebuilt.
+const size_t cMINIMUM_REBUILD_COUNT = 64;
+} // namespace
+
+// =================================================================================================
+//! Return the spatial index for the specified simulation.
+// static
+WsfPlatformSpatialIndex& WsfPlatformSpatialIndex::Get(const WsfSimulation& aSimulation)
+{
+   return static_cast<WsfPlatformSpatialIndex&>(aSimulation.GetExtension("platform_spatial_index"));
+}
+
+// =================================================================================================
+WsfPlatformSpatialIndex::WsfPlatformSpatialIndex()
+   : mEntries()
+   , mEntryIndex()
+   , mDisplaced()
+   , mVacatedCount(0)
+   , mActive(false)
+   , mRebuildRequired(true)
+   , mMutex()
+   , mCallbacks()
+{
+}
+
+// =================================================================================================
+//! Find the platforms within a given range of a location.
+//! @param aLocationWCS The location about which to search.
+//! @param aRange       The search radius (meters).
+//! @param aResults     [output] The platforms within the range, sorted by increasing range.
+//! The platforms are tested at their locations as of their last update. No platform is updated.
+void WsfPlatformSpatialIndex::PlatformsWithin(const double         aLocationWCS[3],
+                                              double               aRange,
+                                              std::vector<Result>& aResults)
+{
+   aResults.clear();
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (!mActive)
+   {
+      // Start maintaining the index with the first query, so simulations that do not use it do not pay for it.
+      WsfSimulation& sim = GetSimulation();
+      mCallbacks.Add(WsfObserver::MoverUpdated(&sim).Connect(&WsfPlatformSpatialIndex::MoverUpdated, this));
+      mCallbacks.Add(WsfObserver::PlatformAdded(&sim).Connect(&WsfPlatformSpatialIndex::PlatformAdded, this));
+      mCallbacks.Add(WsfObserver::PlatformDeleted(&sim).Connect(&WsfPlatformSpatialIndex::PlatformDeleted, this));
+      mActive          = true;
+      mRebuildRequired = true;
+   }
+   if (mRebuildRequired)
+   {
+      Rebuild();
+   }
+
+   double rangeSquared       = aRange * aRange;
+   double searchRange        = aRange + cDISPLACEMENT_TOLERANCE;
+   double searchRangeSquared = searchRange * searchRange;
+   Search(0, mEntries.size(), 0, aLocationWCS, searchRangeSquared, rangeSquared, aResults);
+   for (WsfPlatform* platformPtr : mDisplaced)
+   {
+      double offsetWCS[3];
+      platformPtr->GetLocationWCS(offsetWCS);
+      UtVec3d::Subtract(offsetWCS, offsetWCS, aLocationWCS);
+      double platformRangeSquared = UtVec3d::MagnitudeSquared(offsetWCS);
+      if (platformRangeSquared <= rangeSquared)
+      {
+         aResults.emplace_back(platformRangeSquared, platformPtr);
+      }
+   }
+   std::sort(aResults.begin(),
+             aResults.end(),
+             [](const Result& aLhs, const Result& aRhs) { return aLhs.first < aRhs.first; });
+}
+
+// =================================================================================================
+//! Report that the location of a platform has been set directly (i.e., not by a mover update).
+//! @param aPlatform The platform whose location has changed.
+void WsfPlatformSpatialIndex::PlatformMoved(WsfPlatform& aPlatform)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (mActive && (!mRebuildRequired))
+   {
+      Displace(aPlatform);
+   }
+}
+
+// =================================================================================================
+// private
+void WsfPlatformSpatialIndex::Rebuild()
+{
+   WsfSimulation& sim = GetSimulation();
+   mEntries.clear();
+   mEntries.reserve(sim.GetPlatformCount());
+   for (unsigned int i = 0; i < sim.GetPlatformCount(); ++i)
+   {
+      Entry entry;
+      entry.mPlatformPtr = sim.GetPlatformEntry(i);
+      entry.mPlatformPtr->GetLocationWCS(entry.mLocationWCS);
+      mEntries.push_back(entry);
+   }
+   Build(0, mEntries.size(), 0);
+
+   mEntryIndex.clear();
+   for (size_t i = 0; i < mEntries.size(); ++i)
+   {
+      mEntryIndex[mEntries[i].mPlatformPtr->GetIndex()] = i;
+   }
+   mDisplaced.clear();
+   mVacatedCount    = 0;
+   mRebuildRequired = false;
+}
+
+// =================================================================================================
+//! Order the entries in the range [aBegin, aEnd) as a k-d tree.
+// private
+void WsfPlatformSpatialIndex::Build(size_t aBegin, size_t aEnd, int aAxis)
+{
+   if ((aEnd - aBegin) <= 1)
+   {
+      return;
+   }
+   size_t middle = aBegin + (aEnd - aBegin) / 2;
+   std::nth_element(mEntries.begin() + aBegin,
+                    mEntries.begin() + middle,
+                    mEntries.begin() + aEnd,
+                    [aAxis](const Entry& aLhs, const Entry& aRhs)
+                    { return aLhs.mLocationWCS[aAxis] < aRhs.mLocationWCS[aAxis]; });
+   int nextAxis = (aAxis + 1) % 3;
+   Build(aBegin, middle, nextAxis);
+   Build(middle + 1, aEnd, nextAxis);
+}
+
+// =================================================================================================
+//! Search the tree for the platforms within range of a location.
+//! The tree is traversed using the locations at which the platforms were entered and the enlarged search range,
+//! while the platforms are tested against the actual range at their current locations.
+// private
+void WsfPlatformSpatialIndex::Search(size_t               aBegin,
+                                     size_t               aEnd,
+                                     int                  aAxis,
+                                     const double         aLocationWCS[3],
+                                     double               aSearchRangeSquared,
+                                     double               aRangeSquared,
+                                     std::vector<Result>& aResults) const
+{
+   if (aBegin >= aEnd)
+   {
+      return;
+   }
+   size_t       middle = aBegin + (aEnd - aBegin) / 2;
+   const Entry& entry  = mEntries[middle];
+
+   double offsetWCS[3];
+   UtVec3d::Subtract(offsetWCS, aLocationWCS, entry.mLocationWCS);
+   if ((entry.mPlatformPtr != nullptr) && (UtVec3d::MagnitudeSquared(offsetWCS) <= aSearchRangeSquared))
+   {
+      double platformOffsetWCS[3];
+      entry.mPlatformPtr->GetLocationWCS(platformOffsetWCS);
+      UtVec3d::Subtract(platformOffsetWCS, platformOffsetWCS, aLocationWCS);
+      double rangeSquared = UtVec3d::MagnitudeSquared(platformOffsetWCS);
+      if (rangeSquared <= aRangeSquared)
+      {
+         aResults.emplace_back(rangeSquared, entry.mPlatformPtr);
+      }
+   }
+
+   // Search the side of the splitting plane containing the query point first, and the other side only if
+   // the search sphere crosses the plane.
+   double axisOffset = offsetWCS[aAxis];
+   int    nextAxis   = (aAxis + 1) % 3;
+   if (axisOffset < 0.0)
+   {
+      Search(aBegin, middle, nextAxis, aLocationWCS, aSearchRangeSquared, aRangeSquared, aResults);
+      if ((axisOffset * axisOffset) <= aSearchRangeSquared)
+      {
+         Search(middle + 1, aEnd, nextAxis, aLocationWCS, aSearchRangeSquared, aRangeSquared, aResults);
+      }
+   }
+   else
+   {
+      Search(middle + 1, aEnd, nextAxis, aLocationWCS, aSearchRangeSquared, aRangeSquared, aResults);
+      if ((axisOffset * axisOffset) <= aSearchRangeSquared)
+      {
+         Search(aBegin, middle, nextAxis, aLocationWCS, aSearchRangeSquared, aRangeSquared, aResults);
+      }
+   }
+}
+
+// =================================================================================================
+//! Move a platform from the tree to the displaced list if it has moved beyond the tolerance.
+//! The caller must hold the lock.
+// private
+void WsfPlatformSpatialIndex::Displace(WsfPlatform& aPlatform)
+{
+   auto entryIter = mEntryIndex.find(aPlatform.GetIndex());
+   if (entryIter == mEntryIndex.end())
+   {
+      return; // Already displaced
+   }
+   Entry& entry = mEntries[entryIter->second];
+   double offsetWCS[3];
+   aPlatform.GetLocationWCS(offsetWCS);
+   UtVec3d::Subtract(offsetWCS, offsetWCS, entry.mLocationWCS);
+   if (UtVec3d::MagnitudeSquared(offsetWCS) > (cDISPLACEMENT_TOLERANCE * cDISPLACEMENT_TOLERANCE))
+   {
+      entry.mPlatformPtr = nullptr;
+      mEntryIndex.erase(entryIter);
+      mDisplaced.push_back(&aPlatform);
+      ++mVacatedCount;
+      CheckRebuild();
+   }
+}
+
+// =================================================================================================
+//! Request a rebuild of the tree if the displaced or deleted platforms have made it inefficient.
+//! The caller must hold the lock.
+// private
+void WsfPlatformSpatialIndex::CheckRebuild()
+{
+   size_t limit = std::max(cMINIMUM_REBUILD_COUNT, mEntries.size() / 8);
+   if ((mVacatedCount > limit) || (mDisplaced.size() > limit))
+   {
+      mRebuildRequired = true;
+   }
+}
+
+// =================================================================================================
+// private
+void WsfPlatformSpatialIndex::MoverUpdated(double /*aSimTime*/, WsfMover* aMoverPtr)
+{
+   WsfPlatform* platformPtr = aMoverPtr->GetPlatform();
+   if (platformPtr != nullptr)
+   {
+      PlatformMoved(*platformPtr);
+   }
+}
+
+// =================================================================================================
+// private
+void WsfPlatformSpatialIndex::PlatformAdded(double /*aSimTime*/, WsfPlatform* aPlatformPtr)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (!mRebuildRequired)
+   {
+      mDisplaced.push_back(aPlatformPtr);
+      CheckRebuild();
+   }
+}
+
+// =================================================================================================
+// private
+void WsfPlatformSpatialIndex::PlatformDeleted(double /*aSimTime*/, WsfPlatform* aPlatformPtr)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (mRebuildRequired)
+   {
+      return;
+   }
+   auto entryIter = mEntryIndex.find(aPlatformPtr->GetIndex());
+   if (entryIter != mEntryIndex.end())
+   {
+      mEntries[entryIter->second].mPlatformPtr = nullptr;
+      mEntryIndex.erase(entryIter);
+      ++mVacatedCount;
+      CheckRebuild();
+   }
+   else
+   {
+      mDisplaced.erase(std::remove(mDisplaced.begin(), mDisplaced.end(), aPlatformPtr), mDisplaced.end());
+   }
+}
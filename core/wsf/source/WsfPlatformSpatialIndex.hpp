@@ -0,0 +1,101 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFPLATFORMSPATIALINDEX_HPP
+#define WSFPLATFORMSPATIALINDEX_HPP
+
+#include "wsf_export.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "UtCallbackHolder.hpp"
+class WsfMover;
+class WsfPlatform;
+#include "WsfSimulationExtension.hpp"
+
+//! A simulation-maintained spatial index of the platforms in the simulation.
+//!
+//! The index is a k-d tree of the platform WCS locations at the time the tree was built. Queries never update a
+//! platform; they use the location of each platform as of its last update. The tree is kept current as platforms move
+//! rather than being rebuilt at each simulation time:
+//! - When a mover update moves a platform more than a fixed tolerance from its location in the tree, the platform is
+//!   removed from the tree and placed in a short list of displaced platforms. Platforms added since the tree was built
+//!   are also in this list. The list is searched linearly.
+//! - Queries search the tree with the query range enlarged by the tolerance and test each candidate at its current
+//!   location, so the tree may be slightly stale without missing a platform.
+//! - The tree is rebuilt (in O(N log N)) only when the displaced and deleted platforms become a significant fraction
+//!   of the tree.
+//!
+//! The index is not maintained until the first query. Locations set directly rather than by a mover update must be
+//! reported with PlatformMoved (the script location methods do this).
+class WSF_EXPORT WsfPlatformSpatialIndex : public WsfSimulationExtension
+{
+public:
+   //! A platform found by a query and the square of its distance from the query point.
+   using Result = std::pair<double, WsfPlatform*>;
+
+   static WsfPlatformSpatialIndex& Get(const WsfSimulation& aSimulation);
+
+   WsfPlatformSpatialIndex();
+   ~WsfPlatformSpatialIndex() override = default;
+
+   void PlatformsWithin(const double aLocationWCS[3], double aRange, std::vector<Result>& aResults);
+
+   void PlatformMoved(WsfPlatform& aPlatform);
+
+private:
+   struct Entry
+   {
+      double       mLocationWCS[3];
+      WsfPlatform* mPlatformPtr; //!< nullptr if the platform has since been displaced or deleted
+   };
+
+   void Rebuild();
+   void Build(size_t aBegin, size_t aEnd, int aAxis);
+   void Search(size_t               aBegin,
+               size_t               aEnd,
+               int                  aAxis,
+               const double         aLocationWCS[3],
+               double               aSearchRangeSquared,
+               double               aRangeSquared,
+               std::vector<Result>& aResults) const;
+
+   void Displace(WsfPlatform& aPlatform);
+   void CheckRebuild();
+
+   void MoverUpdated(double aSimTime, WsfMover* aMoverPtr);
+   void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr);
+   void PlatformDeleted(double aSimTime, WsfPlatform* aPlatformPtr);
+
+   //! The platforms, ordered as an implicit k-d tree. The median of each range [begin, end) along the
+   //! splitting axis is at the midpoint of the range.
+   std::vector<Entry> mEntries;
+
+   //! The position in mEntries of each platform in the tree, by platform index.
+   std::unordered_map<size_t, size_t> mEntryIndex;
+
+   //! The platforms that are not in the tree (added since it was built or displaced from their entries).
+   std::vector<WsfPlatform*> mDisplaced;
+
+   //! The number of entries that have been vacated since the tree was built.
+   size_t mVacatedCount;
+
+   bool mActive;
+   bool mRebuildRequired;
+
+   //! Guards the index, which may be queried by scripts on worker threads.
+   std::mutex mMutex;
+
+   UtCallbackHolder mCallbacks;
+};
+
+#endif
@@ -77,6 +77,7 @@
 #include "WsfPathFinder.hpp"
 #include "WsfPlatform.hpp"
 #include "WsfPlatformAvailability.hpp"
+#include "WsfPlatformSpatialIndex.hpp"
 #include "WsfPlatformTypes.hpp"
 #include "WsfProcessor.hpp"
 #include "WsfProcessorTypes.hpp"
@@ -86,8 +87,10 @@
 #include "WsfRouteNetworkTypes.hpp"
 #include "WsfRouteTypes.hpp"
 #include "WsfScenario.hpp"
+#include "WsfScenarioExtension.hpp"
 #include "WsfSensor.hpp"
 #include "WsfSensorErrorModelTypes.hpp"
+#include "WsfSensorSearchRoster.hpp"
 #include "WsfSensorSignalProcessor.hpp"
 #include "WsfSensorTypes.hpp"
 #include "WsfSignatureList.hpp"
@@ -97,6 +100,7 @@
 #include "WsfSolarIlluminationComponent.hpp"
 #include "WsfStringId.hpp"
 #include "WsfSystemLog.hpp"
+#include "WsfTSPI_Archive.hpp"
 #include "WsfTerrain.hpp"
 #include "WsfThermalSystem.hpp"
 #include "WsfThermalSystemTypes.hpp"
@@ -104,6 +108,7 @@
 #include "WsfTrackReportingStrategyTypes.hpp"
 #include "WsfVersion.hpp"
 #include "WsfVisualPartTypes.hpp"
+#include "WsfZoneMonitor.hpp"
 #include "WsfZoneTypes.hpp"
 #include "script/WsfScriptContext.hpp"
 #include "script/WsfScriptManager.hpp"
@@ -155,6 +160,36 @@ WsfScenario::WsfScenario(WsfApplication& aApplication)
    // Then create the type lists
    CreateTypeLists(*this);
 
+   // Register the top-level commands that are processed by the scenario itself.
+   for (const char* keyword : {"file_path",
+                               "reset_file_path",
+                               "define_path_variable",
+                               "undefine_path_variable",
+                               "stream_debug_on",
+                               "stream_debug_off",
+                               "enumerate",
+                               "initial_run_number",
+                               "final_run_number",
+                               "number_of_runs",
+                               "run_number_increment",
+                               "generate_random_seeds",
+                               "random_seed",
+                               "random_seeds",
+                               "random_seed_time",
+                               "quantitative_track_quality",
+                               "conditional_section",
+                               "end_conditional_section",
+                               "classification_levels",
+                               "classification",
+                               "test_feature",
+                               "expect_input_error",
+                               "simulation_name"})
+   {
+      AddInputProcessor(keyword, [this](UtInput& aInput) { return ProcessScenarioInput(aInput); });
+   }
+   // 'edit platform' is left to LoadPlatformInstance in ProcessInputP because 'edit' is shared with other subsystems.
+   AddInputProcessor("platform", [this](UtInput& aInput) { return LoadPlatformInstance(aInput); });
+
    mSimulationInputPtr  = ut::make_unique<WsfDefaultSimulationInput>(*this);
    mEnvironmentPtr      = ut::make_unique<WsfEnvironment>(*this);
    mPathFinderListPtr   = ut::make_unique<WsfPathFinderList>();
@@ -165,7 +200,13 @@ WsfScenario::WsfScenario(WsfApplication& aApplication)
    RegisterExtension("comm_network_manager", ut::make_unique<wsf::comm::NetworkManagerExtension>());
    RegisterExtension("gravity_model", ut::make_unique<wsf::EarthGravityModelExtension>());
    RegisterExtension("los_manager", ut::make_unique<WsfLOS_ManagerExtension>());
+   RegisterExtension("platform_spatial_index",
+                     ut::make_unique<WsfDefaultScenarioExtension<WsfPlatformSpatialIndex>>());
    RegisterExtension("script_observer", ut::make_unique<WsfScriptObserverExtension>());
+   RegisterExtension("sensor_search_roster",
+                     ut::make_unique<WsfDefaultScenarioExtension<WsfSensorSearchRosterExtension>>());
+   RegisterExtension("tspi_archive", ut::make_unique<WsfTSPI_ArchiveExtension>());
+   RegisterExtension("zone_monitor", ut::make_unique<WsfZoneMonitorExtension>());
 
    // Create the main input object and attach the aux_data item used to contain the pointer back to the scenario.
    mInputPtr = ut::make_unique<UtInput>();
@@ -249,10 +290,28 @@ bool WsfScenario::ProcessInput(UtInput& aInput)
 }
 
 // =================================================================================================
+//! Process a top-level command.
+//! A command with a registered keyword (see AddInputProcessor) is dispatched directly to the functions registered for
+//! it. Any other command is offered to the subsystems that cannot enumerate their commands, and is counted in the
+//! report written by CompleteLoad.
 bool WsfScenario::ProcessInputP(UtInput& aInput)
 {
    std::string command = aInput.GetCommand();
 
+   // A command with a registered keyword is owned by the functions registered for it.
+   auto keywordIter = mInputKeywords.find(command);
+   if (keywordIter != mInputKeywords.end())
+   {
+      for (auto& function : keywordIter->second)
+      {
+         if (function(aInput))
+         {
+            return true;
+         }
+      }
+   }
+
+   // Otherwise try the subsystems that cannot enumerate their commands, in their original order.
    if (TypesProcessInput(aInput))
    {
    }
@@ -286,7 +345,34 @@ bool WsfScenario::ProcessInputP(UtInput& aInput)
    else if (mPlatformAvailabilityPtr->ProcessInput(aInput))
    {
    }
-   else if (command == "file_path")
+   else
+   {
+      bool myCommand = false;
+      for (auto& mInputFunction : mInputFunctions)
+      {
+         if (mInputFunction(aInput))
+         {
+            myCommand = true;
+         }
+      }
+      if (!myCommand)
+      {
+         return false;
+      }
+   }
+   ++mFallbackInputCommands[command];
+   return true;
+}
+
+// =================================================================================================
+//! Process the top-level commands owned by the scenario itself.
+//! Each of these commands is registered as a keyword in the constructor.
+// private
+bool WsfScenario::ProcessScenarioInput(UtInput& aInput)
+{
+   std::string command = aInput.GetCommand();
+
+   if (command == "file_path")
    {
       std::string pathName;
       aInput.ReadValueQuoted(pathName);
@@ -654,15 +740,7 @@ bool WsfScenario::ProcessInputP(UtInput& aInput)
    }
    else
    {
-      bool myCommand = false;
-      for (auto& mInputFunction : mInputFunctions)
-      {
-         if (mInputFunction(aInput))
-         {
-            myCommand = true;
-         }
-      }
-      return myCommand;
+      return false;
    }
    return true;
 }
@@ -736,6 +814,16 @@ void WsfScenario::CompleteLoad()
 
    mLoadIsComplete = true;
 
+   // Report the commands that were not dispatched by keyword. These are candidates for registration.
+   if (!mFallbackInputCommands.empty())
+   {
+      auto out = ut::log::debug() << "Input commands processed without a registered keyword:";
+      for (const auto& fallbackCommand : mFallbackInputCommands)
+      {
+         out.AddNote() << fallbackCommand.first << ": " << fallbackCommand.second;
+      }
+   }
+
    for (const auto& extStr : mExtensionListPtr->GetExtensionOrder())
    {
       FindExtension(extStr)->Complete2();
@@ -872,6 +960,20 @@ void WsfScenario::AddInputProcessor(const InputFunction& aFunction)
    mInputFunctions.push_back(aFunction);
 }
 
+// =================================================================================================
+//! Register a function that processes a top-level command.
+//! The command is dispatched directly to the function (and to any other function registered for it, in order of
+//! registration) instead of being offered to every subsystem in turn. This is much faster for large inputs, and should
+//! be used in preference to AddInputProcessor(aFunction) when the commands of the subsystem are known.
+//! @param aKeyword  The top-level command.
+//! @param aFunction The function, which returns true if it processed the command.
+//! @note The keyword must be owned by the function: no subsystem that does not register its commands (including
+//! the functions added with AddInputProcessor(aFunction)) may accept it.
+void WsfScenario::AddInputProcessor(const std::string& aKeyword, const InputFunction& aFunction)
+{
+   mInputKeywords[aKeyword].push_back(aFunction);
+}
+
 // =================================================================================================
 WsfDeferredInput& WsfScenario::GetDeferredInput()
 {
@@ -996,6 +1098,7 @@ void WsfScenario::CreateTypeLists(WsfScenario& aScenario)
    {
       assert(mTypesListByKind[typeList->GetBlockName()] == nullptr);
       mTypesListByKind[typeList->GetBlockName()] = typeList.get();
+      RegisterTypeListInput(typeList.get());
    }
 
    // Most type lists that represent things stored in the component list of WsfPlatform also
@@ -1021,11 +1124,13 @@ T* WsfScenario::CreateTypeList(WsfScenario& aScenario)
 }
 
 // =================================================================================================
+//! Offer a command to the type lists that cannot enumerate their commands, and then to the terrain interface.
+//! The other type lists receive only their registered keywords.
 bool WsfScenario::TypesProcessInput(UtInput& aInput)
 {
-   for (auto& allTypeList : mAllTypeLists)
+   for (auto typeListPtr : mUnindexedTypeLists)
    {
-      if (allTypeList->ProcessInput(aInput))
+      if (typeListPtr->ProcessInput(aInput))
       {
          return true;
       }
@@ -1329,6 +1434,26 @@ void WsfScenario::AddTypeList(std::unique_ptr<WsfObjectTypeListBaseI> aTypeListP
    mAllTypeLists.push_back(std::move(aTypeListPtr));
    assert(mTypesListByKind[ptr->GetBlockName()] == nullptr);
    mTypesListByKind[ptr->GetBlockName()] = ptr;
+   RegisterTypeListInput(ptr);
+}
+
+// =================================================================================================
+//! Register the top-level commands of a type list, or add it to the type lists that cannot enumerate them.
+// private
+void WsfScenario::RegisterTypeListInput(WsfObjectTypeListBaseI* aTypeListPtr)
+{
+   std::vector<std::string> keywords;
+   if (aTypeListPtr->GetInputKeywords(keywords))
+   {
+      for (const auto& keyword : keywords)
+      {
+         AddInputProcessor(keyword, [aTypeListPtr](UtInput& aInput) { return aTypeListPtr->ProcessInput(aInput); });
+      }
+   }
+   else
+   {
+      mUnindexedTypeLists.push_back(aTypeListPtr);
+   }
 }
 
 // =================================================================================================
@@ -16,6 +16,8 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "UtAtmosphere.hpp"
@@ -177,6 +179,7 @@ public:
    const std::vector<std::string>& GetInputFiles() const { return mInputFiles; }
 
    void AddInputProcessor(const InputFunction& aFunction);
+   void AddInputProcessor(const std::string& aKeyword, const InputFunction& aFunction);
 
    UtScriptEnvironment& GetScriptEnvironment() const { return *mScriptEnvironmentPtr; }
 
@@ -371,6 +374,8 @@ private:
    T* CreateTypeList(WsfScenario& aScenario);
 
    bool ProcessEnumerateCommand(UtInput& aInput);
+   bool ProcessScenarioInput(UtInput& aInput);
+   void RegisterTypeListInput(WsfObjectTypeListBaseI* aTypeListPtr);
 
 protected:
    virtual bool ProcessInputP(UtInput& aInput);
@@ -418,6 +423,12 @@ protected:
 
    std::vector<InputFunction> mInputFunctions;
 
+   //! The functions that process each registered top-level command, in order of registration.
+   std::unordered_map<std::string, std::vector<InputFunction>> mInputKeywords;
+
+   //! The top-level commands that were not registered, and the number of times each was processed.
+   std::map<std::string, unsigned int> mFallbackInputCommands;
+
    bool mUseQuantitativeTrackQuality;
 
    using ClassificationLevel = std::pair<std::string, UtColor>;
@@ -501,6 +512,8 @@ protected:
    std::vector<std::unique_ptr<WsfObjectTypeListBaseI>> mAllTypeLists;
    //! All of the type lists by type.
    std::map<std::string, WsfObjectTypeListBaseI*> mTypesListByKind;
+   //! The type lists that cannot enumerate their top-level commands, in order of creation.
+   std::vector<WsfObjectTypeListBaseI*> mUnindexedTypeLists;
 
    //! Pointer to the prototype signature list.
    std::unique_ptr<WsfSignatureList> mSignatureListPrototypePtr;
@@ -112,6 +112,7 @@ WsfSimulation::WsfSimulation(const WsfScenario& aScenario, unsigned int aRunNumb
    , mZoneAttenuation(this)
    , mScriptExecutor(&aScenario.GetScriptEnvironment())
    , mGlobalContext(*mScenario.GetScriptContext())
+   , mPlatformInterests(this)
 {
    if (!aScenario.LoadIsComplete())
    {
@@ -357,10 +358,7 @@ bool WsfSimulation::AddPlatform(double aSimTime, WsfPlatform* aPlatformPtr)
                if (DeleteFromPlatformList(aPlatformPtr))
                {
                   // Let others platforms know this platform has been deleted.
-                  for (unsigned int i = 0; i < GetPlatformCount(); ++i)
-                  {
-                     GetPlatformEntry(i)->PlatformDeleted(aPlatformPtr);
-                  }
+                  NotifyPlatformDeleted(aPlatformPtr);
 
                   // Tell any observers that the platform is being deleted.
                   WsfObserver::PlatformDeleted(this)(simTime, aPlatformPtr);
@@ -657,21 +655,67 @@ void WsfSimulation::Initialize()
 // private
 bool WsfSimulation::IntroducePlatform(double aSimTime, WsfPlatform* aNewPlatformPtr)
 {
-   // Introduce the new and old platforms to each other
-   for (unsigned int i = 0; i < GetPlatformCount(); ++i)
+   if (!mPlatformInterests.IsRegistered(*aNewPlatformPtr))
    {
-      WsfPlatform* oldPlatformPtr = GetPlatformEntry(i);
-      if (aNewPlatformPtr != oldPlatformPtr)
+      mPlatformInterests.Register(*aNewPlatformPtr);
+   }
+
+   // Introduce the new and old platforms that are interested in each other, in platform list order.
+   // If an introduction changes the interests of a platform (e.g.: a command chain gets a new commander)
+   // then the remaining platforms are found again.
+   std::vector<WsfPlatform*> platforms;
+   size_t                    lastIndex     = 0;
+   bool                      findPlatforms = true;
+   while (findPlatforms)
+   {
+      findPlatforms           = false;
+      unsigned int generation = mPlatformInterests.GetGeneration();
+      mPlatformInterests.FindIntroductions(*aNewPlatformPtr, lastIndex, platforms);
+      for (WsfPlatform* oldPlatformPtr : platforms)
       {
-         // Tell the new platform about the existence of an existing platform
-         aNewPlatformPtr->PlatformAdded(aSimTime, oldPlatformPtr);
-         // Tell the existing platform about the existence of the new platform
-         oldPlatformPtr->PlatformAdded(aSimTime, aNewPlatformPtr);
+         lastIndex = oldPlatformPtr->GetIndex();
+         if (aNewPlatformPtr != oldPlatformPtr)
+         {
+            // Tell the new platform about the existence of an existing platform
+            if (mPlatformInterests.IsInterested(*aNewPlatformPtr, *oldPlatformPtr, true))
+            {
+               aNewPlatformPtr->PlatformAdded(aSimTime, oldPlatformPtr);
+            }
+            // Tell the existing platform about the existence of the new platform
+            if (mPlatformInterests.IsInterested(*oldPlatformPtr, *aNewPlatformPtr, true))
+            {
+               oldPlatformPtr->PlatformAdded(aSimTime, aNewPlatformPtr);
+            }
+         }
+         if (generation != mPlatformInterests.GetGeneration())
+         {
+            findPlatforms = true;
+            break;
+         }
       }
    }
+   mPlatformInterests.ProbeParts(aSimTime, *aNewPlatformPtr, true);
    return PlatformIntroduced(aSimTime, aNewPlatformPtr);
 }
 
+// =================================================================================================
+//! Tell the platforms that are interested in a platform that it is being deleted.
+//! The platform itself is told if it is still in the platform list.
+// private
+void WsfSimulation::NotifyPlatformDeleted(WsfPlatform* aOldPlatformPtr)
+{
+   std::vector<WsfPlatform*> platforms;
+   mPlatformInterests.FindInterestedInDeletion(*aOldPlatformPtr, platforms);
+   for (WsfPlatform* platformPtr : platforms)
+   {
+      if ((platformPtr == aOldPlatformPtr) || mPlatformInterests.IsInterested(*platformPtr, *aOldPlatformPtr, false))
+      {
+         platformPtr->PlatformDeleted(aOldPlatformPtr);
+      }
+   }
+   mPlatformInterests.ProbeParts(GetSimTime(), *aOldPlatformPtr, false);
+}
+
 // =================================================================================================
 //! Set the clock source object.
 //!
@@ -1069,11 +1113,7 @@ bool WsfSimulation::PlatformIntroduced(double /* aSimTime */, WsfPlatform* /* aN
 bool WsfSimulation::PlatformDeleted(double aSimTime, WsfPlatform* aOldPlatformPtr)
 {
    // Let others platforms know this platform has been deleted.
-   for (unsigned int i = 0; i < GetPlatformCount(); ++i)
-   {
-      WsfPlatform* platformPtr = GetPlatformEntry(i);
-      platformPtr->PlatformDeleted(aOldPlatformPtr);
-   }
+   NotifyPlatformDeleted(aOldPlatformPtr);
 
    // Notify the 'Single Platform Observers' registered with the platform
    aOldPlatformPtr->NotifyDeleted(aSimTime);
@@ -1091,6 +1131,18 @@ bool WsfSimulation::PlatformDeleted(double aSimTime, WsfPlatform* aOldPlatformPt
    return DeleteFromPlatformList(aOldPlatformPtr);
 }
 
+// =================================================================================================
+//! Indicate that the platforms in which a platform is interested may have changed.
+//! This must be called by a platform part whose interest (see WsfPlatformPart::AddPlatformInterest) changes after the
+//! platform has been added to the simulation. Changes to the component list of a platform are handled automatically.
+void WsfSimulation::PlatformInterestChanged(WsfPlatform& aPlatform)
+{
+   if (mPlatformInterests.IsRegistered(aPlatform))
+   {
+      mPlatformInterests.Register(aPlatform);
+   }
+}
+
 // =================================================================================================
 //! Called from RemovePlatformEvent to complete the processing of deleting a platform.
 void WsfSimulation::ProcessRemovePlatformEvent(double aSimTime, WsfPlatform* aPlatformPtr, bool aDeletePlatform)
@@ -1313,6 +1365,11 @@ bool WsfSimulation::AddInputPlatforms()
 
    if (ok)
    {
+      // All of the platforms are on the platform list, so they must all be registered before any are introduced.
+      for (auto platformPtr : platformList)
+      {
+         mPlatformInterests.Register(*platformPtr);
+      }
       for (auto platformPtr : platformList)
       {
          if (!IntroducePlatform(0.0, platformPtr))
@@ -1452,6 +1509,8 @@ bool WsfSimulation::DeleteFromPlatformList(WsfPlatform* aPlatformPtr)
 {
    bool wasDeleted = false;
 
+   mPlatformInterests.Unregister(*aPlatformPtr);
+
    // For safety we always try to remove the platform from each container individually.
 
    auto iter = find(mPlatforms.begin(), mPlatforms.end(), aPlatformPtr);
@@ -1509,6 +1568,7 @@ bool WsfSimulation::PlatformPointerExists(WsfPlatform* aPlatformPtr)
 // protected
 void WsfSimulation::ResetPlatformList()
 {
+   mPlatformInterests.Clear();
    mPlatforms.clear();
    mPlatformsByIndex.clear();
    mPlatformsByName.clear();
@@ -1800,10 +1860,7 @@ void WsfSimulation::HandlePlatformInitializationFailure(WsfPlatform* aPlatformPt
    if (DeleteFromPlatformList(aPlatformPtr))
    {
       // Let others platforms know this platform has been deleted.
-      for (size_t i = 0; i < GetPlatformCount(); ++i)
-      {
-         GetPlatformEntry(i)->PlatformDeleted(aPlatformPtr);
-      }
+      NotifyPlatformDeleted(aPlatformPtr);
 
       // Tell any observers that the platform is being deleted.
       WsfObserver::PlatformDeleted(this)(0.0, aPlatformPtr);
@@ -52,6 +52,7 @@ class WsfMover;
 #include "WsfMultiThreadManager.hpp"
 class WsfPathFinderList;
 class WsfPlatform;
+#include "WsfPlatformInterest.hpp"
 #include "WsfPlatformObserver.hpp"
 class WsfPlatformPart;
 #include "WsfPlatformPartObserver.hpp"
@@ -387,6 +388,8 @@ public:
    //@{
    virtual bool PlatformDeleted(double aSimTime, WsfPlatform* aOldPlatformPtr);
 
+   void PlatformInterestChanged(WsfPlatform& aPlatform);
+
    virtual void ProcessRemovePlatformEvent(double aSimTime, WsfPlatform* aPlatformPtr, bool aDeletePlatform);
 
    virtual void ProcessPlatformBrokenEvent(double aSimTime, WsfPlatform* aPlatformPtr);
@@ -589,6 +592,8 @@ private:
 
    bool IntroducePlatform(double aSimTime, WsfPlatform* aNewPlatformPtr);
 
+   void NotifyPlatformDeleted(WsfPlatform* aOldPlatformPtr);
+
    void TurnOnSystems(double aSimTime, WsfPlatform* aPlatformPtr);
 
    void HandlePlatformInitializationFailure(WsfPlatform* aPlatformPtr);
@@ -695,6 +700,9 @@ private:
    //! The list of platforms indexed by platform name(ID).
    std::map<WsfStringId, WsfPlatform*> mPlatformsByName;
 
+   //! The platforms each platform must be told about when they are added or deleted.
+   WsfPlatformInterestRegistry mPlatformInterests;
+
    // Records the creation order of extensions
    WsfExtensionList mExtensionList;
 };
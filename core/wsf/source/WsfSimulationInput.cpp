@@ -254,6 +254,8 @@ WsfEventStepSimulationInput::WsfEventStepSimulationInput()
 // =================================================================================================
 WsfFrameStepSimulationInput::WsfFrameStepSimulationInput()
    : mFrameTime(0.25)
+   , mDeadlineMargin(0.0)
+   , mDeadlineScheduling(false)
 {
 }
 
@@ -274,6 +276,15 @@ bool WsfFrameStepSimulationInput::ProcessInput(UtInput& aInput, WsfSimulationInp
       aInput.ReadValueOfType(mFrameTime, UtInput::cTIME);
       aInput.ValueGreater(mFrameTime, 0.0);
    }
+   else if (command == "deadline_scheduling")
+   {
+      aInput.ReadValue(mDeadlineScheduling);
+   }
+   else if (command == "deadline_margin")
+   {
+      aInput.ReadValueOfType(mDeadlineMargin, UtInput::cTIME);
+      aInput.ValueGreaterOrEqual(mDeadlineMargin, 0.0);
+   }
    else
    {
       myCommand = false;
@@ -53,6 +53,9 @@ public:
    //! Return whether the simulation should multi-thread were appropriate.
    bool MultiThreaded() const { return mMultiThreaded; }
 
+   //! Return the number of worker threads to be used if the simulation is multi-threaded.
+   int GetNumberOfThreads() const { return mNumberOfThreads; }
+
    //! Get the defined end time of the simulation.
    double GetEndTime() const { return mEndTime; }
 
@@ -199,6 +202,13 @@ public:
 
    //! The time allotted to a frame (seconds)
    double mFrameTime;
+
+   //! The time (seconds) at the end of a real-time frame that deadline scheduling keeps free of sensor updates.
+   double mDeadlineMargin;
+
+   //! If true, sensor updates that are not predicted to complete by the end of a real-time frame are
+   //! deferred to the next frame.
+   bool mDeadlineScheduling;
 };
 
 //! Reads inputs for both WsfEventStepSimulation and WsfFrameStepSimulation
@@ -14,15 +14,27 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 
 #include "UtAzElLookup.hpp"
 #include "UtAzElTable.hpp"
 #include "UtAzElTableLoader.hpp"
 #include "UtInput.hpp"
 #include "UtInputBlock.hpp"
+#include "UtLog.hpp"
 #include "UtMath.hpp"
 #include "UtStringUtil.hpp"
 
+namespace
+{
+// The constants that convert the normalized angle of the sine pattern to the argument of the gain function. They
+// convert radians to degrees and multiply by 2 (to get the full beamwidth) and by:
+//  1.616 which is the value of X where 2*BesselJ1(X)/X = .707 (circular)
+//  1.393 which is the value of X where sin(X)/X = .707 (rectangular)
+const double cSINE_MAGIC_CIRCULAR    = 185.17995;
+const double cSINE_MAGIC_RECTANGULAR = 159.626;
+} // namespace
+
 WsfStandardAntennaPattern::WsfStandardAntennaPattern()
    : WsfAntennaPattern(new StandardData())
 {
@@ -91,6 +103,12 @@ WsfStandardAntennaPattern::StandardData::StandardData()
    , mCscWithinCsc2Factor(0.0)
    , mCscAboveCsc2Factor(0.0)
    , mFirstTime(true)
+   , mGainEvaluation(cEXACT)
+   , mTabulationError(1.0E-4)
+   , mValidateTabulation(false)
+   , mCircularTable()
+   , mSineTable()
+   , mSincSquaredTable()
 {
 }
 
@@ -165,6 +183,9 @@ bool WsfStandardAntennaPattern::StandardData::ProcessInput(WsfAntennaPattern& aP
       ProcessUniformInput(aPattern, aInput);
       mPatternType = cUNIFORM_PATTERN;
    }
+   else if (ProcessEvaluationInput(aInput))
+   {
+   }
    else
    {
       myCommand = WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput);
@@ -175,7 +196,10 @@ bool WsfStandardAntennaPattern::StandardData::ProcessInput(WsfAntennaPattern& aP
 // virtual
 bool WsfStandardAntennaPattern::StandardData::Initialize(WsfAntennaPattern& aAntennaPattern)
 {
-   return BaseData::Initialize(aAntennaPattern);
+   // The tables must be built before the base class initialization, which may sample the pattern.
+   bool ok = InitializeTables(aAntennaPattern);
+   ok &= BaseData::Initialize(aAntennaPattern);
+   return ok;
 }
 
 // virtual
@@ -196,20 +220,9 @@ double WsfStandardAntennaPattern::StandardData::GetGain(double aFrequency,
    }
    break;
    case cCIRCULAR_PATTERN:
-      gain = CircularPattern(aTargetAz, aTargetEl, mPeakGain, mAzBeamwidth * UtMath::cDEG_PER_RAD);
-      break;
    case cCOSECANT_SQUARED_PATTERN:
-      gain = CosecantSquaredPattern(aTargetAz, aTargetEl);
-      break;
    case cSINE_PATTERN:
-      gain = SinePattern(aTargetAz,
-                         aTargetEl,
-                         mPeakGain,
-                         mAzBeamwidth * UtMath::cDEG_PER_RAD,
-                         mElBeamwidth * UtMath::cDEG_PER_RAD,
-                         0.0,
-                         mSineAngleModificationFactor,
-                         mSineFunctionType);
+      gain = AnalyticGain(aTargetAz, aTargetEl);
       break;
    case cUNIFORM_PATTERN:
       gain = mPeakGain;
@@ -256,7 +269,7 @@ void WsfStandardAntennaPattern::StandardData::ProcessCircularInput(WsfAntennaPat
          aInput.PushBack(command);
          break;
       }
-      else if (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput))
+      else if ((!ProcessEvaluationInput(aInput)) && (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput)))
       {
          throw UtInput::UnknownCommand(aInput);
       }
@@ -316,7 +329,7 @@ void WsfStandardAntennaPattern::StandardData::ProcessCosecantSquaredInput(WsfAnt
          aInput.PushBack(command);
          break;
       }
-      else if (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput))
+      else if ((!ProcessEvaluationInput(aInput)) && (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput)))
       {
          throw UtInput::UnknownCommand(aInput);
       }
@@ -479,7 +492,7 @@ void WsfStandardAntennaPattern::StandardData::ProcessSineInput(WsfAntennaPattern
          aInput.PushBack(command);
          break;
       }
-      else if (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput))
+      else if ((!ProcessEvaluationInput(aInput)) && (!WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput)))
       {
          throw UtInput::UnknownCommand(aInput);
       }
@@ -578,22 +591,11 @@ double WsfStandardAntennaPattern::StandardData::BesselJ1(double aX)
 
 double WsfStandardAntennaPattern::StandardData::CosecantSquaredPattern(double aAzimuth, double aElevation)
 {
-   static const double cCONST_T1 = 2.78;
-   static const double cCONST_T2 = 0.230258;
-
    // Perform first time calculations
 
    if (mFirstTime)
    {
-      mFirstTime              = false;
-      mCscK_Az                = cCONST_T1 / mAzBeamwidth;
-      mCscK_El                = cCONST_T1 / mElBeamwidth;
-      mCscMinimumGainAdjusted = exp(cCONST_T2 * 10.0 * log10(mMinimumGain));
-      mCscPeakGainAdjusted    = exp(cCONST_T2 * 10.0 * log10(mPeakGain));
-      double sinx             = sin(mCscElOfPeakCsc2Boundary);
-      mCscWithinCsc2Factor    = mCscPeakGainAdjusted * (sinx * sinx);
-      sinx                    = sin(mCscMaxElForCsc2);
-      mCscAboveCsc2Factor     = mCscWithinCsc2Factor / (sinx * sinx);
+      ComputeCosecantSquaredFactors();
    }
 
    // Compute azimuth dependent gain distribution
@@ -601,9 +603,7 @@ double WsfStandardAntennaPattern::StandardData::CosecantSquaredPattern(double aA
    double azGain = 1.0; // gain when azimuth == 0.0
    if (aAzimuth != 0.0)
    {
-      double x           = mCscK_Az * aAzimuth;
-      double sinx_over_x = sin(x) / x;
-      azGain             = sinx_over_x * sinx_over_x;
+      azGain = SincSquared(mCscK_Az * aAzimuth);
    }
 
    // Compute elevation dependent gain distribution
@@ -612,10 +612,8 @@ double WsfStandardAntennaPattern::StandardData::CosecantSquaredPattern(double aA
    if (aElevation < mCscMinElForPeakGain)
    {
       // Elevation is below the peak gain region
-      double ee          = aElevation - mCscMinElForPeakGain;
-      double x           = mCscK_El * ee;
-      double sinx_over_x = sin(x) / x;
-      elGain             = (sinx_over_x * sinx_over_x) * mCscPeakGainAdjusted;
+      double ee = aElevation - mCscMinElForPeakGain;
+      elGain    = SincSquared(mCscK_El * ee) * mCscPeakGainAdjusted;
    }
    else if (aElevation < mCscElOfPeakCsc2Boundary)
    {
@@ -631,10 +629,8 @@ double WsfStandardAntennaPattern::StandardData::CosecantSquaredPattern(double aA
    else
    {
       // Elevation is above the cosecant^2 region
-      double ee          = aElevation - mCscMaxElForCsc2;
-      double x           = mCscK_El * ee;
-      double sinx_over_x = sin(x) / x;
-      elGain             = (sinx_over_x * sinx_over_x) * mCscAboveCsc2Factor;
+      double ee = aElevation - mCscMaxElForCsc2;
+      elGain    = SincSquared(mCscK_El * ee) * mCscAboveCsc2Factor;
    }
 
    // Compute the total gain
@@ -642,6 +638,36 @@ double WsfStandardAntennaPattern::StandardData::CosecantSquaredPattern(double aA
    return gain;
 }
 
+//! Compute the derived values of the cosecant squared pattern.
+// protected
+void WsfStandardAntennaPattern::StandardData::ComputeCosecantSquaredFactors()
+{
+   static const double cCONST_T1 = 2.78;
+   static const double cCONST_T2 = 0.230258;
+
+   mCscK_Az                = cCONST_T1 / mAzBeamwidth;
+   mCscK_El                = cCONST_T1 / mElBeamwidth;
+   mCscMinimumGainAdjusted = exp(cCONST_T2 * 10.0 * log10(mMinimumGain));
+   mCscPeakGainAdjusted    = exp(cCONST_T2 * 10.0 * log10(mPeakGain));
+   double sinx             = sin(mCscElOfPeakCsc2Boundary);
+   mCscWithinCsc2Factor    = mCscPeakGainAdjusted * (sinx * sinx);
+   sinx                    = sin(mCscMaxElForCsc2);
+   mCscAboveCsc2Factor     = mCscWithinCsc2Factor / (sinx * sinx);
+   mFirstTime              = false;
+}
+
+//! Return (sin(x)/x)^2, from the table if it has been built.
+// protected
+double WsfStandardAntennaPattern::StandardData::SincSquared(double aX) const
+{
+   if (mSincSquaredTable.IsValid())
+   {
+      return mSincSquaredTable.Evaluate(fabs(aX));
+   }
+   double sinx_over_x = sin(aX) / aX;
+   return sinx_over_x * sinx_over_x;
+}
+
 //! Get gain from a uniformly illuminated circular aperture.
 //!
 //! @param aAzimuth Azimuth angle for lookup.
@@ -687,70 +713,405 @@ double WsfStandardAntennaPattern::StandardData::SinePattern(double aAzimuth,
                                                             double aFact,
                                                             int    aType)
 {
-   // amagic converts radians to degrees and multiplies by:
-   //  2 to get the full beam width
-   //  1.616 which is the value of X where 2*BesselJ1(X)/X = .707
-   // bmajic converts radians to degrees and multiplies by:
-   //  2 to get full beam width
-   //  1.393 which is the value of X where sin(X)/X = .707
+   double gain = aPeakGain;
+   double oel  = aElevation - aOffset; // * DEGRAD
+   if ((aAzimuth != 0.0) || (oel != 0.0))
+   {
+      double tang = SineNormalizedAngle(aAzimuth,
+                                        aElevation,
+                                        aAzimuthBeamwidth,
+                                        aElevationBeamwidth,
+                                        aOffset,
+                                        aFact,
+                                        aType);
+      gain        = aPeakGain * SineGainFactor(tang, aType);
+   }
+   return gain;
+}
 
-   static const double amagic = 185.17995;
-   static const double bmagic = 159.626;
+//! Return the argument of the gain function of the sine pattern (the normalized angle off boresight).
+//! The arguments are the same as those of SinePattern.
+// static
+double WsfStandardAntennaPattern::StandardData::SineNormalizedAngle(double aAzimuth,
+                                                                    double aElevation,
+                                                                    double aAzimuthBeamwidth,
+                                                                    double aElevationBeamwidth,
+                                                                    double aOffset,
+                                                                    double aFact,
+                                                                    int    aType)
+{
+   double taz  = aAzimuth / aFact;
+   double toel = (aElevation - aOffset) / aFact;
 
-   double az     = aAzimuth;
-   double el     = aElevation;
-   double agzero = aPeakGain;
-   double hbw    = aAzimuthBeamwidth;
-   double vbw    = aElevationBeamwidth;
-   double offset = aOffset;
-   double fact   = aFact;
-   int    itype  = aType;
+   double caz = cos(taz);
+   double tel = tan(toel);
 
-   double gain = agzero;
+   double rot = 0.0;
+   if ((caz != 0.0) || (tel != 0.0))
+   {
+      rot = atan2(tel, caz);
+   }
 
-   double oel = el - offset; // * DEGRAD
+   double magic = (aType == 4) ? cSINE_MAGIC_RECTANGULAR : cSINE_MAGIC_CIRCULAR;
+   double t1    = taz / aAzimuthBeamwidth * aFact;
+   double t2    = aFact * rot / aElevationBeamwidth;
+   return magic * sqrt(t1 * t1 + t2 * t2);
+}
 
-   if ((az != 0.0) || (oel != 0.0))
+//! Return the gain of the sine pattern relative to the peak gain.
+//! @param aAngle The normalized angle from SineNormalizedAngle.
+//! @param aType  The function type (4 for rectangular, otherwise circular).
+// static
+double WsfStandardAntennaPattern::StandardData::SineGainFactor(double aAngle, int aType)
+{
+   double factor = 1.0;
+   if (aType == 4)
    {
-      double taz  = az / fact;
-      double toel = oel / fact;
+      // Antenna type = B
+      double t3 = sin(aAngle) / aAngle;
+      factor    = t3 * t3;
+   }
+   else
+   {
+      // Antenna type = A
+      double t3 = 2.0 * BesselJ1(aAngle) / aAngle;
+      factor    = t3 * t3;
 
-      double caz = cos(taz);
-      double tel = tan(toel);
+      // Set the lowest value of X where J1(X) = 0.0.
+      double ttest = 3.832;
 
-      double rot = 0.0;
-      if ((caz != 0.0) || (tel != 0.0))
+      // Check for sidelobe gain.  If so then reduce gain by 6 dB.
+      if (aAngle >= ttest)
       {
-         rot = atan2(tel, caz);
+         factor /= pow(10.0, 6.0 / 10.0);
       }
+   }
+   return factor;
+}
 
-      if (itype == 4)
+// =================================================================================================
+// Tabulated evaluation of the analytic patterns.
+// =================================================================================================
+
+//! Build the table.
+//! The number of intervals is doubled until linear interpolation reproduces the function to within the maximum error
+//! at the midpoint of every interval, or until the table reaches its maximum size.
+//! @param aFunction The function to be tabulated.
+//! @param aMaxX     The largest value of the normalized angle. Larger values are evaluated as aMaxX.
+//! @param aMaxError The maximum absolute interpolation error.
+//! @returns true if the maximum error was achieved.
+bool WsfStandardAntennaPattern::GainTable::Build(const std::function<double(double)>& aFunction,
+                                                 double                               aMaxX,
+                                                 double                               aMaxError)
+{
+   static const size_t cMIN_INTERVALS = 256;
+   static const size_t cMAX_INTERVALS = 65536;
+
+   mMaxX            = std::max(aMaxX, 0.0);
+   size_t intervals = cMIN_INTERVALS;
+   std::vector<double> values(intervals + 1);
+   for (size_t i = 0; i <= intervals; ++i)
+   {
+      values[i] = aFunction(mMaxX * static_cast<double>(i) / static_cast<double>(intervals));
+   }
+
+   bool converged = false;
+   while (true)
+   {
+      // Evaluate the function at the midpoints, which become the new samples if the table must be refined.
+      std::vector<double> midpoints(intervals);
+      double              maxError = 0.0;
+      for (size_t i = 0; i < intervals; ++i)
+      {
+         midpoints[i] = aFunction(mMaxX * (static_cast<double>(i) + 0.5) / static_cast<double>(intervals));
+         maxError     = std::max(maxError, fabs(midpoints[i] - 0.5 * (values[i] + values[i + 1])));
+      }
+      converged = (maxError <= aMaxError);
+      if (converged || (intervals >= cMAX_INTERVALS))
+      {
+         break;
+      }
+
+      std::vector<double> refined(2 * intervals + 1);
+      for (size_t i = 0; i < intervals; ++i)
+      {
+         refined[2 * i]     = values[i];
+         refined[2 * i + 1] = midpoints[i];
+      }
+      refined[2 * intervals] = values[intervals];
+      values.swap(refined);
+      intervals *= 2;
+   }
+
+   mValues = std::move(values);
+   mScale  = (mMaxX > 0.0) ? static_cast<double>(intervals) / mMaxX : 0.0;
+   return converged;
+}
+
+//! Return the value of the function at a normalized angle by linear interpolation.
+double WsfStandardAntennaPattern::GainTable::Evaluate(double aX) const
+{
+   double position = std::min(std::max(aX, 0.0), mMaxX) * mScale;
+   size_t index    = std::min(static_cast<size_t>(position), mValues.size() - 2);
+   double fraction = position - static_cast<double>(index);
+   return mValues[index] + fraction * (mValues[index + 1] - mValues[index]);
+}
+
+//! Return the gain of an analytic pattern before the gain adjustments are applied.
+//! The tables are used if they have been built.
+// protected
+double WsfStandardAntennaPattern::StandardData::AnalyticGain(double aAzimuth, double aElevation)
+{
+   double gain = 1.0;
+   if (mPatternType == cCIRCULAR_PATTERN)
+   {
+      if (mCircularTable.IsValid())
       {
-         // Antenna type = B
-         double t1   = taz / hbw * fact;
-         double t2   = fact * rot / vbw;
-         double tang = bmagic * sqrt(t1 * t1 + t2 * t2);
-         double t3   = sin(tang) / tang;
-         gain        = agzero * t3 * t3;
+         gain = CircularPatternTabulated(aAzimuth, aElevation);
       }
       else
       {
-         // Antenna type = A
-         double t1   = taz / hbw * fact;
-         double t2   = fact * rot / vbw;
-         double tang = amagic * sqrt(t1 * t1 + t2 * t2);
-         double t3   = 2.0 * BesselJ1(tang) / tang;
-         gain        = agzero * t3 * t3;
+         gain = CircularPattern(aAzimuth, aElevation, mPeakGain, mAzBeamwidth * UtMath::cDEG_PER_RAD);
+      }
+   }
+   else if (mPatternType == cCOSECANT_SQUARED_PATTERN)
+   {
+      gain = CosecantSquaredPattern(aAzimuth, aElevation);
+   }
+   else if (mPatternType == cSINE_PATTERN)
+   {
+      if (mSineTable.IsValid())
+      {
+         gain = SinePatternTabulated(aAzimuth, aElevation);
+      }
+      else
+      {
+         gain = SinePattern(aAzimuth,
+                            aElevation,
+                            mPeakGain,
+                            mAzBeamwidth * UtMath::cDEG_PER_RAD,
+                            mElBeamwidth * UtMath::cDEG_PER_RAD,
+                            0.0,
+                            mSineAngleModificationFactor,
+                            mSineFunctionType);
+      }
+   }
+   return gain;
+}
 
-         // Set the lowest value of X where J1(X) = 0.0.
-         double ttest = 3.832;
+//! Get the gain of the circular pattern from the table.
+//! The table is a function of the sine of the angle off boresight, which avoids the inverse cosine of CircularPattern.
+// protected
+double WsfStandardAntennaPattern::StandardData::CircularPatternTabulated(double aAzimuth, double aElevation) const
+{
+   double sinBarg = 1.0; // If azimuth > 90 deg then barg = 90 deg
+   if (fabs(aAzimuth) <= UtMath::cPI_OVER_2)
+   {
+      double cosBarg = cos(aAzimuth) * cos(aElevation);
+      sinBarg        = sqrt(std::max(1.0 - cosBarg * cosBarg, 0.0));
+   }
+   return mCircularTable.Evaluate(sinBarg) * mPeakGain;
+}
 
-         // Check for sidelobe gain.  If so then reduce gain by 6 dB.
-         if (tang >= ttest)
+//! Get the gain of the sine pattern from the table.
+// protected
+double WsfStandardAntennaPattern::StandardData::SinePatternTabulated(double aAzimuth, double aElevation) const
+{
+   if ((aAzimuth == 0.0) && (aElevation == 0.0))
+   {
+      return mPeakGain;
+   }
+   double angle = SineNormalizedAngle(aAzimuth,
+                                      aElevation,
+                                      mAzBeamwidth * UtMath::cDEG_PER_RAD,
+                                      mElBeamwidth * UtMath::cDEG_PER_RAD,
+                                      0.0,
+                                      mSineAngleModificationFactor,
+                                      mSineFunctionType);
+   return mSineTable.Evaluate(angle) * mPeakGain;
+}
+
+//! Build the tables of the analytic pattern if 'gain_evaluation tabulated' is in effect.
+//! The tables are functions of a normalized angle and hold the gain relative to the peak gain.
+// protected
+bool WsfStandardAntennaPattern::StandardData::InitializeTables(WsfAntennaPattern& aAntennaPattern)
+{
+   // The derived values are computed here so they are not computed on first use (possibly by several threads).
+   if (mPatternType == cCOSECANT_SQUARED_PATTERN)
+   {
+      ComputeCosecantSquaredFactors();
+   }
+   if (mGainEvaluation != cTABULATED)
+   {
+      return true;
+   }
+
+   bool converged = true;
+   if (mPatternType == cCIRCULAR_PATTERN)
+   {
+      // With zero elevation the angle off boresight is the azimuth, so the gain at a given sine of the angle is
+      // the gain at the azimuth whose sine it is.
+      double beamwidth = mAzBeamwidth * UtMath::cDEG_PER_RAD;
+      converged        = mCircularTable.Build([beamwidth](double aSinBarg)
+                                              { return CircularPattern(asin(aSinBarg), 0.0, 1.0, beamwidth); },
+                                              1.0,
+                                              mTabulationError);
+   }
+   else if (mPatternType == cCOSECANT_SQUARED_PATTERN)
+   {
+      double maxElOffset = UtMath::cPI_OVER_2 + std::max(fabs(mCscMinElForPeakGain), fabs(mCscMaxElForCsc2));
+      double maxX        = std::max(mCscK_Az * UtMath::cPI, mCscK_El * maxElOffset);
+      converged          = mSincSquaredTable.Build(
+         [](double aX)
          {
-            gain /= pow(10.0, 6.0 / 10.0);
-         }
+            double sinx_over_x = (aX != 0.0) ? (sin(aX) / aX) : 1.0;
+            return sinx_over_x * sinx_over_x;
+         },
+         maxX,
+         mTabulationError);
+   }
+   else if (mPatternType == cSINE_PATTERN)
+   {
+      // The largest normalized angle occurs at the largest azimuth and rotation angle (both pi).
+      double magic = (mSineFunctionType == 4) ? cSINE_MAGIC_RECTANGULAR : cSINE_MAGIC_CIRCULAR;
+      double t1    = UtMath::cPI / (mAzBeamwidth * UtMath::cDEG_PER_RAD);
+      double t2    = mSineAngleModificationFactor * UtMath::cPI / (mElBeamwidth * UtMath::cDEG_PER_RAD);
+      int    type  = mSineFunctionType;
+      converged    = mSineTable.Build([type](double aAngle)
+                                      { return (aAngle > 0.0) ? SineGainFactor(aAngle, type) : 1.0; },
+                                      magic * sqrt(t1 * t1 + t2 * t2),
+                                      mTabulationError);
+   }
+   else
+   {
+      return true;
+   }
+
+   if (!converged)
+   {
+      auto out = ut::log::warning() << "Antenna pattern table does not achieve the requested tabulation_error.";
+      out.AddNote() << "Antenna Pattern: " << aAntennaPattern.GetType();
+      out.AddNote() << "Tabulation Error: " << mTabulationError;
+   }
+   if (mValidateTabulation)
+   {
+      ValidateTables(aAntennaPattern);
+   }
+   return true;
+}
+
+//! Compare the tabulated pattern to the exact pattern and write the largest difference.
+//! The pattern is sampled over the sphere and more finely along the principal planes so the main lobe and near
+//! sidelobes of narrow beams are resolved.
+// protected
+void WsfStandardAntennaPattern::StandardData::ValidateTables(WsfAntennaPattern& aAntennaPattern)
+{
+   std::vector<std::pair<double, double>> points;
+   double                                 step    = 0.25 * UtMath::cRAD_PER_DEG;
+   int                                    azCount = static_cast<int>(UtMath::cTWO_PI / step);
+   int                                    elCount = static_cast<int>(UtMath::cPI / step);
+   for (int i = 0; i <= azCount; ++i)
+   {
+      for (int j = 0; j <= elCount; ++j)
+      {
+         points.emplace_back(-UtMath::cPI + i * step, -UtMath::cPI_OVER_2 + j * step);
       }
    }
-   return gain;
+   double fineStep = std::max(0.01 * std::min(mAzBeamwidth, mElBeamwidth), 0.001 * UtMath::cRAD_PER_DEG);
+   azCount         = static_cast<int>(UtMath::cTWO_PI / fineStep);
+   elCount         = static_cast<int>(UtMath::cPI / fineStep);
+   for (int i = 0; i <= azCount; ++i)
+   {
+      points.emplace_back(-UtMath::cPI + i * fineStep, 0.0);
+   }
+   for (int j = 0; j <= elCount; ++j)
+   {
+      points.emplace_back(0.0, -UtMath::cPI_OVER_2 + j * fineStep);
+   }
+
+   std::vector<double> tabulatedGains(points.size());
+   for (size_t i = 0; i < points.size(); ++i)
+   {
+      tabulatedGains[i] = AnalyticGain(points[i].first, points[i].second);
+   }
+
+   // Move the tables aside to evaluate the exact pattern, and then restore them.
+   GainTable circularTable;
+   GainTable sineTable;
+   GainTable sincSquaredTable;
+   std::swap(circularTable, mCircularTable);
+   std::swap(sineTable, mSineTable);
+   std::swap(sincSquaredTable, mSincSquaredTable);
+   double maxError = 0.0;
+   size_t maxIndex = 0;
+   for (size_t i = 0; i < points.size(); ++i)
+   {
+      double error = fabs(AnalyticGain(points[i].first, points[i].second) - tabulatedGains[i]) / mPeakGain;
+      if (error > maxError)
+      {
+         maxError = error;
+         maxIndex = i;
+      }
+   }
+   std::swap(circularTable, mCircularTable);
+   std::swap(sineTable, mSineTable);
+   std::swap(sincSquaredTable, mSincSquaredTable);
+
+   size_t tableSize = mCircularTable.GetSize() + mSineTable.GetSize() + mSincSquaredTable.GetSize();
+   if (maxError <= mTabulationError)
+   {
+      auto out = ut::log::info() << "Tabulated antenna pattern validated.";
+      out.AddNote() << "Antenna Pattern: " << aAntennaPattern.GetType();
+      out.AddNote() << "Table Size: " << tableSize;
+      out.AddNote() << "Maximum Error: " << maxError;
+   }
+   else
+   {
+      auto out = ut::log::warning() << "Tabulated antenna pattern exceeds the tabulation_error.";
+      out.AddNote() << "Antenna Pattern: " << aAntennaPattern.GetType();
+      out.AddNote() << "Table Size: " << tableSize;
+      out.AddNote() << "Maximum Error: " << maxError;
+      out.AddNote() << "Tabulation Error: " << mTabulationError;
+      out.AddNote() << "Azimuth: " << points[maxIndex].first * UtMath::cDEG_PER_RAD << " deg";
+      out.AddNote() << "Elevation: " << points[maxIndex].second * UtMath::cDEG_PER_RAD << " deg";
+   }
+}
+
+//! Process the commands that select how the analytic patterns are evaluated.
+// protected
+bool WsfStandardAntennaPattern::StandardData::ProcessEvaluationInput(UtInput& aInput)
+{
+   bool        myCommand = true;
+   std::string command(aInput.GetCommand());
+   if (command == "gain_evaluation")
+   {
+      std::string evaluation;
+      aInput.ReadValue(evaluation);
+      if (evaluation == "exact")
+      {
+         mGainEvaluation = cEXACT;
+      }
+      else if (evaluation == "tabulated")
+      {
+         mGainEvaluation = cTABULATED;
+      }
+      else
+      {
+         throw UtInput::BadValue(aInput, "gain_evaluation must be 'exact' or 'tabulated'");
+      }
+   }
+   else if (command == "tabulation_error")
+   {
+      aInput.ReadValue(mTabulationError);
+      aInput.ValueGreater(mTabulationError, 0.0);
+   }
+   else if (command == "validate_tabulation")
+   {
+      aInput.ReadValue(mValidateTabulation);
+   }
+   else
+   {
+      myCommand = false;
+   }
+   return myCommand;
 }
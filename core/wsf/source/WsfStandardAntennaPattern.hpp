@@ -14,7 +14,9 @@
 
 #include "wsf_export.h"
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 class UtAzElTable;
 #include "WsfAntennaPattern.hpp"
@@ -41,6 +43,33 @@ public:
       cUNIFORM_PATTERN
    };
 
+   //! The method used to evaluate the analytic patterns.
+   enum GainEvaluation
+   {
+      cEXACT,    //!< Evaluate the analytic functions for every call.
+      cTABULATED //!< Interpolate tables of the analytic functions that are built during initialization.
+   };
+
+   //! A function of a normalized angle (in the range [0, max]), sampled at uniform intervals for linear interpolation.
+   class WSF_EXPORT GainTable
+   {
+   public:
+      bool Build(const std::function<double(double)>& aFunction, double aMaxX, double aMaxError);
+
+      double Evaluate(double aX) const;
+
+      //! Has the table been built?
+      bool IsValid() const { return !mValues.empty(); }
+
+      //! Return the number of samples in the table.
+      size_t GetSize() const { return mValues.size(); }
+
+   private:
+      std::vector<double> mValues;
+      double              mMaxX{0.0};
+      double              mScale{0.0};
+   };
+
    class StandardData : public WsfAntennaPattern::BaseData
    {
    public:
@@ -56,6 +85,16 @@ public:
 
       static double BesselJ1(double aX);
 
+      //! @name Evaluation of the analytic patterns.
+      //@{
+      GainEvaluation mGainEvaluation;
+      double         mTabulationError;
+      bool           mValidateTabulation;
+      GainTable      mCircularTable;
+      GainTable      mSineTable;
+      GainTable      mSincSquaredTable;
+      //@}
+
       PatternType  mPatternType;
       UtAzElTable* mTablePtr;
 
@@ -94,8 +133,14 @@ public:
    protected:
       static double CircularPattern(double aAzimuth, double aElevation, double aPeakGain, double aBeamwidth);
 
+      double CircularPatternTabulated(double aAzimuth, double aElevation) const;
+
       double CosecantSquaredPattern(double aAzimuth, double aElevation);
 
+      void ComputeCosecantSquaredFactors();
+
+      double SincSquared(double aX) const;
+
       static double SinePattern(double aAzimuth,
                                 double aElevation,
                                 double aPeakGain,
@@ -105,6 +150,26 @@ public:
                                 double aFact,
                                 int    aType);
 
+      static double SineNormalizedAngle(double aAzimuth,
+                                        double aElevation,
+                                        double aAzimuthBeamwidth,
+                                        double aElevationBeamwidth,
+                                        double aOffset,
+                                        double aFact,
+                                        int    aType);
+
+      static double SineGainFactor(double aAngle, int aType);
+
+      double SinePatternTabulated(double aAzimuth, double aElevation) const;
+
+      double AnalyticGain(double aAzimuth, double aElevation);
+
+      bool InitializeTables(WsfAntennaPattern& aAntennaPattern);
+
+      void ValidateTables(WsfAntennaPattern& aAntennaPattern);
+
+      bool ProcessEvaluationInput(UtInput& aInput);
+
       void ProcessCircularInput(WsfAntennaPattern& aPattern, UtInput& aInput);
       void ProcessCosecantSquaredInput(WsfAntennaPattern& aPattern, UtInput& aInput);
       void ProcessPatternTableInput(WsfAntennaPattern& aPattern, UtInput& aInput);
@@ -152,6 +152,11 @@ bool WsfThermalSystem::ProcessInput(UtInput& aInput)
    return myCommand;
 }
 
+// =================================================================================================
+//! The thermal system is not told about other platforms.
+// virtual
+void WsfThermalSystem::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // =================================================================================================
 //! Given heat transfer to the system, return the new temperature.
 double WsfThermalSystem::TransferHeat(double aSimTime, double aHeatTransfer)
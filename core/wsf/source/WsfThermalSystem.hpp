@@ -99,6 +99,7 @@ public:
 
    bool ProcessInput(UtInput& aInput) override;
    bool Initialize(double aSimTime) override;
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
 
    WsfComponent* CloneComponent() const override { return new WsfThermalSystem(*this); }
 
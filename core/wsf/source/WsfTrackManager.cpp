@@ -73,6 +73,10 @@ WsfTrackManager::WsfTrackManager(const WsfScenario& aScenario)
    , mFusionStrategyPtr(nullptr)
    , mPrototypeFilterPtr(nullptr)
    , mAuxDataFusionRules()
+   , mPurgeSchedule()
+   , mPurgeStates()
+   , mNextPurgeOrder(0)
+   , mPurgeScheduleValid(false)
 {
    auto& correlationTypes(WsfCorrelationStrategyTypes::Get(aScenario));
    mCorrelationStrategyPtr = correlationTypes.Create(correlationTypes.GetDefaultStrategyName());
@@ -116,6 +120,10 @@ WsfTrackManager::WsfTrackManager(const WsfTrackManager& aSrc)
    , mFusionStrategyPtr(aSrc.mFusionStrategyPtr->Clone())
    , mPrototypeFilterPtr(nullptr)
    , mAuxDataFusionRules(aSrc.mAuxDataFusionRules)
+   , mPurgeSchedule()
+   , mPurgeStates()
+   , mNextPurgeOrder(0)
+   , mPurgeScheduleValid(false)
 {
    for (auto initialTrack : aSrc.mInitialTracks)
    {
@@ -369,6 +377,104 @@ bool WsfTrackManager::Initialize(double aSimTime, WsfPlatform* aPlatformPtr)
 //! @note Observers are notified of any local track drops that are the result of purging.
 // virtual
 void WsfTrackManager::PurgeInactiveTracks(double aSimTime, double aInactivityTimeLimit)
+{
+   if (mDebug)
+   {
+      PurgeInactiveTracksDebug(aSimTime, aInactivityTimeLimit);
+      return;
+   }
+   if (!mPurgeScheduleValid)
+   {
+      RebuildPurgeSchedule();
+   }
+
+   // Remove the entries for tracks that may be inactive from the schedule. Entries for tracks that have been
+   // updated since they were scheduled are rescheduled; the rest are candidates for purging.
+   std::vector<std::pair<unsigned int, WsfTrackId>> candidates;
+   std::vector<PurgeEntry>                          deferred;
+   while ((!mPurgeSchedule.empty()) && (mPurgeSchedule.top().mUpdateTime + aInactivityTimeLimit < aSimTime))
+   {
+      PurgeEntry entry = mPurgeSchedule.top();
+      mPurgeSchedule.pop();
+      auto stateIter = mPurgeStates.find(entry.mTrackId);
+      if ((stateIter == mPurgeStates.end()) || (stateIter->second.mGeneration != entry.mGeneration))
+      {
+         continue; // Superseded by a later entry
+      }
+      WsfLocalTrack* trackPtr = mTrackList->FindTrack(entry.mTrackId);
+      if (trackPtr == nullptr)
+      {
+         mPurgeStates.erase(stateIter); // The track has been deleted
+         continue;
+      }
+
+      entry.mUpdateTime             = trackPtr->GetUpdateTime();
+      stateIter->second.mUpdateTime = entry.mUpdateTime;
+      bool inactive                 = (entry.mUpdateTime + aInactivityTimeLimit < aSimTime);
+      if (inactive && trackPtr->IsPurgeable())
+      {
+         candidates.emplace_back(stateIter->second.mOrder, entry.mTrackId);
+      }
+      else if (inactive)
+      {
+         deferred.push_back(entry); // Non-purgeable, but must be checked again on the next purge.
+      }
+      else
+      {
+         mPurgeSchedule.push(entry);
+      }
+   }
+
+   // Process the candidates in track list order, which is the order in which they would have been found by
+   // iterating over the track list.
+   std::sort(candidates.begin(), candidates.end());
+   for (const auto& candidate : candidates)
+   {
+      const WsfTrackId& trackId   = candidate.second;
+      auto              stateIter = mPurgeStates.find(trackId);
+      WsfLocalTrack*    trackPtr  = mTrackList->FindTrack(trackId);
+      if ((trackPtr == nullptr) || (stateIter == mPurgeStates.end()))
+      {
+         mPurgeStates.erase(trackId); // Deleted by an observer of an earlier drop
+         continue;
+      }
+
+      if (trackPtr->IsPurgeable() && (trackPtr->GetUpdateTime() + aInactivityTimeLimit < aSimTime) &&
+          (trackPtr->GetUseCount() == 0))
+      {
+         NotifyOfLocalTrackDropped(aSimTime, trackPtr);
+         if (!mRetainRawTracks)
+         {
+            DeleteCorrelatedRawTracks(aSimTime, *trackPtr);
+         }
+         mPurgeStates.erase(trackId);
+         mTrackList->DeleteTrack(trackId);
+      }
+      else
+      {
+         if (trackPtr->IsPurgeable() && (trackPtr->GetUpdateTime() + aInactivityTimeLimit < aSimTime))
+         {
+            trackPtr->SetStale(true); // Not dropped because of a non-zero use count.
+         }
+         // Observers of an earlier drop may have rescheduled the track, so supersede any other entry.
+         PurgeState& state = stateIter->second;
+         ++state.mGeneration;
+         state.mUpdateTime = trackPtr->GetUpdateTime();
+         deferred.push_back(PurgeEntry{state.mUpdateTime, state.mGeneration, trackId});
+      }
+   }
+
+   for (const PurgeEntry& entry : deferred)
+   {
+      mPurgeSchedule.push(entry);
+   }
+}
+
+// -------------------------------------------------------------------------------------------------
+//! The implementation of PurgeInactiveTracks when debug output is enabled.
+//! This examines every local track so the disposition of each track can be written.
+// private
+void WsfTrackManager::PurgeInactiveTracksDebug(double aSimTime, double aInactivityTimeLimit)
 {
    unsigned int trackIndex = 0;
    while (trackIndex < mTrackList->GetTrackCount())
@@ -425,6 +531,55 @@ void WsfTrackManager::PurgeInactiveTracks(double aSimTime, double aInactivityTim
    }
 }
 
+// -------------------------------------------------------------------------------------------------
+//! Rebuild the inactive track purge schedule from the local track list.
+// private
+void WsfTrackManager::RebuildPurgeSchedule()
+{
+   mPurgeSchedule = std::priority_queue<PurgeEntry>();
+   mPurgeStates.clear();
+   mNextPurgeOrder     = 0;
+   mPurgeScheduleValid = true;
+   for (unsigned int i = 0; i < mTrackList->GetTrackCount(); ++i)
+   {
+      SchedulePurge(*mTrackList->GetTrackEntry(i));
+   }
+}
+
+// -------------------------------------------------------------------------------------------------
+//! Add a track that has just been appended to the local track list to the purge schedule.
+// private
+void WsfTrackManager::SchedulePurge(const WsfLocalTrack& aLocalTrack)
+{
+   if (mPurgeScheduleValid)
+   {
+      PurgeState& state = mPurgeStates[aLocalTrack.GetTrackId()];
+      state.mOrder      = mNextPurgeOrder++;
+      ++state.mGeneration; // Supersedes any entry left by a deleted track with the same ID
+      state.mUpdateTime = aLocalTrack.GetUpdateTime();
+      mPurgeSchedule.push(PurgeEntry{state.mUpdateTime, state.mGeneration, aLocalTrack.GetTrackId()});
+   }
+}
+
+// -------------------------------------------------------------------------------------------------
+//! Reschedule a local track whose update time has moved earlier than the time at which it is scheduled.
+//! (Later update times are handled when the existing entry reaches the top of the schedule.)
+//! This must be called whenever the update time of a local track is changed outside of a track manager update.
+void WsfTrackManager::ReschedulePurge(const WsfLocalTrack& aLocalTrack)
+{
+   if (mPurgeScheduleValid)
+   {
+      auto stateIter = mPurgeStates.find(aLocalTrack.GetTrackId());
+      if ((stateIter != mPurgeStates.end()) && (aLocalTrack.GetUpdateTime() < stateIter->second.mUpdateTime))
+      {
+         PurgeState& state = stateIter->second;
+         ++state.mGeneration;
+         state.mUpdateTime = aLocalTrack.GetUpdateTime();
+         mPurgeSchedule.push(PurgeEntry{state.mUpdateTime, state.mGeneration, aLocalTrack.GetTrackId()});
+      }
+   }
+}
+
 // -------------------------------------------------------------------------------------------------
 //! Purge inactive raw tracks.
 //! This method purges inactive raw tracks.  A raw track is declared inactive after when it hasn't been
@@ -907,6 +1062,7 @@ WsfLocalTrack* WsfTrackManager::AddTrack(double aSimTime, const WsfTrack& aTrack
       trackPtr->MergeAuxData(aTrack);
    }
    mTrackList->AddTrack(std::move(trackUP));
+   SchedulePurge(*trackPtr);
 
    // This can get called via Initialize2 when initializing a track manager for platform that is
    // a 'deferred platform'. While not strictly necessary, this
@@ -1064,6 +1220,7 @@ void WsfTrackManager::NotifyOfLocalTrackUpdated(double               aSimTime,
                                                 const WsfLocalTrack* aLocalTrackPtr,
                                                 const WsfTrack*      aRawTrackPtr)
 {
+   ReschedulePurge(*aLocalTrackPtr);
    WsfObserver::LocalTrackUpdated(GetSimulation())(aSimTime, GetPlatform(), aLocalTrackPtr, aRawTrackPtr);
    LocalTrackUpdated(aSimTime, aLocalTrackPtr, aRawTrackPtr);
 }
@@ -1215,6 +1372,7 @@ WsfLocalTrack* WsfTrackManager::InitiateTrackP(double aSimTime, const WsfTrack&
 
    auto* tempPtr = localTrackPtr.get();
    mTrackList->AddTrack(std::move(localTrackPtr));
+   SchedulePurge(*tempPtr);
    return tempPtr;
 }
 
@@ -16,7 +16,10 @@
 
 #include <map>
 #include <memory>
+#include <queue>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "UtCallback.hpp"
 class UtInput;
@@ -126,6 +129,8 @@ public:
    //@{
    virtual void PurgeInactiveTracks(double aSimTime, double aInactivityTimeLimit);
 
+   void ReschedulePurge(const WsfLocalTrack& aLocalTrack);
+
    virtual void PurgeInactiveRawTracks(double aSimTime, double aInactivityTimeLimit, double aStaticInactivityTimeLimit);
 
    virtual void PurgeLocalTrackHistory(double aSimTime, double aKeepTimeInterval);
@@ -374,6 +379,32 @@ private:
 
    void ProcessAuxDataFusionInput(UtInput& aInput);
 
+   //! @name Inactive track purge schedule.
+   //@{
+   //! An entry in the purge schedule.
+   struct PurgeEntry
+   {
+      //! Entries are ordered so the one with the earliest update time is at the top of the priority queue.
+      bool operator<(const PurgeEntry& aRhs) const { return mUpdateTime > aRhs.mUpdateTime; }
+
+      double       mUpdateTime; //!< The update time of the track when the entry was scheduled.
+      unsigned int mGeneration; //!< The entry is current only if this matches the track's PurgeState.
+      WsfTrackId   mTrackId;
+   };
+
+   //! The purge schedule state of a local track.
+   struct PurgeState
+   {
+      unsigned int mOrder;      //!< Increases with the position of the track in the track list.
+      unsigned int mGeneration; //!< Incremented when the track is rescheduled, to supersede the existing entry.
+      double       mUpdateTime; //!< The update time of the current entry.
+   };
+
+   void PurgeInactiveTracksDebug(double aSimTime, double aInactivityTimeLimit);
+   void RebuildPurgeSchedule();
+   void SchedulePurge(const WsfLocalTrack& aLocalTrack);
+   //@}
+
    const WsfScenario& mScenario;
 
    //! The platform to which the track manager is attached.
@@ -426,6 +457,16 @@ private:
    WsfFilter*              mPrototypeFilterPtr;
 
    AuxDataFusionRules mAuxDataFusionRules;
+
+   //! The local tracks ordered by the update time at which they were last scheduled.
+   //! Entries are not moved when a track is updated; an entry that reaches the top of the queue for a track that
+   //! has since been updated is simply rescheduled at the new update time. A track is explicitly rescheduled only
+   //! if an update (or script) moves its update time backward. The schedule is built by the first call to
+   //! PurgeInactiveTracks, so track managers that are never purged do not maintain it.
+   std::priority_queue<PurgeEntry>                         mPurgeSchedule;
+   std::unordered_map<WsfTrackId, PurgeState, WsfTrackId> mPurgeStates;
+   unsigned int                                            mNextPurgeOrder;
+   bool                                                    mPurgeScheduleValid;
 };
 
 WSF_DECLARE_COMPONENT_ROLE_TYPE(WsfTrackManager, cWSF_COMPONENT_TRACK_MANAGER)
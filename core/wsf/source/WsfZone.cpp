@@ -11,12 +11,20 @@
 
 #include "WsfZone.hpp"
 
+#include <atomic>
+
 #include "UtInput.hpp"
 #include "UtMath.hpp"
 #include "UtMemory.hpp"
 #include "WsfGeoPoint.hpp"
 #include "WsfPlatform.hpp"
 
+namespace
+{
+//! Incremented whenever the shape of any zone changes (see WsfZone::GetGeometryChangeCount).
+std::atomic<unsigned int> sGeometryChangeCount(0);
+} // namespace
+
 // =================================================================================================
 WsfZone::WsfZone()
    : WsfObject()
@@ -33,6 +41,7 @@ WsfZone::WsfZone()
    , mCentroid(0.0, 0.0)
    , mIsInitialized(false)
    , mGlobalName(nullptr)
+   , mShapeChangeCount(0)
 {
 }
 
@@ -55,6 +64,7 @@ WsfZone::WsfZone(const WsfZone& aSrc)
    , mGlobalName(aSrc.mGlobalName)
    , mFillColor(aSrc.mFillColor)
    , mLineColor(aSrc.mLineColor)
+   , mShapeChangeCount(aSrc.mShapeChangeCount.load())
 {
 }
 
@@ -166,6 +176,74 @@ bool WsfZone::PointIsInside(WsfSimulation* aSimulationPtr,
    return false;
 }
 
+// =================================================================================================
+//! Which of a set of points are inside the zone?
+//!
+//! This is equivalent to calling PointIsInside() for each point, but derived classes may share work that
+//! depends only on the eye point (or the zone's reference point) across the points.
+//!
+//! @param aSimulationPtr   the simulation
+//! @param aViewedPointsWCS the points which are being tested for containment in the zone.
+//! @param aEyePointWCS     is the potential reference point for a relative Zone.
+//! @param aLookHeading     the current heading (for relative references)
+//! @param aInside          [output] 'true' for each point that is inside the zone or 'false' otherwise.
+//! @param aDeltaDownRange  is an (optional) delta to slide the Zone away from the eyepoint.
+// virtual
+void WsfZone::PointsAreInside(WsfSimulation*              aSimulationPtr,
+                              const std::vector<UtVec3d>& aViewedPointsWCS,
+                              const double                aEyePointWCS[3],
+                              double                      aLookHeading,
+                              std::vector<bool>&          aInside,
+                              double                      aDeltaDownRange)
+{
+   aInside.resize(aViewedPointsWCS.size());
+   for (size_t i = 0; i < aViewedPointsWCS.size(); ++i)
+   {
+      aInside[i] =
+         PointIsInside(aSimulationPtr, aViewedPointsWCS[i].GetData(), aEyePointWCS, aLookHeading, aDeltaDownRange);
+   }
+}
+
+// =================================================================================================
+//! Get a latitude/longitude box that contains every point for which PointIsInside() can return 'true',
+//! regardless of the eye point or the location of a reference platform.
+//!
+//! This is used by zone sets to avoid testing members that cannot contain a point.
+//! @returns 'true' if the zone has such bounds, or 'false' if it does not (the box is not valid).
+// virtual
+bool WsfZone::GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const
+{
+   return false;
+}
+
+// =================================================================================================
+//! Get a count that changes whenever the shape of any zone changes (and therefore possibly its inclusion bounds).
+//! Zone definitions may be shared through WsfZoneReference and changed by script during the simulation, so
+//! anything that retains the bounds of a zone should compare this with the count at which they were retained.
+// static
+unsigned int WsfZone::GetGeometryChangeCount()
+{
+   return sGeometryChangeCount.load(std::memory_order_acquire);
+}
+
+// =================================================================================================
+//! Get a count that changes whenever the shape of this zone changes.
+//! Unlike GetGeometryChangeCount, this can be used to determine if a particular zone has changed.
+// virtual
+unsigned int WsfZone::GetShapeChangeCount() const
+{
+   return mShapeChangeCount.load(std::memory_order_acquire);
+}
+
+// =================================================================================================
+//! Derived classes must call this whenever the shape of the zone changes.
+// protected
+void WsfZone::GeometryChanged()
+{
+   mShapeChangeCount.fetch_add(1, std::memory_order_acq_rel);
+   sGeometryChangeCount.fetch_add(1, std::memory_order_acq_rel);
+}
+
 // =================================================================================================
 // virtual
 double WsfZone::Area()
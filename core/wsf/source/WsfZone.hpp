@@ -14,6 +14,7 @@
 
 #include "wsf_export.h"
 
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -21,6 +22,7 @@
 class UtInput;
 class UtInputBlock;
 #include "UtOptional.hpp"
+#include "UtVec3.hpp"
 #include "WsfAuxDataEnabled.hpp"
 #include "WsfComponent.hpp"
 class WsfDraw;
@@ -111,6 +113,18 @@ public:
                               const double   aLookHeading,
                               const double   aDeltaDownRange = 0.0);
 
+   virtual void PointsAreInside(WsfSimulation*              aSimulationPtr,
+                                const std::vector<UtVec3d>& aViewedPointsWCS,
+                                const double                aEyePointWCS[3],
+                                double                      aLookHeading,
+                                std::vector<bool>&          aInside,
+                                double                      aDeltaDownRange = 0.0);
+
+   virtual bool GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const;
+
+   static unsigned int  GetGeometryChangeCount();
+   virtual unsigned int GetShapeChangeCount() const;
+
    virtual double CheckIntersections(const double aLLA1[3], const double aLLA2[3]) { return 0.0; }
 
    virtual bool GetLatLonExtrema(double& aSouthernLat, double& aWesternLon, double& aNorthernLat, double& aEasternLon) const;
@@ -161,6 +175,8 @@ protected:
    //! Copy constructor (for Clone()).
    WsfZone(const WsfZone& aSrc);
 
+   void GeometryChanged();
+
    WsfPlatform* mPlatformPtr;
 
    std::map<WsfStringId, double> mModifierList;
@@ -182,6 +198,9 @@ private:
    WsfStringId           mGlobalName;
    ut::optional<UtColor> mFillColor;
    ut::optional<UtColor> mLineColor;
+
+   //! Incremented whenever the shape of this zone changes (see GetShapeChangeCount).
+   std::atomic<unsigned int> mShapeChangeCount;
 };
 
 WSF_DECLARE_COMPONENT_ROLE_TYPE(WsfZone, cWSF_COMPONENT_ZONE)
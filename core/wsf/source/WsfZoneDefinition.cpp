@@ -17,6 +17,7 @@
 
 #include "WsfZoneDefinition.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 #include "UtEllipsoidalEarth.hpp"
@@ -39,6 +40,28 @@ namespace
 {
 constexpr double cNEAR_ZERO = std::numeric_limits<double>::epsilon();
 
+//! The minimum number of vertices for which a polygon grid is built.
+constexpr size_t cGRID_MIN_POINT_COUNT = 16;
+//! The maximum number of grid cells along each axis.
+constexpr size_t cGRID_MAX_CELL_COUNT = 128;
+
+//! Polygon grid cell states.
+constexpr char cGRID_UNKNOWN = 0; //!< Only while the grid is being built
+constexpr char cGRID_OUTSIDE = 1;
+constexpr char cGRID_INSIDE  = 2;
+constexpr char cGRID_EDGE    = 3; //!< An edge passes through the cell
+
+//! Return the index of the grid cell along an axis that contains the specified value.
+size_t GridCellIndex(double aValue, double aMinValue, double aCellSize, size_t aCellCount)
+{
+   double index = std::floor((aValue - aMinValue) / aCellSize);
+   if (index <= 0.0)
+   {
+      return 0;
+   }
+   return std::min(static_cast<size_t>(index), aCellCount - 1);
+}
+
 std::string ShapeToString(WsfZoneDefinition::ShapeType aShape)
 {
    switch (aShape)
@@ -85,6 +108,9 @@ WsfZoneDefinition::WsfZoneDefinition()
    , mRefZonePtr(nullptr)
    , mZoneIndex(0)
    , mDebugEnabled(false)
+   , mReferenceFrame()
+   , mReferenceFrameValid(false)
+   , mPolygonGrid()
 {
    mReferenceWCS[0] = cUNSPECIFIED;
    mReferenceWCS[1] = cUNSPECIFIED;
@@ -116,6 +142,9 @@ WsfZoneDefinition::WsfZoneDefinition(const WsfZoneDefinition& aSrc)
    , mRefZonePtr(aSrc.mRefZonePtr)
    , mZoneIndex(aSrc.mZoneIndex)
    , mDebugEnabled(aSrc.mDebugEnabled)
+   , mReferenceFrame(aSrc.mReferenceFrame)
+   , mReferenceFrameValid(aSrc.mReferenceFrameValid)
+   , mPolygonGrid(aSrc.mPolygonGrid)
 {
    mReferenceWCS[0] = aSrc.mReferenceWCS[0];
    mReferenceWCS[1] = aSrc.mReferenceWCS[1];
@@ -136,6 +165,80 @@ bool WsfZoneDefinition::PointIsInside(WsfSimulation* aSimulationPtr,
                                       const double   aEyePointWCS[3],
                                       const double   aLookHeading,
                                       const double   aDeltaDownRange)
+{
+   if (!UpdateReferencePlatform(aSimulationPtr))
+   {
+      return false;
+   }
+
+   bool inside = PointIsInsidePrivate(aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange, nullptr);
+   return (mNegative ? !inside : inside);
+}
+
+// =================================================================================================
+// virtual
+void WsfZoneDefinition::PointsAreInside(WsfSimulation*              aSimulationPtr,
+                                        const std::vector<UtVec3d>& aViewedPointsWCS,
+                                        const double                aEyePointWCS[3],
+                                        double                      aLookHeading,
+                                        std::vector<bool>&          aInside,
+                                        double                      aDeltaDownRange)
+{
+   aInside.assign(aViewedPointsWCS.size(), false);
+   if (!UpdateReferencePlatform(aSimulationPtr))
+   {
+      return;
+   }
+
+   // The local frame of an observer-relative zone is the same for every point, so construct it once.
+   UtEntity  observerFrame;
+   UtEntity* observerFramePtr = nullptr;
+   if ((mRelativeTo == cOBSERVER) && (aEyePointWCS[0] != cUNSPECIFIED))
+   {
+      double lat;
+      double lon;
+      double alt;
+      UtEntity::ConvertWCSToLLA(aEyePointWCS, lat, lon, alt);
+      observerFrame.SetLocationLLA(lat, lon, 0.0);
+      observerFrame.SetOrientationNED(aLookHeading, 0.0, 0.0);
+      observerFramePtr = &observerFrame;
+   }
+
+   for (size_t i = 0; i < aViewedPointsWCS.size(); ++i)
+   {
+      bool inside = PointIsInsidePrivate(aViewedPointsWCS[i].GetData(),
+                                         aEyePointWCS,
+                                         aLookHeading,
+                                         aDeltaDownRange,
+                                         observerFramePtr);
+      aInside[i] = (mNegative ? !inside : inside);
+   }
+}
+
+// =================================================================================================
+//! Only a polygon defined by latitude and longitude has bounds that do not depend on the eye point or
+//! the reference point. A negative zone contains everything outside its shape, so it has no bounds.
+//! The zone has no bounds while it is not initialized (e.g. after its shape has been changed by script).
+// virtual
+bool WsfZoneDefinition::GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const
+{
+   if ((!mIsInitialized) || mNegative || (!mPointsAreLatLon) || (mShapeType != cPOLYGONAL) || mPoints.empty() ||
+       (mMinX > mMaxX) || (mMinY > mMaxY))
+   {
+      return false;
+   }
+   aMinLat = mMinX;
+   aMinLon = mMinY;
+   aMaxLat = mMaxX;
+   aMaxLon = mMaxY;
+   return true;
+}
+
+// =================================================================================================
+//! If the zone is relative to another platform, update the reference point to be that platform.
+//! @returns 'false' if the reference platform has never existed (so the zone has no location).
+// private
+bool WsfZoneDefinition::UpdateReferencePlatform(WsfSimulation* aSimulationPtr)
 {
    // If the zone is relative to another platform, define the reference point to be that platform.
    if (mReferencePlatformNameId != 0)
@@ -172,8 +275,7 @@ bool WsfZoneDefinition::PointIsInside(WsfSimulation* aSimulationPtr,
       }
    }
 
-   bool inside = PointIsInsidePrivate(aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange);
-   return (mNegative ? !inside : inside);
+   return true;
 }
 
 // =================================================================================================
@@ -578,9 +680,10 @@ void WsfZoneDefinition::UpdateReference(const WsfSimulation& aSimulation)
    if (!mReferencePlatformNameId.Empty())
    {
       // Clear the reference point
-      mReferenceWCS[0] = cUNSPECIFIED;
-      mReferenceWCS[1] = cUNSPECIFIED;
-      mReferenceWCS[2] = cUNSPECIFIED;
+      mReferenceWCS[0]     = cUNSPECIFIED;
+      mReferenceWCS[1]     = cUNSPECIFIED;
+      mReferenceWCS[2]     = cUNSPECIFIED;
+      mReferenceFrameValid = false;
 
       // Attempt to use the platform index from the last call (if defined).
       // As long as the platform still exists then this is the fastest way to get to the platform.
@@ -713,6 +816,7 @@ void WsfZoneDefinition::SetShapeType(ShapeType aType)
 {
    mIsInitialized = false;
    mShapeType     = aType;
+   GeometryChanged();
 }
 
 // =================================================================================================
@@ -725,6 +829,8 @@ void WsfZoneDefinition::SetRelativeType(RelativeToType aType)
 {
    mIsInitialized = false;
    mRelativeTo    = aType;
+   UpdateReferenceFrame();
+   GeometryChanged();
 }
 
 // =================================================================================================
@@ -840,6 +946,8 @@ void WsfZoneDefinition::SetPolyPoints(const std::vector<WsfGeoPoint>& aPoints)
    mPointsAreLatLon = true;
    mRelativeTo      = cINTERNAL;
    mPoints.clear();
+   mPolygonGrid = PolygonGrid();
+   GeometryChanged();
 
    if (aPoints.empty())
    {
@@ -857,6 +965,7 @@ void WsfZoneDefinition::SetPolyPoints(const std::vector<WsfGeoPoint>& aPoints)
       mReferenceLon = aPoints[0].GetLon();
       UtEntity::ConvertLLAToWCS(mReferenceLat, mReferenceLon, 0.0, mReferenceWCS);
    }
+   UpdateReferenceFrame();
 
    std::vector<WsfGeoPoint>::const_iterator git = aPoints.begin();
    for (; git != aPoints.end(); ++git)
@@ -897,6 +1006,8 @@ void WsfZoneDefinition::SetPolyPoints(const std::vector<WsfGeoPoint>& aPoints)
 void WsfZoneDefinition::AddPoint(const Point& aPoint)
 {
    mPoints.push_back(aPoint);
+   mPolygonGrid = PolygonGrid();
+   GeometryChanged();
 }
 
 // =================================================================================================
@@ -1411,6 +1522,9 @@ void WsfZoneDefinition::SetPolyPointsRelative(const std::vector<UtVec3d>& aPoint
    mPointsAreLatLon = false;
    mRelativeTo      = cOBSERVER;
    mPoints.clear();
+   mPolygonGrid         = PolygonGrid();
+   mReferenceFrameValid = false;
+   GeometryChanged();
 
    if (aPoints.empty())
    {
@@ -2063,6 +2177,9 @@ void WsfZoneDefinition::Initialize(const WsfScenario& aScenario)
       CalculateArea();
       CalculateCentroid();
    }
+   BuildPolygonGrid();
+   UpdateReferenceFrame();
+
    if (!mModifierList.empty())
    {
       if (!mPointsAreLatLon)
@@ -2178,10 +2295,39 @@ void WsfZoneDefinition::SetReference(double aReferenceLat,
    // This method relocates a relative Zone:
    // (mRelativeTo == cINTERNAL has already been verified)
 
+   bool changed = (aReferenceHeading != mReferenceHeading) || (!UtVec3d::Equals(aReferenceWCS, mReferenceWCS));
+
    mReferenceLat     = aReferenceLat;
    mReferenceLon     = aReferenceLon;
    mReferenceHeading = aReferenceHeading;
    UtVec3d::Set(mReferenceWCS, aReferenceWCS);
+   if (changed || (!mReferenceFrameValid))
+   {
+      UpdateReferenceFrame();
+   }
+}
+
+// =================================================================================================
+//! Rebuild the local frame at the reference point, which must be constructed exactly as ConvertWCSToLocalFrame()
+//! would construct it so that the results do not depend on which is used.
+// private
+void WsfZoneDefinition::UpdateReferenceFrame()
+{
+   mReferenceFrameValid = (mRelativeTo == cINTERNAL) && (mReferenceWCS[0] != cUNSPECIFIED);
+   if (mReferenceFrameValid)
+   {
+      double lat;
+      double lon;
+      double alt;
+      UtEntity::ConvertWCSToLLA(mReferenceWCS, lat, lon, alt);
+      mReferenceFrame.SetLocationLLA(lat, lon, 0.0);
+      mReferenceFrame.SetOrientationNED(mReferenceHeading, 0.0, 0.0);
+
+      // Force the frame transforms to be computed now. Later conversions then only read the frame,
+      // so a zone that is shared between threads may be queried concurrently.
+      double notUsed[3];
+      mReferenceFrame.ConvertWCSToECS(mReferenceWCS, notUsed);
+   }
 }
 
 // =================================================================================================
@@ -2338,6 +2484,137 @@ bool WsfZoneDefinition::WithinPolygonSides(const double aXorLatValue, const doub
       return false;
    }
 
+   // The full test is required only if an edge passes through the grid cell containing the point.
+   if (!mPolygonGrid.mCells.empty())
+   {
+      size_t ix   = GridCellIndex(aXorLatValue, mPolygonGrid.mMinX, mPolygonGrid.mCellSizeX, mPolygonGrid.mCountX);
+      size_t iy   = GridCellIndex(aYorLonValue, mPolygonGrid.mMinY, mPolygonGrid.mCellSizeY, mPolygonGrid.mCountY);
+      char   cell = mPolygonGrid.mCells[ix * mPolygonGrid.mCountY + iy];
+      if (cell != cGRID_EDGE)
+      {
+         return (cell == cGRID_INSIDE);
+      }
+   }
+   return WithinPolygonSidesExact(aXorLatValue, aYorLonValue);
+}
+
+// =================================================================================================
+//! Build the polygon grid (if the zone is a polygon with enough vertices to benefit from one).
+// private
+void WsfZoneDefinition::BuildPolygonGrid()
+{
+   mPolygonGrid     = PolygonGrid();
+   size_t numPoints = mPoints.size();
+   if ((mShapeType != cPOLYGONAL) || (numPoints < cGRID_MIN_POINT_COUNT) || (mMaxX <= mMinX) || (mMaxY <= mMinY))
+   {
+      return;
+   }
+
+   PolygonGrid grid;
+   size_t      cellCount = static_cast<size_t>(2.0 * std::sqrt(static_cast<double>(numPoints)));
+   cellCount             = std::min(cellCount, cGRID_MAX_CELL_COUNT);
+   grid.mMinX            = mMinX;
+   grid.mMinY            = mMinY;
+   grid.mCountX          = cellCount;
+   grid.mCountY          = cellCount;
+   grid.mCellSizeX       = (mMaxX - mMinX) / cellCount;
+   grid.mCellSizeY       = (mMaxY - mMinY) / cellCount;
+   grid.mCells.assign(grid.mCountX * grid.mCountY, cGRID_UNKNOWN);
+
+   // Mark every cell that an edge passes through. Each edge is divided into pieces no longer than a cell and
+   // the cells overlapped by the (slightly enlarged) bounding box of each piece are marked. This errs on the
+   // side of marking too many cells, so an unmarked cell is guaranteed to be entirely inside or outside.
+   double padX = 1.0E-6 * grid.mCellSizeX + 1.0E-10;
+   double padY = 1.0E-6 * grid.mCellSizeY + 1.0E-10;
+   for (size_t i = 0; i < numPoints; ++i)
+   {
+      const Point& p1 = mPoints[i];
+      const Point& p2 = mPoints[(i + 1) % numPoints];
+      double       dx = p2.mX - p1.mX;
+      double       dy = p2.mY - p1.mY;
+
+      size_t pieceCount = 1 + static_cast<size_t>(std::max(fabs(dx) / grid.mCellSizeX, fabs(dy) / grid.mCellSizeY));
+      for (size_t piece = 0; piece < pieceCount; ++piece)
+      {
+         double f1  = static_cast<double>(piece) / pieceCount;
+         double f2  = static_cast<double>(piece + 1) / pieceCount;
+         double x1  = p1.mX + f1 * dx;
+         double x2  = p1.mX + f2 * dx;
+         double y1  = p1.mY + f1 * dy;
+         double y2  = p1.mY + f2 * dy;
+         size_t ix1 = GridCellIndex(std::min(x1, x2) - padX, grid.mMinX, grid.mCellSizeX, grid.mCountX);
+         size_t ix2 = GridCellIndex(std::max(x1, x2) + padX, grid.mMinX, grid.mCellSizeX, grid.mCountX);
+         size_t iy1 = GridCellIndex(std::min(y1, y2) - padY, grid.mMinY, grid.mCellSizeY, grid.mCountY);
+         size_t iy2 = GridCellIndex(std::max(y1, y2) + padY, grid.mMinY, grid.mCellSizeY, grid.mCountY);
+         for (size_t ix = ix1; ix <= ix2; ++ix)
+         {
+            for (size_t iy = iy1; iy <= iy2; ++iy)
+            {
+               grid.mCells[ix * grid.mCountY + iy] = cGRID_EDGE;
+            }
+         }
+      }
+   }
+
+   // Adjacent unmarked cells are in the same region (no edge separates them), so the full test is performed
+   // only at the center of the first cell of each connected group and the result is flooded to the group.
+   std::vector<size_t> pending;
+   for (size_t cellIndex = 0; cellIndex < grid.mCells.size(); ++cellIndex)
+   {
+      if (grid.mCells[cellIndex] != cGRID_UNKNOWN)
+      {
+         continue;
+      }
+
+      double x     = grid.mMinX + ((cellIndex / grid.mCountY) + 0.5) * grid.mCellSizeX;
+      double y     = grid.mMinY + ((cellIndex % grid.mCountY) + 0.5) * grid.mCellSizeY;
+      char   state = WithinPolygonSidesExact(x, y) ? cGRID_INSIDE : cGRID_OUTSIDE;
+
+      grid.mCells[cellIndex] = state;
+      pending.push_back(cellIndex);
+      while (!pending.empty())
+      {
+         size_t index = pending.back();
+         pending.pop_back();
+         size_t ix = index / grid.mCountY;
+         size_t iy = index % grid.mCountY;
+
+         size_t neighbors[4];
+         size_t neighborCount = 0;
+         if (ix > 0)
+         {
+            neighbors[neighborCount++] = index - grid.mCountY;
+         }
+         if ((ix + 1) < grid.mCountX)
+         {
+            neighbors[neighborCount++] = index + grid.mCountY;
+         }
+         if (iy > 0)
+         {
+            neighbors[neighborCount++] = index - 1;
+         }
+         if ((iy + 1) < grid.mCountY)
+         {
+            neighbors[neighborCount++] = index + 1;
+         }
+         for (size_t i = 0; i < neighborCount; ++i)
+         {
+            if (grid.mCells[neighbors[i]] == cGRID_UNKNOWN)
+            {
+               grid.mCells[neighbors[i]] = state;
+               pending.push_back(neighbors[i]);
+            }
+         }
+      }
+   }
+   mPolygonGrid = std::move(grid);
+}
+
+// =================================================================================================
+//! The full point-in-polygon test (without the gross bounds check).
+// private
+bool WsfZoneDefinition::WithinPolygonSidesExact(const double aXorLatValue, const double aYorLonValue) const
+{
    // Reference = SUBROUTINE REGION() Check for point within a polygon.
    // Algorithm obtained from external FORTRAN Code.  Variable names
    // and logic flow are kept (approximately) the same, to facilitate
@@ -2424,10 +2701,12 @@ bool WsfZoneDefinition::WithinPolygonSides(const double aXorLatValue, const doub
 }
 
 // =================================================================================================
+//! @param aObserverFramePtr If not null, the local frame at the eye point of an observer-relative zone.
 bool WsfZoneDefinition::PointIsInsidePrivate(const double aViewedPointWCS[3],
                                              const double aEyePointWCS[3],
                                              const double aLookHeading,
-                                             const double aDeltaDownRange) const
+                                             const double aDeltaDownRange,
+                                             UtEntity*    aObserverFramePtr) const
 {
    // Adjust the eyepoint before doing any constraint checks
    const double* eyePointWCS = (mRelativeTo == cOBSERVER) ? aEyePointWCS : mReferenceWCS;
@@ -2438,6 +2717,19 @@ bool WsfZoneDefinition::PointIsInsidePrivate(const double aViewedPointWCS[3],
       return false;
    }
 
+   // A polygon defined by latitude and longitude can be rejected using only the longitude of the point,
+   // which (unlike the latitude) is cheaply computed from the WCS location. The small tolerance allows for
+   // any difference in rounding from the longitude computed by the full WCS to LLA conversion.
+   bool isLatLonPolygon = (mShapeType == cPOLYGONAL) && mPointsAreLatLon && (!mPoints.empty());
+   if (isLatLonPolygon)
+   {
+      double vpLonApprox = atan2(aViewedPointWCS[1], aViewedPointWCS[0]) * UtMath::cDEG_PER_RAD;
+      if ((vpLonApprox < (mMinY - 1.0E-9)) || (vpLonApprox > (mMaxY + 1.0E-9)))
+      {
+         return false;
+      }
+   }
+
    // There are four general constraints to check:
    // 1.  Altitude Bounds (if any)
    //       a. Translate WCS location into LLA.
@@ -2472,14 +2764,34 @@ bool WsfZoneDefinition::PointIsInsidePrivate(const double aViewedPointWCS[3],
       return false;
    }
 
-   double localPos[3];
-   if (mRelativeTo == cOBSERVER)
-   {
-      ConvertWCSToLocalFrame(aViewedPointWCS, eyePointWCS, aLookHeading, localPos);
-   }
-   else // if (mRelativeTo == cINTERNAL)
+   // The point is only needed in the local frame for radial, angular, elliptical and (X,Y) polygon tests.
+   bool localFrameRequired =
+      ((mShapeType != cSPHERICAL) && ((mMinRadiusSq != cUNSPECIFIED) || (mMaxRadiusSq != cUNSPECIFIED))) ||
+      ((mStartAngle != cUNSPECIFIED) && (mStopAngle != cUNSPECIFIED)) || (mShapeType == cELLIPTICAL) ||
+      ((mShapeType == cPOLYGONAL) && (!isLatLonPolygon));
+
+   double localPos[3] = {0.0, 0.0, 0.0};
+   if (localFrameRequired)
    {
-      ConvertWCSToLocalFrame(aViewedPointWCS, eyePointWCS, mReferenceHeading, localPos);
+      if (mRelativeTo == cOBSERVER)
+      {
+         if (aObserverFramePtr != nullptr)
+         {
+            aObserverFramePtr->ConvertWCSToECS(aViewedPointWCS, localPos);
+         }
+         else
+         {
+            ConvertWCSToLocalFrame(aViewedPointWCS, eyePointWCS, aLookHeading, localPos);
+         }
+      }
+      else if (mReferenceFrameValid) // && (mRelativeTo == cINTERNAL)
+      {
+         mReferenceFrame.ConvertWCSToECS(aViewedPointWCS, localPos);
+      }
+      else // if (mRelativeTo == cINTERNAL)
+      {
+         ConvertWCSToLocalFrame(aViewedPointWCS, eyePointWCS, mReferenceHeading, localPos);
+      }
    }
 
    // Now adjust for sliding Zone away from the eyepoint:
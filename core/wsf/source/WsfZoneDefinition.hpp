@@ -16,7 +16,7 @@
 
 #include <vector>
 
-class UtEntity;
+#include "UtEntity.hpp"
 class UtInput;
 class UtInputBlock;
 #include "UtVec2.hpp"
@@ -44,6 +44,15 @@ public:
                       const double   aLookHeading,
                       const double   aDeltaDownRange = 0.0) override;
 
+   void PointsAreInside(WsfSimulation*              aSimulationPtr,
+                        const std::vector<UtVec3d>& aViewedPointsWCS,
+                        const double                aEyePointWCS[3],
+                        double                      aLookHeading,
+                        std::vector<bool>&          aInside,
+                        double                      aDeltaDownRange = 0.0) override;
+
+   bool GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const override;
+
    double CheckIntersections(const double aLLA1[3], const double aLLA2[3]) override;
 
    void Initialize(const WsfScenario& aScenario) override;
@@ -113,7 +122,11 @@ public:
 
    bool HasAbsoluteLatLon() const { return mHasAbsoluteLatLon; }
 
-   void SetPointsAreLatLon(bool aValue) { mPointsAreLatLon = aValue; }
+   void SetPointsAreLatLon(bool aValue)
+   {
+      mPointsAreLatLon = aValue;
+      GeometryChanged();
+   }
    bool PointsAreLatLon() { return mPointsAreLatLon; }
 
    bool GetLatLonExtrema(double& aSouthernLat, double& aWesternLon, double& aNorthernLat, double& aEasternLon) const override;
@@ -159,10 +172,17 @@ private:
                                const double aLookHeading,
                                double       aPointInMyFrame[3]) const;
 
+   bool UpdateReferencePlatform(WsfSimulation* aSimulationPtr);
+   void UpdateReferenceFrame();
+
    bool PointIsInsidePrivate(const double aViewedPointWCS[3],
                              const double aEyePointWCS[3],
                              const double aLookHeading,
-                             const double aDeltaDownRange) const;
+                             const double aDeltaDownRange,
+                             UtEntity*    aObserverFramePtr) const;
+
+   void BuildPolygonGrid();
+   bool WithinPolygonSidesExact(const double aXorLatValue, const double aYorLonValue) const;
 
    void SetReference(double aReferenceLat, double aReferenceLon, double aReferenceHeading, double aReferenceWCS[3]);
 
@@ -243,6 +263,27 @@ private:
 
    //! Debug flag
    bool mDebugEnabled;
+
+   //! The local frame at the reference point of an internally referenced zone. This is rebuilt whenever the
+   //! reference point changes so the frame does not have to be constructed for every point that is tested.
+   //! (It is mutable only because the UtEntity conversion methods are not const.)
+   mutable UtEntity mReferenceFrame;
+   bool             mReferenceFrameValid;
+
+   //! A uniform grid over the bounding box of a polygon with many vertices. Cells that no edge passes
+   //! through are entirely inside or entirely outside the polygon, so only points in the remaining cells
+   //! require the full point-in-polygon test.
+   struct PolygonGrid
+   {
+      double            mMinX      = 0.0;
+      double            mMinY      = 0.0;
+      double            mCellSizeX = 0.0;
+      double            mCellSizeY = 0.0;
+      size_t            mCountX    = 0;
+      size_t            mCountY    = 0;
+      std::vector<char> mCells; //!< Empty if there is no grid
+   };
+   PolygonGrid mPolygonGrid;
 };
 
 #endif
@@ -0,0 +1,429 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfZoneMonitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "UtEntity.hpp"
+#include "UtInput.hpp"
+#include "UtInputBlock.hpp"
+#include "UtLog.hpp"
+#include "UtMemory.hpp"
+#include "WsfMover.hpp"
+#include "WsfMoverObserver.hpp"
+#include "WsfPlatform.hpp"
+#include "WsfPlatformObserver.hpp"
+#include "WsfScenario.hpp"
+#include "WsfSimulation.hpp"
+#include "WsfZone.hpp"
+#include "WsfZoneObserver.hpp"
+#include "WsfZoneTypes.hpp"
+
+namespace
+{
+//! Zones whose bounds cover more than this number of one degree cells are tested on every update.
+const int cMAX_ZONE_CELLS = 400;
+
+//! The number of degrees by which the bounds of an update segment are expanded when finding candidate zones.
+//! This covers the difference between the straight WCS segment and the lat/lon box of its end points.
+const double cSEGMENT_PAD = 0.05;
+
+//! The maximum number of samples tested along an update segment.
+const size_t cMAX_SAMPLES = 1000;
+
+int LatCell(double aLat)
+{
+   return std::min(std::max(static_cast<int>(std::floor(aLat)) + 90, 0), 179);
+}
+
+int LonCell(double aLon)
+{
+   int cell = (static_cast<int>(std::floor(aLon)) + 180) % 360;
+   return (cell < 0) ? (cell + 360) : cell;
+}
+} // namespace
+
+// =================================================================================================
+bool WsfZoneMonitorExtension::ProcessInput(UtInput& aInput)
+{
+   bool myCommand = false;
+   if (aInput.GetCommand() == "zone_monitor")
+   {
+      myCommand = true;
+      UtInputBlock inputBlock(aInput);
+      std::string  command;
+      while (inputBlock.ReadCommand(command))
+      {
+         if (command == "zone")
+         {
+            std::string zoneName;
+            aInput.ReadValue(zoneName);
+            mZoneNames.emplace_back(zoneName);
+         }
+         else if (command == "category")
+         {
+            std::string category;
+            aInput.ReadValue(category);
+            mCategories.emplace_back(category);
+         }
+         else if (command == "sample_spacing")
+         {
+            aInput.ReadValueOfType(mSampleSpacing, UtInput::cLENGTH);
+            aInput.ValueGreater(mSampleSpacing, 0.0);
+         }
+         else
+         {
+            throw UtInput::UnknownCommand(aInput);
+         }
+      }
+   }
+   return myCommand;
+}
+
+// =================================================================================================
+void WsfZoneMonitorExtension::SimulationCreated(WsfSimulation& aSimulation)
+{
+   if (!mZoneNames.empty())
+   {
+      aSimulation.RegisterExtension(GetExtensionName(), ut::make_unique<WsfZoneMonitor>(*this));
+   }
+}
+
+// =================================================================================================
+//! Return the zone monitor for the specified simulation, or nullptr if no zones are being monitored.
+// static
+WsfZoneMonitor* WsfZoneMonitor::Find(const WsfSimulation& aSimulation)
+{
+   return static_cast<WsfZoneMonitor*>(aSimulation.FindExtension("zone_monitor"));
+}
+
+// =================================================================================================
+WsfZoneMonitor::WsfZoneMonitor(const WsfZoneMonitorExtension& aExtension)
+   : mZoneNames(aExtension.GetZoneNames())
+   , mCategories(aExtension.GetCategories())
+   , mSampleSpacing(aExtension.GetSampleSpacing())
+   , mZonePtrs()
+   , mCellZones()
+   , mUnboundedZones()
+   , mIndexChangeCount(0)
+   , mZoneMarks()
+   , mMark(0)
+   , mPlatformStates()
+   , mSamplesWCS()
+   , mSampleInside()
+   , mCandidates()
+   , mCallbacks()
+{
+}
+
+// =================================================================================================
+bool WsfZoneMonitor::Initialize()
+{
+   bool ok = true;
+   for (WsfStringId zoneName : mZoneNames)
+   {
+      WsfZone* zonePtr = WsfZoneTypes::Get(GetScenario()).Find(zoneName);
+      if (zonePtr == nullptr)
+      {
+         auto out = ut::log::error() << "zone_monitor: Zone does not exist.";
+         out.AddNote() << "Zone: " << zoneName;
+         ok = false;
+      }
+      else if (std::find(mZonePtrs.begin(), mZonePtrs.end(), zonePtr) == mZonePtrs.end())
+      {
+         mZonePtrs.push_back(zonePtr);
+      }
+   }
+   BuildIndex();
+   mZoneMarks.assign(mZonePtrs.size(), 0);
+
+   mCallbacks.Add(WsfObserver::MoverUpdated(&GetSimulation()).Connect(&WsfZoneMonitor::MoverUpdated, this));
+   mCallbacks.Add(WsfObserver::PlatformDeleted(&GetSimulation()).Connect(&WsfZoneMonitor::PlatformDeleted, this));
+   return ok;
+}
+
+// =================================================================================================
+//! Get the monitored zones that contain a platform as of its last mover update.
+//! @param aPlatform The platform of interest.
+//! @param aZones    [output] The zones containing the platform.
+void WsfZoneMonitor::GetZonesContaining(const WsfPlatform& aPlatform, std::vector<WsfZone*>& aZones) const
+{
+   aZones.clear();
+   auto stateIter = mPlatformStates.find(aPlatform.GetIndex());
+   if (stateIter != mPlatformStates.end())
+   {
+      for (size_t zoneIndex : stateIter->second.mInsideZones)
+      {
+         aZones.push_back(mZonePtrs[zoneIndex]);
+      }
+   }
+}
+
+// =================================================================================================
+// private
+void WsfZoneMonitor::MoverUpdated(double aSimTime, WsfMover* aMoverPtr)
+{
+   WsfPlatform* platformPtr = aMoverPtr->GetPlatform();
+   if ((platformPtr == nullptr) || (!IsMonitored(*platformPtr)))
+   {
+      return;
+   }
+
+   double locationWCS[3];
+   platformPtr->GetLocationWCS(locationWCS);
+   double heading;
+   double pitch;
+   double roll;
+   platformPtr->GetOrientationNED(heading, pitch, roll);
+
+   WsfSimulation& sim       = GetSimulation();
+   auto           stateIter = mPlatformStates.find(platformPtr->GetIndex());
+   if (stateIter == mPlatformStates.end())
+   {
+      // First update of the platform: simply record the zones it is in.
+      PlatformState& state = mPlatformStates[platformPtr->GetIndex()];
+      state.mLastTime      = aSimTime;
+      UtVec3d::Set(state.mLastLocationWCS, locationWCS);
+      FindCandidateZones(locationWCS, locationWCS, state, mCandidates);
+      for (size_t zoneIndex : mCandidates)
+      {
+         if (mZonePtrs[zoneIndex]->PointIsInside(&sim, locationWCS, locationWCS, heading))
+         {
+            state.mInsideZones.push_back(zoneIndex);
+         }
+      }
+      std::sort(state.mInsideZones.begin(), state.mInsideZones.end());
+      return;
+   }
+
+   PlatformState& state = stateIter->second;
+   double         deltaWCS[3];
+   UtVec3d::Subtract(deltaWCS, locationWCS, state.mLastLocationWCS);
+   double length = UtVec3d::Magnitude(deltaWCS);
+   if (length == 0.0)
+   {
+      state.mLastTime = aSimTime;
+      return;
+   }
+
+   // Sample the segment from the previous location (exclusive) to the current location (inclusive).
+   size_t sampleCount = static_cast<size_t>(std::ceil(length / mSampleSpacing));
+   sampleCount        = std::min(std::max(sampleCount, size_t(1)), cMAX_SAMPLES);
+   mSamplesWCS.resize(sampleCount);
+   for (size_t i = 0; i < sampleCount; ++i)
+   {
+      double fraction = static_cast<double>(i + 1) / static_cast<double>(sampleCount);
+      UtVec3d::Multiply(mSamplesWCS[i].GetData(), deltaWCS, fraction);
+      UtVec3d::Add(mSamplesWCS[i].GetData(), mSamplesWCS[i].GetData(), state.mLastLocationWCS);
+   }
+
+   FindCandidateZones(state.mLastLocationWCS, locationWCS, state, mCandidates);
+
+   std::vector<Crossing> crossings;
+   std::vector<size_t>   insideZones;
+   double                lastTime = state.mLastTime;
+   double                deltaT   = aSimTime - lastTime;
+   for (size_t zoneIndex : mCandidates)
+   {
+      mZonePtrs[zoneIndex]->PointsAreInside(&sim, mSamplesWCS, locationWCS, heading, mSampleInside);
+      bool inside = std::binary_search(state.mInsideZones.begin(), state.mInsideZones.end(), zoneIndex);
+      for (size_t i = 0; i < sampleCount; ++i)
+      {
+         if (mSampleInside[i] != inside)
+         {
+            // Estimate the crossing to be midway between the bracketing samples.
+            inside          = mSampleInside[i];
+            double fraction = (static_cast<double>(i) + 0.5) / static_cast<double>(sampleCount);
+            Crossing crossing;
+            crossing.mTime = lastTime + fraction * deltaT;
+            UtVec3d::Multiply(crossing.mLocationWCS.GetData(), deltaWCS, fraction);
+            UtVec3d::Add(crossing.mLocationWCS.GetData(), crossing.mLocationWCS.GetData(), state.mLastLocationWCS);
+            crossing.mZoneIndex = zoneIndex;
+            crossing.mEntered   = inside;
+            crossings.push_back(crossing);
+         }
+      }
+      if (inside)
+      {
+         insideZones.push_back(zoneIndex);
+      }
+   }
+   std::sort(insideZones.begin(), insideZones.end());
+   state.mInsideZones.swap(insideZones);
+   state.mLastTime = aSimTime;
+   UtVec3d::Set(state.mLastLocationWCS, locationWCS);
+
+   // The platform state is not referenced once the observers are called, as an observer may delete the platform.
+   std::stable_sort(crossings.begin(),
+                    crossings.end(),
+                    [](const Crossing& aLhs, const Crossing& aRhs) { return aLhs.mTime < aRhs.mTime; });
+   for (const Crossing& crossing : crossings)
+   {
+      WsfZone* zonePtr = mZonePtrs[crossing.mZoneIndex];
+      if (crossing.mEntered)
+      {
+         WsfObserver::ZoneEntered(&sim)(aSimTime, platformPtr, zonePtr, crossing.mTime, crossing.mLocationWCS);
+      }
+      else
+      {
+         WsfObserver::ZoneExited(&sim)(aSimTime, platformPtr, zonePtr, crossing.mTime, crossing.mLocationWCS);
+      }
+   }
+}
+
+// =================================================================================================
+// private
+void WsfZoneMonitor::PlatformDeleted(double /*aSimTime*/, WsfPlatform* aPlatformPtr)
+{
+   mPlatformStates.erase(aPlatformPtr->GetIndex());
+}
+
+// =================================================================================================
+//! Return 'true' if the platform is a member of one of the monitored categories (or if no categories were given).
+// private
+bool WsfZoneMonitor::IsMonitored(const WsfPlatform& aPlatform) const
+{
+   if (mCategories.empty())
+   {
+      return true;
+   }
+   for (WsfStringId category : mCategories)
+   {
+      if (aPlatform.IsCategoryMember(category))
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Build the index of the monitored zones from their current inclusion bounds.
+// private
+void WsfZoneMonitor::BuildIndex()
+{
+   mIndexChangeCount = WsfZone::GetGeometryChangeCount();
+   mCellZones.clear();
+   mUnboundedZones.clear();
+   for (size_t zoneIndex = 0; zoneIndex < mZonePtrs.size(); ++zoneIndex)
+   {
+      AddZoneToIndex(zoneIndex);
+   }
+}
+
+// =================================================================================================
+// private
+void WsfZoneMonitor::AddZoneToIndex(size_t aZoneIndex)
+{
+   double minLat;
+   double minLon;
+   double maxLat;
+   double maxLon;
+   if (!mZonePtrs[aZoneIndex]->GetInclusionBounds(minLat, minLon, maxLat, maxLon))
+   {
+      mUnboundedZones.push_back(aZoneIndex);
+      return;
+   }
+
+   int minLatCell = LatCell(minLat);
+   int maxLatCell = LatCell(maxLat);
+   int minLonCell = static_cast<int>(std::floor(minLon));
+   int maxLonCell = static_cast<int>(std::floor(maxLon));
+   if (((maxLatCell - minLatCell + 1) * (maxLonCell - minLonCell + 1)) > cMAX_ZONE_CELLS)
+   {
+      mUnboundedZones.push_back(aZoneIndex);
+      return;
+   }
+   for (int latCell = minLatCell; latCell <= maxLatCell; ++latCell)
+   {
+      for (int lonCell = minLonCell; lonCell <= maxLonCell; ++lonCell)
+      {
+         mCellZones[CellKey(latCell, LonCell(lonCell))].push_back(aZoneIndex);
+      }
+   }
+}
+
+// =================================================================================================
+//! Find the zones that may contain any point of the segment between two locations.
+//! The zones that currently contain the platform are always included so their exits are detected.
+// private
+void WsfZoneMonitor::FindCandidateZones(const double         aLocationWCS1[3],
+                                        const double         aLocationWCS2[3],
+                                        const PlatformState& aState,
+                                        std::vector<size_t>& aZoneIndices)
+{
+   // Global zones may be reshaped by script (WsfZone.SetPolyPoints), which invalidates their bounds.
+   if (WsfZone::GetGeometryChangeCount() != mIndexChangeCount)
+   {
+      BuildIndex();
+   }
+
+   aZoneIndices.clear();
+   ++mMark;
+   auto addZone = [this, &aZoneIndices](size_t aZoneIndex)
+   {
+      if (mZoneMarks[aZoneIndex] != mMark)
+      {
+         mZoneMarks[aZoneIndex] = mMark;
+         aZoneIndices.push_back(aZoneIndex);
+      }
+   };
+
+   for (size_t zoneIndex : mUnboundedZones)
+   {
+      addZone(zoneIndex);
+   }
+   for (size_t zoneIndex : aState.mInsideZones)
+   {
+      addZone(zoneIndex);
+   }
+
+   if (!mCellZones.empty())
+   {
+      double lat1;
+      double lon1;
+      double lat2;
+      double lon2;
+      double alt;
+      UtEntity::ConvertWCSToLLA(aLocationWCS1, lat1, lon1, alt);
+      UtEntity::ConvertWCSToLLA(aLocationWCS2, lat2, lon2, alt);
+      if (std::abs(lon2 - lon1) > 180.0)
+      {
+         // The segment crosses the date line. Express both longitudes relative to the first point.
+         lon2 += (lon2 < lon1) ? 360.0 : -360.0;
+      }
+      int minLatCell = LatCell(std::min(lat1, lat2) - cSEGMENT_PAD);
+      int maxLatCell = LatCell(std::max(lat1, lat2) + cSEGMENT_PAD);
+      int minLonCell = static_cast<int>(std::floor(std::min(lon1, lon2) - cSEGMENT_PAD));
+      int maxLonCell = static_cast<int>(std::floor(std::max(lon1, lon2) + cSEGMENT_PAD));
+      if ((minLatCell == 0) || (maxLatCell == 179))
+      {
+         // Near a pole a short segment can span any longitude.
+         minLonCell = -180;
+         maxLonCell = 179;
+      }
+      maxLonCell = std::min(maxLonCell, minLonCell + 359);
+      for (int latCell = minLatCell; latCell <= maxLatCell; ++latCell)
+      {
+         for (int lonCell = minLonCell; lonCell <= maxLonCell; ++lonCell)
+         {
+            auto cellIter = mCellZones.find(CellKey(latCell, LonCell(lonCell)));
+            if (cellIter != mCellZones.end())
+            {
+               for (size_t zoneIndex : cellIter->second)
+               {
+                  addZone(zoneIndex);
+               }
+            }
+         }
+      }
+   }
+}
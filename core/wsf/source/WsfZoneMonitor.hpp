@@ -0,0 +1,128 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFZONEMONITOR_HPP
+#define WSFZONEMONITOR_HPP
+
+#include "wsf_export.h"
+
+#include <unordered_map>
+#include <vector>
+
+class UtInput;
+#include "UtCallbackHolder.hpp"
+#include "UtVec3.hpp"
+class WsfMover;
+class WsfPlatform;
+#include "WsfScenarioExtension.hpp"
+#include "WsfSimulationExtension.hpp"
+#include "WsfStringId.hpp"
+class WsfZone;
+
+//! The scenario extension that processes the 'zone_monitor' block.
+//! The zone monitor simulation extension is created only if at least one zone is to be monitored.
+class WSF_EXPORT WsfZoneMonitorExtension : public WsfScenarioExtension
+{
+public:
+   bool ProcessInput(UtInput& aInput) override;
+   void SimulationCreated(WsfSimulation& aSimulation) override;
+
+   const std::vector<WsfStringId>& GetZoneNames() const { return mZoneNames; }
+   const std::vector<WsfStringId>& GetCategories() const { return mCategories; }
+   double                          GetSampleSpacing() const { return mSampleSpacing; }
+
+private:
+   std::vector<WsfStringId> mZoneNames;
+   std::vector<WsfStringId> mCategories;
+   double                   mSampleSpacing = 100.0;
+};
+
+//! Detects platforms entering and exiting the monitored global zones and reports them through the
+//! WsfObserver::ZoneEntered and WsfObserver::ZoneExited callbacks.
+//!
+//! The monitor is driven by mover updates rather than by polling. On each update the segment between the
+//! previous and current platform locations is sampled at the 'sample_spacing' interval and each sample is
+//! tested against the zones whose bounds are near the segment, so a platform that passes completely through
+//! a zone between updates is still reported. Nearby zones are found with a grid of one degree latitude/longitude
+//! cells, each holding the zones whose inclusion bounds overlap it. Zones that do not provide bounds (or are
+//! very large) are tested on every update. The grid is rebuilt if the shape of any zone changes (see
+//! WsfZone::GetGeometryChangeCount).
+//!
+//! The first update of a platform establishes the zones it is in without reporting any events.
+class WSF_EXPORT WsfZoneMonitor : public WsfSimulationExtension
+{
+public:
+   static WsfZoneMonitor* Find(const WsfSimulation& aSimulation);
+
+   explicit WsfZoneMonitor(const WsfZoneMonitorExtension& aExtension);
+   ~WsfZoneMonitor() override = default;
+
+   bool Initialize() override;
+
+   void GetZonesContaining(const WsfPlatform& aPlatform, std::vector<WsfZone*>& aZones) const;
+
+private:
+   //! A zone boundary crossing found while processing a mover update.
+   struct Crossing
+   {
+      double  mTime;        //!< The estimated time of the crossing
+      UtVec3d mLocationWCS; //!< The estimated location of the crossing
+      size_t  mZoneIndex;
+      bool    mEntered;
+   };
+
+   //! The monitor state of a platform.
+   struct PlatformState
+   {
+      double              mLastTime;
+      double              mLastLocationWCS[3];
+      std::vector<size_t> mInsideZones; //!< Indices of the zones the platform is in (sorted).
+   };
+
+   void MoverUpdated(double aSimTime, WsfMover* aMoverPtr);
+   void PlatformDeleted(double aSimTime, WsfPlatform* aPlatformPtr);
+
+   bool IsMonitored(const WsfPlatform& aPlatform) const;
+   void BuildIndex();
+   void AddZoneToIndex(size_t aZoneIndex);
+   void FindCandidateZones(const double         aLocationWCS1[3],
+                           const double         aLocationWCS2[3],
+                           const PlatformState& aState,
+                           std::vector<size_t>& aZoneIndices);
+
+   static int CellKey(int aLatCell, int aLonCell) { return (aLatCell * 360) + aLonCell; }
+
+   std::vector<WsfStringId> mZoneNames;
+   std::vector<WsfStringId> mCategories;
+   double                   mSampleSpacing;
+
+   std::vector<WsfZone*> mZonePtrs;
+
+   //! The zones whose inclusion bounds overlap each one degree cell, keyed by CellKey().
+   std::unordered_map<int, std::vector<size_t>> mCellZones;
+   //! The zones that are tested on every update.
+   std::vector<size_t> mUnboundedZones;
+   //! The zone geometry change count when the index was built.
+   unsigned int mIndexChangeCount;
+
+   //! Used to avoid adding a zone to the candidate list more than once per update.
+   std::vector<unsigned int> mZoneMarks;
+   unsigned int              mMark;
+
+   //! Per-platform state, keyed by platform index.
+   std::unordered_map<size_t, PlatformState> mPlatformStates;
+
+   std::vector<UtVec3d> mSamplesWCS;
+   std::vector<bool>    mSampleInside;
+   std::vector<size_t>  mCandidates;
+
+   UtCallbackHolder mCallbacks;
+};
+
+#endif
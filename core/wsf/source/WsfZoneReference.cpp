@@ -60,6 +60,34 @@ bool WsfZoneReference::PointIsInside(WsfSimulation* aSimulationPtr,
    return mSharedZonePtr->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange);
 }
 
+// =================================================================================================
+// virtual
+void WsfZoneReference::PointsAreInside(WsfSimulation*              aSimulationPtr,
+                                       const std::vector<UtVec3d>& aViewedPointsWCS,
+                                       const double                aEyePointWCS[3],
+                                       double                      aLookHeading,
+                                       std::vector<bool>&          aInside,
+                                       double                      aDeltaDownRange)
+{
+   mSharedZonePtr
+      ->PointsAreInside(aSimulationPtr, aViewedPointsWCS, aEyePointWCS, aLookHeading, aInside, aDeltaDownRange);
+}
+
+// =================================================================================================
+// virtual
+bool WsfZoneReference::GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const
+{
+   return mSharedZonePtr->GetInclusionBounds(aMinLat, aMinLon, aMaxLat, aMaxLon);
+}
+
+// =================================================================================================
+//! The shape of the reference is that of the shared zone.
+// virtual
+unsigned int WsfZoneReference::GetShapeChangeCount() const
+{
+   return (mSharedZonePtr != nullptr) ? mSharedZonePtr->GetShapeChangeCount() : WsfZone::GetShapeChangeCount();
+}
+
 // =================================================================================================
 //! return the geopoint of the reference point
 // virtual
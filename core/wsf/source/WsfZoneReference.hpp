@@ -44,6 +44,16 @@ public:
                       const double   aLookHeading,
                       const double   aDeltaDownRange = 0.0) override;
 
+   void PointsAreInside(WsfSimulation*              aSimulationPtr,
+                        const std::vector<UtVec3d>& aViewedPointsWCS,
+                        const double                aEyePointWCS[3],
+                        double                      aLookHeading,
+                        std::vector<bool>&          aInside,
+                        double                      aDeltaDownRange = 0.0) override;
+
+   bool         GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const override;
+   unsigned int GetShapeChangeCount() const override;
+
    double Area() override;
 
    WsfGeoPoint Reference() override;
@@ -17,11 +17,14 @@
 
 #include "WsfZoneSet.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <memory>
 
 #include "GeoIntersectDatabase.hpp"
 #include "GeoShapeFile.hpp"
+#include "UtEntity.hpp"
 #include "UtInput.hpp"
 #include "UtInputBlock.hpp"
 #include "WsfDraw.hpp"
@@ -31,6 +34,35 @@
 #include "WsfZoneDefinition.hpp"
 #include "WsfZoneReference.hpp"
 
+namespace
+{
+//! The maximum number of children of a node in a zone index.
+const size_t cINDEX_NODE_CAPACITY = 8;
+
+//! Order items (zone index entries or nodes) for packing into nodes using the Sort-Tile-Recursive algorithm:
+//! the items are sorted into vertical slices by longitude, and each slice is sorted by latitude. Consecutive
+//! runs of cINDEX_NODE_CAPACITY items then form compact nodes.
+template<typename T>
+void SortTileRecursive(std::vector<T>& aItems)
+{
+   size_t nodeCount  = (aItems.size() + cINDEX_NODE_CAPACITY - 1) / cINDEX_NODE_CAPACITY;
+   size_t sliceCount = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nodeCount))));
+   size_t sliceSize  = sliceCount * cINDEX_NODE_CAPACITY;
+   std::sort(aItems.begin(),
+             aItems.end(),
+             [](const T& aLhs, const T& aRhs)
+             { return (aLhs.mBox.mMinLon + aLhs.mBox.mMaxLon) < (aRhs.mBox.mMinLon + aRhs.mBox.mMaxLon); });
+   for (size_t begin = 0; begin < aItems.size(); begin += sliceSize)
+   {
+      size_t end = std::min(begin + sliceSize, aItems.size());
+      std::sort(aItems.begin() + begin,
+                aItems.begin() + end,
+                [](const T& aLhs, const T& aRhs)
+                { return (aLhs.mBox.mMinLat + aLhs.mBox.mMaxLat) < (aRhs.mBox.mMinLat + aRhs.mBox.mMaxLat); });
+   }
+}
+} // namespace
+
 // =================================================================================================
 // Elevation callback needed by the GeoShapeFile loader.
 class WsfTerrainElevationCallback : public GeoShapeFile::ElevationCallback
@@ -55,6 +87,11 @@ public:
 //! Constructor.
 WsfZoneSet::WsfZoneSet()
    : WsfZone()
+   , mZoneIndex()
+   , mExclusionZoneIndex()
+   , mIndexChangeCount(0)
+   , mMemberChangeCount(0)
+   , mIndexMutex()
    , mIntersectDBPtr(nullptr)
    , mAttenuationFileName(nullptr)
    , mUseDTED(false)
@@ -72,6 +109,11 @@ WsfZoneSet::WsfZoneSet()
 //! Copy constructor.
 WsfZoneSet::WsfZoneSet(const WsfZoneSet& aSrc)
    : WsfZone(aSrc)
+   , mZoneIndex(aSrc.mZoneIndex) // The members are cloned in the same order, so the indices remain valid
+   , mExclusionZoneIndex(aSrc.mExclusionZoneIndex)
+   , mIndexChangeCount(aSrc.mIndexChangeCount.load())
+   , mMemberChangeCount(aSrc.mMemberChangeCount)
+   , mIndexMutex()
    , mIntersectDBPtr(nullptr)
    , mAttenuationFileName(aSrc.mAttenuationFileName)
    , mUseDTED(aSrc.mUseDTED)
@@ -298,26 +340,58 @@ bool WsfZoneSet::PointIsInside(WsfSimulation* aSimulationPtr,
                                const double   aDeltaDownRange)
 {
    assert(mIsInitialized);
-   bool included = false;
-   for (std::vector<WsfZone*>::const_iterator zli = mZonePtrs.begin(); zli != mZonePtrs.end(); ++zli)
+   UpdateIndices();
+
+   // The location of the point is converted to LLA only if needed to search an index, and then only once.
+   double viewedLocationLLA[3];
+   bool   llaValid = false;
+   bool   included = mZoneIndex.PointIsInside(mZonePtrs,
+                                            aSimulationPtr,
+                                            aViewedPointWCS,
+                                            aEyePointWCS,
+                                            aLookHeading,
+                                            aDeltaDownRange,
+                                            viewedLocationLLA,
+                                            llaValid);
+   if (!included)
    {
-      if ((*zli)->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange))
-      {
-         included = true;
-         break;
-      }
+      return false;
    }
-   bool excluded = false;
-   for (std::vector<WsfZone*>::const_iterator zli = mExclusionZonePtrs.begin(); zli != mExclusionZonePtrs.end(); ++zli)
+   bool excluded = mExclusionZoneIndex.PointIsInside(mExclusionZonePtrs,
+                                                     aSimulationPtr,
+                                                     aViewedPointWCS,
+                                                     aEyePointWCS,
+                                                     aLookHeading,
+                                                     aDeltaDownRange,
+                                                     viewedLocationLLA,
+                                                     llaValid);
+   return !excluded;
+}
+
+// =================================================================================================
+//! The set has bounds only if all of its (non-exclusion) members have bounds.
+// virtual
+bool WsfZoneSet::GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const
+{
+   UpdateIndices();
+   return mZoneIndex.GetBounds(aMinLat, aMinLon, aMaxLat, aMaxLon);
+}
+
+// =================================================================================================
+//! The shape of the set changes when the shape of any of its members changes.
+// virtual
+unsigned int WsfZoneSet::GetShapeChangeCount() const
+{
+   unsigned int changeCount = WsfZone::GetShapeChangeCount();
+   for (const WsfZone* zonePtr : mZonePtrs)
    {
-      if ((*zli)->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange))
-      {
-         excluded = true;
-         break;
-      }
+      changeCount += zonePtr->GetShapeChangeCount();
    }
-
-   return included && !excluded;
+   for (const WsfZone* zonePtr : mExclusionZonePtrs)
+   {
+      changeCount += zonePtr->GetShapeChangeCount();
+   }
+   return changeCount;
 }
 
 // =================================================================================================
@@ -472,6 +546,11 @@ void WsfZoneSet::Initialize(const WsfScenario& aScenario)
       exclusionZonePtr->Initialize(aScenario);
    }
 
+   mIndexChangeCount  = WsfZone::GetGeometryChangeCount();
+   mMemberChangeCount = GetShapeChangeCount();
+   mZoneIndex.Build(mZonePtrs);
+   mExclusionZoneIndex.Build(mExclusionZonePtrs);
+
    CalculateBoundingBox();
    CalculateArea();
    CalculateCentroid();
@@ -545,3 +624,223 @@ void WsfZoneSet::CalculateCentroid()
    mCentroid.mX = xSum / mZonePtrs.size();
    mCentroid.mY = ySum / mZonePtrs.size();
 }
+
+// =================================================================================================
+//! Rebuild the indices if the shape of any member has changed since they were built. A member may be a shared
+//! zone definition (see WsfZoneReference) whose shape is changed by script, so its bounds cannot be retained.
+//! The members are checked only when the shape of some zone has changed, and the indices are rebuilt only if it
+//! was one of the members.
+// private
+void WsfZoneSet::UpdateIndices() const
+{
+   unsigned int changeCount = WsfZone::GetGeometryChangeCount();
+   if ((!mIsInitialized) || (mIndexChangeCount.load(std::memory_order_acquire) == changeCount))
+   {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(mIndexMutex);
+   if (mIndexChangeCount.load(std::memory_order_relaxed) != changeCount)
+   {
+      unsigned int memberChangeCount = GetShapeChangeCount();
+      if (memberChangeCount != mMemberChangeCount)
+      {
+         mZoneIndex.Build(mZonePtrs);
+         mExclusionZoneIndex.Build(mExclusionZonePtrs);
+         mMemberChangeCount = memberChangeCount;
+      }
+      mIndexChangeCount.store(changeCount, std::memory_order_release);
+   }
+}
+
+// =================================================================================================
+void WsfZoneSet::ZoneIndex::Box::Include(const Box& aBox)
+{
+   mMinLat = std::min(mMinLat, aBox.mMinLat);
+   mMinLon = std::min(mMinLon, aBox.mMinLon);
+   mMaxLat = std::max(mMaxLat, aBox.mMaxLat);
+   mMaxLon = std::max(mMaxLon, aBox.mMaxLon);
+}
+
+// =================================================================================================
+//! Build the index over the specified zones (which must have been initialized).
+void WsfZoneSet::ZoneIndex::Build(const std::vector<WsfZone*>& aZonePtrs)
+{
+   *this    = ZoneIndex();
+   mIsBuilt = true;
+   for (size_t i = 0; i < aZonePtrs.size(); ++i)
+   {
+      Entry entry;
+      entry.mZoneIndex = i;
+      Box& box         = entry.mBox;
+      if (aZonePtrs[i]->GetInclusionBounds(box.mMinLat, box.mMinLon, box.mMaxLat, box.mMaxLon))
+      {
+         mEntries.push_back(entry);
+      }
+      else
+      {
+         mUnboundedZones.push_back(i);
+      }
+   }
+   if (mEntries.empty())
+   {
+      return;
+   }
+
+   // Pack the entries into leaf nodes, then repeatedly pack the nodes of each level into the level above
+   // until a single (root) node remains. The nodes of each level are stored contiguously.
+   SortTileRecursive(mEntries);
+   std::vector<Node> level;
+   for (size_t first = 0; first < mEntries.size(); first += cINDEX_NODE_CAPACITY)
+   {
+      Node node;
+      node.mFirst  = first;
+      node.mCount  = std::min(cINDEX_NODE_CAPACITY, mEntries.size() - first);
+      node.mIsLeaf = true;
+      node.mBox    = mEntries[first].mBox;
+      for (size_t i = first + 1; i < first + node.mCount; ++i)
+      {
+         node.mBox.Include(mEntries[i].mBox);
+      }
+      level.push_back(node);
+   }
+
+   // Each node popped from the search stack pushes at most all of its children, so the stack grows by at most
+   // (capacity - 1) entries for each level of interior nodes.
+   mMaxStackSize = 1;
+   while (level.size() > 1)
+   {
+      mMaxStackSize += cINDEX_NODE_CAPACITY - 1;
+      SortTileRecursive(level);
+      size_t levelBegin = mNodes.size();
+      mNodes.insert(mNodes.end(), level.begin(), level.end());
+
+      std::vector<Node> parentLevel;
+      for (size_t first = 0; first < level.size(); first += cINDEX_NODE_CAPACITY)
+      {
+         Node node;
+         node.mFirst  = levelBegin + first;
+         node.mCount  = std::min(cINDEX_NODE_CAPACITY, level.size() - first);
+         node.mIsLeaf = false;
+         node.mBox    = level[first].mBox;
+         for (size_t i = first + 1; i < first + node.mCount; ++i)
+         {
+            node.mBox.Include(level[i].mBox);
+         }
+         parentLevel.push_back(node);
+      }
+      level.swap(parentLevel);
+   }
+   mNodes.push_back(level.front());
+}
+
+// =================================================================================================
+//! Is the point inside any of the zones?
+//! @param aZonePtrs          The zones over which the index was built.
+//! @param aViewedLocationLLA [input/output] The LLA of the viewed point, if aLLA_Valid is true. If it is needed and
+//!                           aLLA_Valid is false, it is computed and aLLA_Valid is set to true.
+//! @note The remaining arguments are the same as for WsfZone::PointIsInside.
+bool WsfZoneSet::ZoneIndex::PointIsInside(const std::vector<WsfZone*>& aZonePtrs,
+                                          WsfSimulation*               aSimulationPtr,
+                                          const double                 aViewedPointWCS[3],
+                                          const double                 aEyePointWCS[3],
+                                          double                       aLookHeading,
+                                          double                       aDeltaDownRange,
+                                          double                       aViewedLocationLLA[3],
+                                          bool&                        aLLA_Valid) const
+{
+   if (!mIsBuilt)
+   {
+      for (WsfZone* zonePtr : aZonePtrs)
+      {
+         if (zonePtr->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange))
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   for (size_t zoneIndex : mUnboundedZones)
+   {
+      WsfZone* zonePtr = aZonePtrs[zoneIndex];
+      if (zonePtr->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange))
+      {
+         return true;
+      }
+   }
+   if (mNodes.empty())
+   {
+      return false;
+   }
+
+   if (!aLLA_Valid)
+   {
+      UtEntity::ConvertWCSToLLA(aViewedPointWCS, aViewedLocationLLA[0], aViewedLocationLLA[1], aViewedLocationLLA[2]);
+      aLLA_Valid = true;
+   }
+   double lat = aViewedLocationLLA[0];
+   double lon = aViewedLocationLLA[1];
+   if (!mNodes.back().mBox.Contains(lat, lon))
+   {
+      return false;
+   }
+
+   // Depth-first search of the nodes whose boxes contain the point. The stack is on the heap only for a tree too
+   // deep for the local array (which holds nine levels, or over 100 million zones).
+   size_t              localStack[64];
+   std::vector<size_t> heapStack;
+   size_t*             stack = localStack;
+   if (mMaxStackSize > (sizeof(localStack) / sizeof(localStack[0])))
+   {
+      heapStack.resize(mMaxStackSize);
+      stack = heapStack.data();
+   }
+   size_t stackSize   = 0;
+   stack[stackSize++] = mNodes.size() - 1;
+   while (stackSize > 0)
+   {
+      const Node& node = mNodes[stack[--stackSize]];
+      if (node.mIsLeaf)
+      {
+         for (size_t i = node.mFirst; i < node.mFirst + node.mCount; ++i)
+         {
+            const Entry& entry = mEntries[i];
+            if (entry.mBox.Contains(lat, lon) &&
+                aZonePtrs[entry.mZoneIndex]
+                   ->PointIsInside(aSimulationPtr, aViewedPointWCS, aEyePointWCS, aLookHeading, aDeltaDownRange))
+            {
+               return true;
+            }
+         }
+      }
+      else
+      {
+         for (size_t i = node.mFirst; i < node.mFirst + node.mCount; ++i)
+         {
+            if (mNodes[i].mBox.Contains(lat, lon))
+            {
+               stack[stackSize++] = i;
+            }
+         }
+      }
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Get the box that contains all of the zones.
+//! @returns 'false' if any zone is not bounded (or there are no zones).
+bool WsfZoneSet::ZoneIndex::GetBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const
+{
+   if ((!mIsBuilt) || (!mUnboundedZones.empty()) || mNodes.empty())
+   {
+      return false;
+   }
+   const Box& box = mNodes.back().mBox;
+   aMinLat        = box.mMinLat;
+   aMinLon        = box.mMinLon;
+   aMaxLat        = box.mMaxLat;
+   aMaxLon        = box.mMaxLon;
+   return true;
+}
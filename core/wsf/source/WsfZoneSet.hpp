@@ -14,6 +14,8 @@
 
 #include "wsf_export.h"
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 class GeoIntersectDatabase;
@@ -31,6 +33,11 @@ class Terrain;
 //!
 //! This zone construct represents the union of a collection of zones. A point
 //! is considered to be in the zone if it is in any of the member zones.
+//!
+//! Members whose extent does not depend on the observer (see WsfZone::GetInclusionBounds) are placed in a
+//! bounding box hierarchy when the set is initialized, so a point is tested only against the members whose
+//! bounds contain it. The remaining members are tested for every point. The hierarchy is rebuilt on the next
+//! lookup after the shape of a member changes (see WsfZone::GetShapeChangeCount).
 class WSF_EXPORT WsfZoneSet : public WsfZone
 {
 public:
@@ -49,6 +56,9 @@ public:
                       const double   aLookHeading,
                       const double   aDeltaDownRange = 0.0) override;
 
+   bool         GetInclusionBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const override;
+   unsigned int GetShapeChangeCount() const override;
+
    WsfGeoPoint Reference() override;
 
    WsfZone* GetZoneAtIndex(int aIndex);
@@ -69,12 +79,79 @@ protected:
    bool ConstructZoneDatabase();
 
 private:
+   //! A bounding box hierarchy (a packed R-tree) over the latitude/longitude bounds of the members of a zone list.
+   class ZoneIndex
+   {
+   public:
+      void Build(const std::vector<WsfZone*>& aZonePtrs);
+
+      bool PointIsInside(const std::vector<WsfZone*>& aZonePtrs,
+                         WsfSimulation*               aSimulationPtr,
+                         const double                 aViewedPointWCS[3],
+                         const double                 aEyePointWCS[3],
+                         double                       aLookHeading,
+                         double                       aDeltaDownRange,
+                         double                       aViewedLocationLLA[3],
+                         bool&                        aLLA_Valid) const;
+
+      bool GetBounds(double& aMinLat, double& aMinLon, double& aMaxLat, double& aMaxLon) const;
+
+   private:
+      struct Box
+      {
+         bool Contains(double aLat, double aLon) const
+         {
+            return (aLat >= mMinLat) && (aLat <= mMaxLat) && (aLon >= mMinLon) && (aLon <= mMaxLon);
+         }
+         void Include(const Box& aBox);
+
+         double mMinLat;
+         double mMinLon;
+         double mMaxLat;
+         double mMaxLon;
+      };
+
+      //! If mIsLeaf is true, the children are mEntries[mFirst, mFirst + mCount), otherwise they are
+      //! mNodes[mFirst, mFirst + mCount).
+      struct Node
+      {
+         Box    mBox;
+         size_t mFirst;
+         size_t mCount;
+         bool   mIsLeaf;
+      };
+
+      struct Entry
+      {
+         Box    mBox;
+         size_t mZoneIndex;
+      };
+
+      bool                mIsBuilt      = false;
+      size_t              mMaxStackSize = 0; //!< The largest stack needed to search the tree
+      std::vector<Node>   mNodes;            //!< The root is the last node
+      std::vector<Entry>  mEntries;
+      std::vector<size_t> mUnboundedZones; //!< Indices of the members that are tested for every point
+   };
+
    void CalculateBoundingBox();
    void CalculateArea();
    void CalculateCentroid();
 
+   void UpdateIndices() const;
+
    std::vector<WsfZone*> mZonePtrs;
    std::vector<WsfZone*> mExclusionZonePtrs;
+
+   //! The members are checked for changes (under mIndexMutex) when the geometry change count of all zones differs
+   //! from mIndexChangeCount, and the indices are rebuilt only if the sum of the shape change counts of the members
+   //! differs from mMemberChangeCount.
+   mutable ZoneIndex                 mZoneIndex;
+   mutable ZoneIndex                 mExclusionZoneIndex;
+   mutable std::atomic<unsigned int> mIndexChangeCount;
+   mutable unsigned int              mMemberChangeCount;
+   mutable std::mutex                mIndexMutex;
+
    GeoIntersectDatabase* mIntersectDBPtr;
 
    // the following set of variables are used to reconstruct the intersect database as needed
@@ -165,6 +165,14 @@ WsfZoneTypes::LoadResult WsfZoneTypes::LoadType(UtInput& aInput)
    return result;
 }
 
+// =================================================================================================
+bool WsfZoneTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("zone");
+   aKeywords.push_back("zone_set");
+   return true;
+}
+
 // =================================================================================================
 // private
 WsfZone* WsfZoneTypes::ProcessZoneInput(UtInput& aInput)
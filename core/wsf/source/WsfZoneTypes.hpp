@@ -32,6 +32,7 @@ public:
    void InitializeZones(WsfScenario& aScenario);
 
    LoadResult LoadType(UtInput& aInput) override;
+   bool       GetInputKeywords(std::vector<std::string>& aKeywords) const override;
 };
 
 #endif
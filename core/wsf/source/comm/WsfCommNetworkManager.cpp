@@ -50,6 +50,7 @@ NetworkManager::NetworkManager(WsfSimulation* aSimPtr)
    , mMulticastMap()
    , mComms()
    , mRouters()
+   , mChangeCount(0)
 {
 }
 
@@ -728,6 +729,7 @@ void NetworkManager::Clear()
    mNetworkMap.clear();
    mNetworkAddressSet.clear();
    mGraph.Clear();
+   ++mChangeCount;
 }
 
 // =================================================================================================
@@ -840,6 +842,7 @@ Address NetworkManager::AddComm(double       aSimTime,
       {
          //! Address does not exist in manager, use it for this device.
          mAddressToCommMap.insert(std::make_pair(commAddress, aCommPtr));
+         ++mChangeCount;
          mCommToAddressMap.insert(std::make_pair(aCommPtr, commAddress));
          mGraph.CreateNode(commAddress);
 
@@ -854,6 +857,7 @@ Address NetworkManager::AddComm(double       aSimTime,
             //! for potential linking on success, so we have to undo them here on failure.
             mAddressToCommMap.erase(commAddress);
             mCommToAddressMap.erase(aCommPtr);
+            ++mChangeCount;
             mGraph.RemoveNode(commAddress);
             commAddress = Address();
 
@@ -908,6 +912,7 @@ std::string NetworkManager::AddComm(double         aSimTime,
       //! A managing network was found for the user address. Add the comm device to this network.
       returnNetwork = GetNetworkNameFromAddress(*networkAddress);
       mAddressToCommMap.insert(std::make_pair(aAddress, aCommPtr));
+      ++mChangeCount;
       mCommToAddressMap.insert(std::make_pair(aCommPtr, aAddress));
       mGraph.CreateNode(aAddress);
 
@@ -921,6 +926,7 @@ std::string NetworkManager::AddComm(double         aSimTime,
          //! for potential linking on success, so we have to undo them here on failure.
          mAddressToCommMap.erase(aAddress);
          mCommToAddressMap.erase(aCommPtr);
+         ++mChangeCount;
          mGraph.RemoveNode(aAddress);
          returnNetwork = std::string();
 
@@ -972,6 +978,7 @@ std::string NetworkManager::AddComm(double         aSimTime,
       //! New network created. Add this address to indicate its being managed.
       returnNetwork = networkName;
       mAddressToCommMap.insert(std::make_pair(aAddress, aCommPtr));
+      ++mChangeCount;
       mCommToAddressMap.insert(std::make_pair(aCommPtr, aAddress));
       mGraph.CreateNode(aAddress);
 
@@ -984,6 +991,7 @@ std::string NetworkManager::AddComm(double         aSimTime,
          //! for potential linking on success, so we have to undo them here on failure.
          mAddressToCommMap.erase(aAddress);
          mCommToAddressMap.erase(aCommPtr);
+         ++mChangeCount;
          mGraph.RemoveNode(aAddress);
          RemoveNetwork(aSimTime, networkName);
          returnNetwork = std::string();
@@ -1052,6 +1060,7 @@ void NetworkManager::RemoveComm(double aSimTime, const Address& aAddress,
       mAddressToCommMap.erase(aAddress);
       mCommToAddressMap.erase(commPtr);
       mAddressToNetworkMap.erase(aAddress);
+      ++mChangeCount;
 
       //! Update the affected comm.
       commPtr->SetAddress(Address());
@@ -1454,6 +1463,7 @@ void NetworkManager::PlatformDeleted(double aSimTime, WsfPlatform* aPlatform)
 
          mAddressToCommMap.erase(iter->GetAddress());
          mCommToAddressMap.erase(*iter);
+         ++mChangeCount;
       }
    }
 }
@@ -1542,6 +1552,10 @@ bool NetworkManager::AddMulticastMember(double aSimTime, const Address& aMultica
       }
    }
 
+   if (added)
+   {
+      ++mChangeCount;
+   }
    return added;
 }
 
@@ -1566,6 +1580,10 @@ bool NetworkManager::RemoveMulticastMember(double aSimTime, const Address& aMult
       }
    }
 
+   if (removed)
+   {
+      ++mChangeCount;
+   }
    return removed;
 }
 
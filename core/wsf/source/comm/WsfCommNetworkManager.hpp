@@ -290,6 +290,12 @@ public:
    //! that may initially only have access to the Network Manager
    WsfSimulation* GetSimulation() const { return mSimulationPtr; }
 
+   //! @name GetChangeCount
+   //! Returns a count that is incremented whenever a comm address is assigned or released,
+   //! or the membership of a multicast address changes. Users that cache resolved addresses
+   //! (such as external links) may compare it to detect a change.
+   unsigned int GetChangeCount() const { return mChangeCount; }
+
    //! @name Network Manager Callbacks
    //@{
    void PlatformDeleted(double aSimTime, WsfPlatform* aPlatform);
@@ -374,6 +380,10 @@ private:
 
    //! A list of routers for proper notifications/processing
    RouterVector mRouters;
+
+   //! Incremented whenever the address to comm mapping or the multicast
+   //! memberships change. See GetChangeCount().
+   unsigned int mChangeCount;
 };
 
 class NetworkManagerExtension : public WsfScenarioExtension
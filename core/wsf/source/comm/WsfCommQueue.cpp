@@ -14,8 +14,6 @@
 #include <algorithm>
 #include <memory>
 
-#include "UtCast.hpp"
-
 namespace wsf
 {
 namespace comm
@@ -36,6 +34,37 @@ void Queue::Entry::SetMessage(Message* aMessagePtr)
    }
 }
 
+// ==========================================================================
+Queue::Queue(const Queue& aSrc)
+   : mQueueType(aSrc.mQueueType)
+   , mLimit(aSrc.mLimit)
+{
+   for (const auto& slot : aSrc.mQueue)
+   {
+      Insert(slot.mEntry);
+   }
+}
+
+// ==========================================================================
+Queue& Queue::operator=(const Queue& aRhs)
+{
+   if (this != &aRhs)
+   {
+      mQueueType = aRhs.mQueueType;
+      mLimit     = aRhs.mLimit;
+      mQueue.clear();
+      mActiveEntries.clear();
+      mPriorityHeap.clear();
+      mIdentifierEntries.clear();
+      mNextSequence = 0;
+      for (const auto& slot : aRhs.mQueue)
+      {
+         Insert(slot.mEntry);
+      }
+   }
+   return *this;
+}
+
 // ==========================================================================
 bool Queue::Push(const Entry& aEntry)
 {
@@ -52,7 +81,7 @@ bool Queue::Push(const Entry& aEntry)
          throw std::logic_error("Invalid attempt to add member to queue without message members.");
       }
 
-      mQueue.emplace_back(aEntry);
+      Insert(aEntry);
       ok = true;
    }
 
@@ -70,48 +99,18 @@ void Queue::Pop()
       {
       case QueueType::cFIFO:
       {
-         for (auto it = std::begin(mQueue); it != std::end(mQueue); ++it)
-         {
-            if (it->GetStatus() == Entry::EntryStatus::cQUEUED)
-            {
-               it->SetStatus(Entry::EntryStatus::cPROCESSED);
-               return;
-            }
-         }
+         Deactivate(*mActiveEntries.begin()->second);
          break;
       }
       case QueueType::cLIFO:
       {
-         for (auto it = mQueue.rbegin(); it != mQueue.rend(); ++it)
-         // for (auto it = std::rbegin(mQueue); it != std::rend(mQueue); ++it) // C++14
-         {
-            if (it->GetStatus() == Entry::EntryStatus::cQUEUED)
-            {
-               it->SetStatus(Entry::EntryStatus::cPROCESSED);
-               return;
-            }
-         }
+         Deactivate(*mActiveEntries.rbegin()->second);
          break;
       }
       case QueueType::cPRIORITY:
       {
-         // Create a subset of only valid entries.
-         auto queueCopy = mQueue;
-         queueCopy.erase(std::remove_if(std::begin(queueCopy),
-                                        std::end(queueCopy),
-                                        [](const Entry& aEntry)
-                                        { return (aEntry.GetStatus() != Entry::EntryStatus::cQUEUED); }),
-                         std::end(queueCopy));
-
-         //! Always valid iterator due to initial check of non-empty queue
-         auto it = std::max_element(std::begin(queueCopy),
-                                    std::end(queueCopy),
-                                    [](const Entry& aLhs, const Entry& aRhs) {
-                                       return aLhs.GetMessage()->SourceMessage()->GetPriority() <
-                                              aRhs.GetMessage()->SourceMessage()->GetPriority();
-                                    });
-
-         Message::Identifier identifier(*it->GetMessage());
+         //! Always valid due to initial check of non-empty queue
+         Message::Identifier identifier(*mPriorityHeap.front()->mEntry.GetMessage());
          EntryProcessed(identifier);
          break;
       }
@@ -126,55 +125,22 @@ void Queue::Pop()
 // ==========================================================================
 const Queue::Entry& Queue::Top() const
 {
-   //! Check for non-empty std::list needed to avoid undefined behavior.
    if (!EmptyActiveEntries())
    {
       switch (mQueueType)
       {
       case QueueType::cFIFO:
       {
-         for (auto it = std::begin(mQueue); it != std::end(mQueue); ++it)
-         {
-            if (it->GetStatus() == Entry::EntryStatus::cQUEUED)
-            {
-               return *it;
-            }
-         }
-
-         break;
+         return mActiveEntries.begin()->second->mEntry;
       }
       case QueueType::cLIFO:
       {
-         for (auto it = mQueue.rbegin(); it != mQueue.rend(); ++it)
-         // for (auto it = std::rbegin(mQueue); it != std::rend(mQueue); ++it) // C++14
-         {
-            if (it->GetStatus() == Entry::EntryStatus::cQUEUED)
-            {
-               return *it;
-            }
-         }
-
-         break;
+         return mActiveEntries.rbegin()->second->mEntry;
       }
       case QueueType::cPRIORITY:
       {
-         // Create a subset of only valid entries.
-         auto queueCopy = mQueue;
-         queueCopy.erase(std::remove_if(std::begin(queueCopy),
-                                        std::end(queueCopy),
-                                        [](const Entry& aEntry)
-                                        { return (aEntry.GetStatus() != Entry::EntryStatus::cQUEUED); }),
-                         std::end(queueCopy));
-
-         //! Always valid iterator due to initial check of non-empty queue
-         auto it = std::max_element(std::begin(queueCopy),
-                                    std::end(queueCopy),
-                                    [](const Entry& aLhs, const Entry& aRhs) {
-                                       return aLhs.GetMessage()->SourceMessage()->GetPriority() <
-                                              aRhs.GetMessage()->SourceMessage()->GetPriority();
-                                    });
-
-         Message::Identifier identifier(*it->GetMessage());
+         //! Always valid due to initial check of non-empty queue
+         Message::Identifier identifier(*mPriorityHeap.front()->mEntry.GetMessage());
          return *Peek(identifier);
       }
       default:
@@ -190,14 +156,10 @@ const Queue::Entry& Queue::Top() const
 // ==========================================================================
 const Queue::Entry* Queue::Peek(const Message::Identifier& aIdentifier) const
 {
-   auto it = std::find_if(std::begin(mQueue),
-                          std::end(mQueue),
-                          [aIdentifier](const Entry& aEntry)
-                          { return Message::Identifier(*aEntry.GetMessage()) == aIdentifier; });
-
-   if (it != std::end(mQueue))
+   auto it = Find(aIdentifier);
+   if (it != mQueue.end())
    {
-      return &(*it);
+      return &(it->mEntry);
    }
 
    return nullptr;
@@ -209,37 +171,20 @@ Queue::Entry* Queue::Peek(const Message::Identifier& aIdentifier)
    return const_cast<Entry*>(const_cast<const Queue*>(this)->Peek(aIdentifier));
 }
 
-// ==========================================================================
-size_t Queue::SizeActiveEntries() const
-{
-   auto count = std::count_if(std::begin(mQueue),
-                              std::end(mQueue),
-                              [](const Entry& aEntry) { return (aEntry.GetStatus() == Entry::EntryStatus::cQUEUED); });
-
-   return ut::safe_cast<size_t>(count);
-}
-
-// ==========================================================================
-bool Queue::EmptyActiveEntries() const
-{
-   return (SizeActiveEntries() == 0U);
-}
-
 // ==========================================================================
 std::vector<Queue::Entry> Queue::Remove(double aTime)
 {
+   // Only entries with a status of cQUEUED are removed, so only those need to be examined.
    std::vector<Entry> removedEntries;
-   auto               it = std::stable_partition(std::begin(mQueue),
-                                   std::end(mQueue),
-                                   [aTime](const Entry& entry) {
-                                      return ((entry.GetQueueTime() > aTime) ||
-                                              (entry.GetStatus() != Entry::EntryStatus::cQUEUED));
-                                   });
-
-   if (it != std::end(mQueue))
+   for (auto it = std::begin(mActiveEntries); it != std::end(mActiveEntries);)
    {
-      removedEntries.assign(it, std::end(mQueue));
-      mQueue.erase(it, std::end(mQueue));
+      auto slotIter = it->second;
+      ++it;
+      if (!(slotIter->mEntry.GetQueueTime() > aTime))
+      {
+         removedEntries.push_back(slotIter->mEntry);
+         Erase(slotIter);
+      }
    }
 
    return removedEntries;
@@ -248,15 +193,15 @@ std::vector<Queue::Entry> Queue::Remove(double aTime)
 // ==========================================================================
 bool Queue::EntryProcessed(const Message::Identifier& aIdentifier)
 {
-   auto entryPtr = Peek(aIdentifier);
-   if (!entryPtr)
+   auto it = Find(aIdentifier);
+   if (it == mQueue.end())
    {
       return false;
    }
 
-   if (entryPtr->GetStatus() == Entry::EntryStatus::cQUEUED)
+   if (it->mEntry.GetStatus() == Entry::EntryStatus::cQUEUED)
    {
-      entryPtr->SetStatus(Entry::EntryStatus::cPROCESSED);
+      Deactivate(*it);
       return true;
    }
 
@@ -285,19 +230,160 @@ bool Queue::EntryReprocessed(double aSimTime, const Message::Identifier& aIdenti
 // ==========================================================================
 bool Queue::EntryDropped(const Message::Identifier& aIdentifier)
 {
-   auto it = std::find_if(std::begin(mQueue),
-                          std::end(mQueue),
-                          [aIdentifier](const Entry& aEntry)
-                          { return Message::Identifier(*aEntry.GetMessage()) == aIdentifier; });
-
-   if (it != std::end(mQueue))
+   auto it = Find(aIdentifier);
+   if (it != mQueue.end())
    {
-      mQueue.erase(it);
+      Erase(it);
       return true;
    }
 
    return false;
 }
 
+// ==========================================================================
+//! Adds an entry to the end of the queue and its indices.
+// private
+void Queue::Insert(const Entry& aEntry)
+{
+   auto it = mQueue.emplace(mQueue.end(), aEntry, mNextSequence++);
+   mIdentifierEntries[Message::Identifier(*aEntry.GetMessage())].push_back(it);
+   if (aEntry.GetStatus() == Entry::EntryStatus::cQUEUED)
+   {
+      mActiveEntries.emplace_hint(mActiveEntries.end(), it->mSequence, it);
+      it->mHeapIndex = mPriorityHeap.size();
+      mPriorityHeap.push_back(it);
+      HeapSiftUp(it->mHeapIndex);
+   }
+}
+
+// ==========================================================================
+//! Completely removes an entry from the queue and its indices.
+// private
+void Queue::Erase(SlotIterator aSlotIter)
+{
+   if (aSlotIter->mEntry.GetStatus() == Entry::EntryStatus::cQUEUED)
+   {
+      mActiveEntries.erase(aSlotIter->mSequence);
+      HeapErase(aSlotIter->mHeapIndex);
+   }
+
+   auto idIter = mIdentifierEntries.find(Message::Identifier(*aSlotIter->mEntry.GetMessage()));
+   if (idIter != mIdentifierEntries.end())
+   {
+      auto& slots = idIter->second;
+      slots.erase(std::find(std::begin(slots), std::end(slots), aSlotIter));
+      if (slots.empty())
+      {
+         mIdentifierEntries.erase(idIter);
+      }
+   }
+   mQueue.erase(aSlotIter);
+}
+
+// ==========================================================================
+//! Changes the status of an entry from cQUEUED to cPROCESSED and removes it
+//! from the indices of active entries.
+// private
+void Queue::Deactivate(Slot& aSlot)
+{
+   mActiveEntries.erase(aSlot.mSequence);
+   HeapErase(aSlot.mHeapIndex);
+   aSlot.mEntry.SetStatus(Entry::EntryStatus::cPROCESSED);
+}
+
+// ==========================================================================
+//! Returns the first entry with the specified identifier, or the end of the queue if there is none.
+// private
+Queue::SlotIterator Queue::Find(const Message::Identifier& aIdentifier) const
+{
+   auto it = mIdentifierEntries.find(aIdentifier);
+   if (it != mIdentifierEntries.end())
+   {
+      return it->second.front();
+   }
+   return const_cast<SlotList&>(mQueue).end();
+}
+
+// ==========================================================================
+//! Returns true if the entry at the first heap position is to be popped before the second.
+//! Entries of equal priority are popped in the order they were pushed.
+// private
+bool Queue::HeapPrecedes(size_t aLhsIndex, size_t aRhsIndex) const
+{
+   const Slot& lhs = *mPriorityHeap[aLhsIndex];
+   const Slot& rhs = *mPriorityHeap[aRhsIndex];
+   return (lhs.mPriority > rhs.mPriority) || ((lhs.mPriority == rhs.mPriority) && (lhs.mSequence < rhs.mSequence));
+}
+
+// ==========================================================================
+// private
+void Queue::HeapSwap(size_t aLhsIndex, size_t aRhsIndex)
+{
+   std::swap(mPriorityHeap[aLhsIndex], mPriorityHeap[aRhsIndex]);
+   mPriorityHeap[aLhsIndex]->mHeapIndex = aLhsIndex;
+   mPriorityHeap[aRhsIndex]->mHeapIndex = aRhsIndex;
+}
+
+// ==========================================================================
+// private
+void Queue::HeapSiftUp(size_t aIndex)
+{
+   while (aIndex > 0)
+   {
+      size_t parent = (aIndex - 1) / 2;
+      if (!HeapPrecedes(aIndex, parent))
+      {
+         break;
+      }
+      HeapSwap(aIndex, parent);
+      aIndex = parent;
+   }
+}
+
+// ==========================================================================
+// private
+void Queue::HeapSiftDown(size_t aIndex)
+{
+   size_t size = mPriorityHeap.size();
+   while (true)
+   {
+      size_t first = aIndex;
+      size_t left  = (2 * aIndex) + 1;
+      size_t right = left + 1;
+      if ((left < size) && HeapPrecedes(left, first))
+      {
+         first = left;
+      }
+      if ((right < size) && HeapPrecedes(right, first))
+      {
+         first = right;
+      }
+      if (first == aIndex)
+      {
+         break;
+      }
+      HeapSwap(aIndex, first);
+      aIndex = first;
+   }
+}
+
+// ==========================================================================
+// private
+void Queue::HeapErase(size_t aIndex)
+{
+   size_t last = mPriorityHeap.size() - 1;
+   if (aIndex != last)
+   {
+      HeapSwap(aIndex, last);
+      mPriorityHeap.pop_back();
+      HeapSiftUp(aIndex);
+      HeapSiftDown(aIndex);
+   }
+   else
+   {
+      mPriorityHeap.pop_back();
+   }
+}
+
 } // namespace comm
 } // namespace wsf
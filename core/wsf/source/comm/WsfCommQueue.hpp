@@ -16,7 +16,9 @@
 
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "UtCloneablePtr.hpp"
@@ -33,6 +35,13 @@ namespace comm
 //! type. However, messages may have different lifetimes. As such, this container
 //! must differentiate messages based on their status, and must have visibility
 //! into the container beyond the top entry.
+//!
+//! Entries are held in the order they were pushed. Entries able to be 'popped'
+//! (those with a status of cQUEUED) are also indexed in push order and in a heap
+//! ordered by priority, so the next entry is found without examining entries that
+//! have already been processed. Entries are also indexed by message identifier.
+//! As such, the status and message of an entry in the queue must only be changed
+//! through the queue's methods (e.g. EntryProcessed), not through the entry itself.
 class WSF_EXPORT Queue
 {
 public:
@@ -84,7 +93,9 @@ public:
       EntryStatus               mStatus{EntryStatus::cQUEUED};
    };
 
-   Queue()          = default;
+   Queue() = default;
+   Queue(const Queue& aSrc);
+   Queue& operator=(const Queue& aRhs);
    virtual ~Queue() = default;
 
    bool Push(const Entry& aEntry);
@@ -107,14 +118,14 @@ public:
 
    //! Provides the size of entries able to be 'popped',
    //! i.e. those with a status of cQUEUED.
-   size_t SizeActiveEntries() const;
+   size_t SizeActiveEntries() const { return mActiveEntries.size(); }
 
    //! If the queue is empty, regardless of entry status.
    bool Empty() const { return mQueue.empty(); }
 
    //! Indicates presence of any entries able to be 'popped',
    //! i.e. those with a status of cQUEUED.
-   bool EmptyActiveEntries() const;
+   bool EmptyActiveEntries() const { return mActiveEntries.empty(); }
 
    QueueType GetQueueType() const { return mQueueType; }
    void      SetQueueType(QueueType aType) { mQueueType = aType; }
@@ -147,9 +158,58 @@ public:
    //@}
 
 private:
-   QueueType        mQueueType{QueueType::cFIFO};
-   size_t           mLimit{std::numeric_limits<size_t>::max()};
-   std::list<Entry> mQueue{};
+   //! An entry and the information used to index it.
+   struct Slot
+   {
+      Slot(const Entry& aEntry, size_t aSequence)
+         : mEntry(aEntry)
+         , mSequence(aSequence)
+         , mPriority(aEntry.GetMessage()->SourceMessage()->GetPriority())
+         , mHeapIndex(0)
+      {
+      }
+
+      Entry  mEntry;
+      size_t mSequence;  //!< The order in which the entry was pushed.
+      int    mPriority;  //!< The message priority when the entry was pushed.
+      size_t mHeapIndex; //!< The position of the entry in mPriorityHeap, if it is active.
+   };
+
+   using SlotList     = std::list<Slot>;
+   using SlotIterator = SlotList::iterator;
+
+   void Insert(const Entry& aEntry);
+   void Erase(SlotIterator aSlotIter);
+   void Deactivate(Slot& aSlot);
+
+   SlotIterator Find(const Message::Identifier& aIdentifier) const;
+
+   //! Priority heap methods.
+   //@{
+   bool HeapPrecedes(size_t aLhsIndex, size_t aRhsIndex) const;
+   void HeapSwap(size_t aLhsIndex, size_t aRhsIndex);
+   void HeapSiftUp(size_t aIndex);
+   void HeapSiftDown(size_t aIndex);
+   void HeapErase(size_t aIndex);
+   //@}
+
+   QueueType mQueueType{QueueType::cFIFO};
+   size_t    mLimit{std::numeric_limits<size_t>::max()};
+
+   //! All of the entries, in the order they were pushed.
+   SlotList mQueue{};
+
+   //! The entries with a status of cQUEUED, keyed by push order.
+   std::map<size_t, SlotIterator> mActiveEntries{};
+
+   //! The entries with a status of cQUEUED, as a binary heap ordered by decreasing priority.
+   //! Entries of equal priority are ordered by push order.
+   std::vector<SlotIterator> mPriorityHeap{};
+
+   //! The entries with each message identifier, in push order.
+   std::unordered_map<Message::Identifier, std::vector<SlotIterator>> mIdentifierEntries{};
+
+   size_t mNextSequence{0};
 };
 
 } // namespace comm
@@ -364,6 +364,10 @@ const char* Router::GetScriptClassName() const
    return "WsfCommRouter";
 }
 
+// ============================================================================
+//! Routing does not depend on the addition or deletion of other platforms.
+void Router::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // =================================================================================================
 bool Router::AddLink(double             aSimTime,
                      const Address&     aSender,
@@ -145,6 +145,7 @@ public:
    bool         ProcessInput(UtInput& aInput) override;
    virtual bool ProcessTypeAddEditDelete(UtInput& aInput);
    const char*  GetScriptClassName() const override;
+   void         AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    //@}
 
    //! @name Status methods.
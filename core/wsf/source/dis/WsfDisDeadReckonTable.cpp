@@ -0,0 +1,264 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "dis/WsfDisDeadReckonTable.hpp"
+
+#include "DisEntityState.hpp"
+
+namespace
+{
+const size_t cNO_SLOT = static_cast<size_t>(-1);
+
+// Overwrite the entry at aSlot with the last entry and shrink the array by one.
+template<typename T>
+void RemoveSlot(std::vector<T>& aArray, size_t aSlot)
+{
+   aArray[aSlot] = aArray.back();
+   aArray.pop_back();
+}
+} // namespace
+
+// ============================================================================
+WsfDisDeadReckonTable::WsfDisDeadReckonTable()
+   : mSlotOfPlatform()
+   , mPlatformIndex()
+   , mValid()
+   , mUpdateTime()
+   , mLocX()
+   , mLocY()
+   , mLocZ()
+   , mVelX()
+   , mVelY()
+   , mVelZ()
+   , mAclX()
+   , mAclY()
+   , mAclZ()
+   , mResultTime()
+   , mResultLocX()
+   , mResultLocY()
+   , mResultLocZ()
+   , mResultVelX()
+   , mResultVelY()
+   , mResultVelZ()
+{
+}
+
+// ============================================================================
+//! Indicate that a new entity state has been received for the specified platform.
+//! The entry will be reloaded from the entity state the next time it is requested.
+void WsfDisDeadReckonTable::Invalidate(size_t aPlatformIndex)
+{
+   if ((aPlatformIndex < mSlotOfPlatform.size()) && (mSlotOfPlatform[aPlatformIndex] != cNO_SLOT))
+   {
+      mValid[mSlotOfPlatform[aPlatformIndex]] = 0;
+   }
+}
+
+// ============================================================================
+//! Remove the entry for the specified platform (if one exists).
+void WsfDisDeadReckonTable::Remove(size_t aPlatformIndex)
+{
+   if ((aPlatformIndex >= mSlotOfPlatform.size()) || (mSlotOfPlatform[aPlatformIndex] == cNO_SLOT))
+   {
+      return;
+   }
+
+   size_t slot                     = mSlotOfPlatform[aPlatformIndex];
+   mSlotOfPlatform[aPlatformIndex] = cNO_SLOT;
+   RemoveSlot(mPlatformIndex, slot);
+   if (slot < mPlatformIndex.size())
+   {
+      mSlotOfPlatform[mPlatformIndex[slot]] = slot;
+   }
+   RemoveSlot(mValid, slot);
+   RemoveSlot(mUpdateTime, slot);
+   RemoveSlot(mLocX, slot);
+   RemoveSlot(mLocY, slot);
+   RemoveSlot(mLocZ, slot);
+   RemoveSlot(mVelX, slot);
+   RemoveSlot(mVelY, slot);
+   RemoveSlot(mVelZ, slot);
+   RemoveSlot(mAclX, slot);
+   RemoveSlot(mAclY, slot);
+   RemoveSlot(mAclZ, slot);
+   RemoveSlot(mResultTime, slot);
+   RemoveSlot(mResultLocX, slot);
+   RemoveSlot(mResultLocY, slot);
+   RemoveSlot(mResultLocZ, slot);
+   RemoveSlot(mResultVelX, slot);
+   RemoveSlot(mResultVelY, slot);
+   RemoveSlot(mResultVelZ, slot);
+}
+
+// ============================================================================
+//! Remove all entries.
+void WsfDisDeadReckonTable::Clear()
+{
+   *this = WsfDisDeadReckonTable();
+}
+
+// ============================================================================
+//! Extrapolate every entry in the table to the specified time.
+//! Entries that are waiting to be reloaded are also extrapolated, but their results are discarded when requested.
+void WsfDisDeadReckonTable::ExtrapolateAll(double aSimTime)
+{
+   Extrapolate(0, mPlatformIndex.size(), aSimTime);
+}
+
+// ============================================================================
+//! Get the extrapolated kinematic state of a platform.
+//! @param aSimTime               The time to which the state is to be extrapolated.
+//! @param aPlatformIndex         The platform index of the entity.
+//! @param aEntityStateUpdateTime The simulation time at which the entity state was received.
+//! @param aEntityState           The last received entity state for the entity.
+//! @param aLocationWCS           [output] The extrapolated location.
+//! @param aVelocityWCS           [output] The extrapolated velocity.
+//! @param aAccelerationWCS       [output] The acceleration used for extrapolation.
+void WsfDisDeadReckonTable::GetState(double                aSimTime,
+                                     size_t                aPlatformIndex,
+                                     double                aEntityStateUpdateTime,
+                                     const DisEntityState& aEntityState,
+                                     double                aLocationWCS[3],
+                                     double                aVelocityWCS[3],
+                                     double                aAccelerationWCS[3])
+{
+   size_t slot = GetSlot(aPlatformIndex);
+   if ((mValid[slot] == 0) || (mUpdateTime[slot] != aEntityStateUpdateTime))
+   {
+      Load(slot, aEntityStateUpdateTime, aEntityState);
+      Extrapolate(slot, slot + 1, aSimTime);
+   }
+   else if (mResultTime[slot] != aSimTime)
+   {
+      Extrapolate(slot, slot + 1, aSimTime);
+   }
+
+   aLocationWCS[0]     = mResultLocX[slot];
+   aLocationWCS[1]     = mResultLocY[slot];
+   aLocationWCS[2]     = mResultLocZ[slot];
+   aVelocityWCS[0]     = mResultVelX[slot];
+   aVelocityWCS[1]     = mResultVelY[slot];
+   aVelocityWCS[2]     = mResultVelZ[slot];
+   aAccelerationWCS[0] = mAclX[slot];
+   aAccelerationWCS[1] = mAclY[slot];
+   aAccelerationWCS[2] = mAclZ[slot];
+}
+
+// ============================================================================
+//! Return the slot for the specified platform, creating an (invalid) entry if necessary.
+// private
+size_t WsfDisDeadReckonTable::GetSlot(size_t aPlatformIndex)
+{
+   if (aPlatformIndex >= mSlotOfPlatform.size())
+   {
+      mSlotOfPlatform.resize(aPlatformIndex + 1, cNO_SLOT);
+   }
+   size_t slot = mSlotOfPlatform[aPlatformIndex];
+   if (slot == cNO_SLOT)
+   {
+      slot                            = mPlatformIndex.size();
+      mSlotOfPlatform[aPlatformIndex] = slot;
+      mPlatformIndex.push_back(aPlatformIndex);
+      mValid.push_back(0);
+      mUpdateTime.push_back(0.0);
+      mLocX.push_back(0.0);
+      mLocY.push_back(0.0);
+      mLocZ.push_back(0.0);
+      mVelX.push_back(0.0);
+      mVelY.push_back(0.0);
+      mVelZ.push_back(0.0);
+      mAclX.push_back(0.0);
+      mAclY.push_back(0.0);
+      mAclZ.push_back(0.0);
+      mResultTime.push_back(-1.0);
+      mResultLocX.push_back(0.0);
+      mResultLocY.push_back(0.0);
+      mResultLocZ.push_back(0.0);
+      mResultVelX.push_back(0.0);
+      mResultVelY.push_back(0.0);
+      mResultVelZ.push_back(0.0);
+   }
+   return slot;
+}
+
+// ============================================================================
+//! Load an entry from an entity state PDU.
+//! Static, frozen or inactive entities are loaded with zero velocity and acceleration, and the acceleration is
+//! zero unless the dead reckoning algorithm uses it. This allows all entries to be extrapolated the same way.
+// private
+void WsfDisDeadReckonTable::Load(size_t aSlot, double aEntityStateUpdateTime, const DisEntityState& aEntityState)
+{
+   double locX, locY, locZ;
+   float  vx = 0.0F, vy = 0.0F, vz = 0.0F;
+   float  ax = 0.0F, ay = 0.0F, az = 0.0F;
+   aEntityState.GetLocation(locX, locY, locZ);
+
+   DisUint32 frozenOrInactive = (1 << 21) | (1 << 23);
+   DisEnum8  algorithm        = aEntityState.GetDeadreckoningAlgorithm();
+   if ((algorithm != 1) &&                                        // Not static ...
+       ((aEntityState.GetAppearance() & frozenOrInactive) == 0)) // ... and not (frozen or inactive)
+   {
+      aEntityState.GetVelocity(vx, vy, vz);
+      if ((algorithm == 4) || // DRM(RVW)
+          (algorithm == 5))   // DRM(FVW)
+      {
+         aEntityState.GetAcceleration(ax, ay, az);
+      }
+   }
+
+   mValid[aSlot]      = 1;
+   mUpdateTime[aSlot] = aEntityStateUpdateTime;
+   mLocX[aSlot]       = locX;
+   mLocY[aSlot]       = locY;
+   mLocZ[aSlot]       = locZ;
+   mVelX[aSlot]       = vx;
+   mVelY[aSlot]       = vy;
+   mVelZ[aSlot]       = vz;
+   mAclX[aSlot]       = ax;
+   mAclY[aSlot]       = ay;
+   mAclZ[aSlot]       = az;
+}
+
+// ============================================================================
+//! Extrapolate the entries in the range [aBegin, aEnd) to the specified time.
+// private
+void WsfDisDeadReckonTable::Extrapolate(size_t aBegin, size_t aEnd, double aSimTime)
+{
+   const double* updateTime = mUpdateTime.data();
+   const double* locX       = mLocX.data();
+   const double* locY       = mLocY.data();
+   const double* locZ       = mLocZ.data();
+   const double* velX       = mVelX.data();
+   const double* velY       = mVelY.data();
+   const double* velZ       = mVelZ.data();
+   const double* aclX       = mAclX.data();
+   const double* aclY       = mAclY.data();
+   const double* aclZ       = mAclZ.data();
+   double*       resultTime = mResultTime.data();
+   double*       resultLocX = mResultLocX.data();
+   double*       resultLocY = mResultLocY.data();
+   double*       resultLocZ = mResultLocZ.data();
+   double*       resultVelX = mResultVelX.data();
+   double*       resultVelY = mResultVelY.data();
+   double*       resultVelZ = mResultVelZ.data();
+
+   // This loop is intentionally free of branches and aliasing between the inputs and outputs so it can be vectorized.
+   for (size_t i = aBegin; i < aEnd; ++i)
+   {
+      double dt      = aSimTime - updateTime[i];
+      double halfDt2 = 0.5 * dt * dt;
+      resultLocX[i]  = locX[i] + ((velX[i] * dt) + (aclX[i] * halfDt2));
+      resultLocY[i]  = locY[i] + ((velY[i] * dt) + (aclY[i] * halfDt2));
+      resultLocZ[i]  = locZ[i] + ((velZ[i] * dt) + (aclZ[i] * halfDt2));
+      resultVelX[i]  = velX[i] + (aclX[i] * dt);
+      resultVelY[i]  = velY[i] + (aclY[i] * dt);
+      resultVelZ[i]  = velZ[i] + (aclZ[i] * dt);
+      resultTime[i]  = aSimTime;
+   }
+}
@@ -0,0 +1,74 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFDISDEADRECKONTABLE_HPP
+#define WSFDISDEADRECKONTABLE_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <vector>
+
+class DisEntityState;
+
+//! Dead reckoning state for externally controlled DIS entities, stored as a structure of arrays.
+//!
+//! Each entry holds the kinematic state from the last received entity state PDU for one platform.
+//! ExtrapolateAll() extrapolates every entry to a common time in a single pass over contiguous
+//! arrays (which the compiler can vectorize), and GetState() returns the extrapolated state for a
+//! single platform, using the batch result if it is for the requested time and computing it
+//! otherwise. Results are only written to the platform when the platform's mover is updated.
+//!
+//! An entry is (re)loaded from the entity state PDU when it is first requested, when the entity
+//! state update time changes, or after Invalidate() has been called.
+class WSF_EXPORT WsfDisDeadReckonTable
+{
+public:
+   WsfDisDeadReckonTable();
+
+   void Invalidate(size_t aPlatformIndex);
+   void Remove(size_t aPlatformIndex);
+   void Clear();
+
+   void ExtrapolateAll(double aSimTime);
+
+   void GetState(double                aSimTime,
+                 size_t                aPlatformIndex,
+                 double                aEntityStateUpdateTime,
+                 const DisEntityState& aEntityState,
+                 double                aLocationWCS[3],
+                 double                aVelocityWCS[3],
+                 double                aAccelerationWCS[3]);
+
+   //! Return the number of entities in the table.
+   size_t GetSize() const { return mPlatformIndex.size(); }
+
+private:
+   size_t GetSlot(size_t aPlatformIndex);
+   void   Load(size_t aSlot, double aEntityStateUpdateTime, const DisEntityState& aEntityState);
+   void   Extrapolate(size_t aBegin, size_t aEnd, double aSimTime);
+
+   //! Slot for each platform index, or cNO_SLOT if the platform is not in the table.
+   std::vector<size_t> mSlotOfPlatform;
+
+   //! @name Per-slot data.
+   //@{
+   std::vector<size_t> mPlatformIndex;
+   std::vector<char>   mValid;
+   std::vector<double> mUpdateTime;
+   std::vector<double> mLocX, mLocY, mLocZ;
+   std::vector<double> mVelX, mVelY, mVelZ;
+   std::vector<double> mAclX, mAclY, mAclZ;
+   std::vector<double> mResultTime;
+   std::vector<double> mResultLocX, mResultLocY, mResultLocZ;
+   std::vector<double> mResultVelX, mResultVelY, mResultVelZ;
+   //@}
+};
+
+#endif
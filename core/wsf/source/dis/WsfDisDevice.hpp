@@ -58,6 +58,10 @@ public:
 
    virtual void PutPduP(double, DisPdu&) = 0;
 
+   //! Send any PDUs that have been buffered by PutPdu but not yet sent.
+   //! Devices that do not buffer output need not implement this.
+   virtual void Flush() {}
+
    DeviceType         GetDeviceType() const { return mDeviceType; }
    virtual GenUDP_IO* GenUDP_IOPtr() { return nullptr; }
 
@@ -27,17 +27,24 @@
 #include "dis/WsfDisUtil.hpp"
 #include "ext/WsfExtInterface.hpp"
 
+namespace
+{
+//! The maximum number of received PDUs that may be waiting for the simulation thread.
+const size_t cINCOMING_QUEUE_CAPACITY = 65536;
+} // namespace
+
 // ============================================================================
 WsfDisIO_Thread::WsfDisIO_Thread(WsfDisInterface* aInterfacePtr)
    : WsfThread()
-   , mIncomingMutex()
    , mOutboundMutex()
    , mInterfacePtr(aInterfacePtr)
    , mThreadState(RCV_INCOMING)
    , mSendOutboundPDUs(false)
    , mReceivePDUs(false)
-   , mIncomingPDUs()
+   , mIncomingPDUs(cINCOMING_QUEUE_CAPACITY)
    , mOutboundPDUs()
+   , mPendingPduPtr(nullptr)
+   , mFilteredPDUs(0)
    , mWaitForStartPDU(false)
    , mSimTime(0.0)
    , mLastUpdate(0.0)
@@ -51,11 +58,8 @@ WsfDisIO_Thread::WsfDisIO_Thread(WsfDisInterface* aInterfacePtr)
 // virtual
 WsfDisIO_Thread::~WsfDisIO_Thread()
 {
-   for (std::list<DisPdu*>::iterator InPduIt = mIncomingPDUs.begin(); InPduIt != mIncomingPDUs.end(); ++InPduIt)
-   {
-      delete (*InPduIt);
-   }
-   mIncomingPDUs.clear(); //! Work queue of Incoming PDUs to process
+   // Any PDUs remaining in the incoming queue are deleted by the queue.
+   delete mPendingPduPtr;
 
    mOutboundPDUs.clear(); //! Work queue of Outgoing PDUs to process
 }
@@ -136,7 +140,7 @@ void WsfDisIO_Thread::TransitionState()
       // Check for transition to process outbound PDUs or to work complete
       if (!mWaitForStartPDU)
       {
-         if (mIncomingPDUs.empty() || (!mReceivePDUs))
+         if (mIncomingPDUs.Empty() || (!mReceivePDUs))
          {
             if (mSendOutboundPDUs && (!mOutboundPDUs.empty()))
             {
@@ -239,17 +243,16 @@ void WsfDisIO_Thread::PutPdu(double aSimTime, std::unique_ptr<DisPdu> aPduPtr)
 //! Called from the main thread to get the next PDU from the receive queue.
 DisPdu* WsfDisIO_Thread::GetPdu()
 {
-   DisPdu* pduPtr = nullptr;
-
-   std::lock_guard<std::recursive_mutex> lock(mIncomingMutex);
+   return mIncomingPDUs.Pop();
+}
 
-   if (!mIncomingPDUs.empty())
-   {
-      std::list<DisPdu*>::iterator iterBegin = mIncomingPDUs.begin();
-      pduPtr                                 = *iterBegin;
-      mIncomingPDUs.pop_front();
-   }
-   return pduPtr;
+// ============================================================================
+//! Called from the main thread to get all of the PDUs currently in the receive queue.
+//! @param aPdus [output] The received PDUs are appended to this list. Ownership passes to the caller.
+//! @returns The number of PDUs that were appended.
+size_t WsfDisIO_Thread::GetPdus(std::vector<DisPdu*>& aPdus)
+{
+   return mIncomingPDUs.PopAll(aPdus);
 }
 
 // ============================================================================
@@ -327,7 +330,16 @@ void WsfDisIO_Thread::ReceivePDUs()
       do
       {
          mWallClock.ResetClock();
-         DisPdu* pduPtr = mInterfacePtr->GetPdu();
+
+         // Queue the PDU that was left over from the previous pass because the queue was full.
+         // Nothing more is read from the devices until it has been queued.
+         if ((mPendingPduPtr != nullptr) && mIncomingPDUs.Push(mPendingPduPtr))
+         {
+            mPendingPduPtr = nullptr;
+            ++numIncomingPDUs;
+         }
+
+         DisPdu* pduPtr = (mPendingPduPtr == nullptr) ? mInterfacePtr->GetPdu() : nullptr;
          while (pduPtr != nullptr)
          {
             if (pduPtr->GetExerciseIdentifier() == Dis::GetExercise())
@@ -337,11 +349,31 @@ void WsfDisIO_Thread::ReceivePDUs()
                if (/*(pduPtr->GetPduType() != DisEnum::Pdu::Type::EntityState) &&*/
                    (pduPtr->GetPduType() != DisEnum::Pdu::Type::StartResume))
                {
-                  // queue up everything except entity states for processing later
-                  mIncomingMutex.lock();
-                  mIncomingPDUs.push_back(pduPtr);
-                  mIncomingMutex.unlock();
-                  ++numIncomingPDUs;
+                  // queue up everything except entity states for processing later.
+                  // PDUs rejected by the input filters are discarded here so they never reach the simulation thread.
+                  if (!mInterfacePtr->PassesInputFilters(pduPtr))
+                  {
+                     delete pduPtr;
+                     ++mFilteredPDUs;
+                  }
+                  else if (mIncomingPDUs.Push(pduPtr))
+                  {
+                     ++numIncomingPDUs;
+                  }
+                  else if (mWaitForStartPDU)
+                  {
+                     // The queue is not drained while waiting for the Start PDU, so holding on to the PDU
+                     // would prevent the Start PDU from ever being read.
+                     delete pduPtr;
+                  }
+                  else
+                  {
+                     // The simulation thread has fallen behind. Hold on to the PDU and let the remaining
+                     // data wait in the device until the queue has been drained.
+                     mPendingPduPtr = pduPtr;
+                     mTimedOut      = true;
+                     break;
+                  }
                }
                else
                {
@@ -433,6 +465,12 @@ void WsfDisIO_Thread::SendOutboundPDUs()
       }
    }
 
+   // Send any PDUs that were left in partially filled bundles.
+   if (mInterfacePtr->HasOutputDevice())
+   {
+      mInterfacePtr->FlushDevices();
+   }
+
    // If some PDUs were processed then remove them from the work queue
    if (iter != mOutboundPDUs.begin())
    {
@@ -17,14 +17,17 @@
 
 #include "wsf_export.h"
 
+#include <atomic>
 #include <list>
 #include <mutex>
+#include <vector>
 
 class DisPdu;
 
 class UtInput;
 #include "UtWallClock.hpp"
 class WsfDisInterface;
+#include "dis/WsfDisPduRing.hpp"
 #include "WsfThread.hpp"
 
 //! DIS interface implementation of worker thread
@@ -50,6 +53,10 @@ public:
 
    DisPdu* GetPdu();
 
+   size_t GetPdus(std::vector<DisPdu*>& aPdus);
+
+   unsigned int TakeFilteredPduCount() { return mFilteredPDUs.exchange(0); }
+
    void ImmediatePutPdu(double aSimTime, DisPdu* aPduPtr);
 
    void PutPdu(double aSimTime, std::unique_ptr<DisPdu> aPduPtr);
@@ -78,10 +85,9 @@ private:
       std::unique_ptr<DisPdu> mPduPtr;
    };
 
-   // Mutex for handling thread access to the worker queue
+   // Mutex for handling thread access to the outbound worker queue
    // WsfDisInterface adds PDUs to the queue
    // WsfDisIO_Thread reads and removes PDUs from the queue
-   std::recursive_mutex mIncomingMutex;
    std::recursive_mutex mOutboundMutex;
 
    WsfDisInterface* mInterfacePtr; //! Pointer to the DIS interface
@@ -91,8 +97,17 @@ private:
    bool mSendOutboundPDUs;
    bool mReceivePDUs;
 
-   std::list<DisPdu*> mIncomingPDUs; //! Work queue of Incoming PDUs to process
-   std::list<PDU>     mOutboundPDUs; //! Work queue of Outbound PDUs to process
+   //! Incoming PDUs that have passed the exercise and input filter checks.
+   //! The I/O thread is the only producer and the simulation thread is the only consumer.
+   WsfDisPduRing  mIncomingPDUs;
+   std::list<PDU> mOutboundPDUs; //! Work queue of Outbound PDUs to process
+
+   //! A received PDU that could not be queued because mIncomingPDUs was full.
+   //! It is queued before any other PDU is read on the next pass.
+   DisPdu* mPendingPduPtr;
+
+   //! The number of PDUs rejected by the input filters since the last call to TakeFilteredPduCount.
+   std::atomic<unsigned int> mFilteredPDUs;
 
    bool mWaitForStartPDU; //! Used if not autostarting
 
@@ -34,6 +34,7 @@
 WsfDisInput::WsfDisInput()
    : mMaxBadPDU_Count(5)
    , mMulticastTimeToLive(-1)
+   , mMaximumBundleSize(0)
    , mInputHeartbeatMultiplier(-2.4)
    , mSensorUpdateInterval(0)
 {
@@ -515,6 +516,15 @@ bool WsfDisInput::ProcessBlockInput(WsfScenario& aScenario, UtInput& aInput)
       aInput.ReadValue(mMulticastTimeToLive);
       aInput.ValueInClosedRange(mMulticastTimeToLive, 0, 255);
    }
+   else if (command == "maximum_bundle_size")
+   {
+      // The upper limit is the largest UDP payload. Values above the network MTU less the IP and UDP headers
+      // (1472 bytes for Ethernet) will result in fragmented datagrams.
+      int maximumBundleSize;
+      aInput.ReadValue(maximumBundleSize);
+      aInput.ValueInClosedRange(maximumBundleSize, 0, 65507);
+      mMaximumBundleSize = static_cast<unsigned>(maximumBundleSize);
+   }
    else if (command == "protocol_version")
    {
       int protocolVersion;
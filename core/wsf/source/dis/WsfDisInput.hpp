@@ -157,6 +157,8 @@ public:
    bool   SuppressCME_DetectBeam() const { return mSuppressCME_DetectBeam; }
    double GetSensorUpdateInterval() const { return mSensorUpdateInterval; }
    int    GetTimeToLive() const { return mMulticastTimeToLive; }
+   //! Returns the maximum number of bytes of PDUs sent in a single UDP datagram (0 if bundling is disabled).
+   unsigned GetMaximumBundleSize() const { return mMaximumBundleSize; }
    const WsfDisArticulatedPart::ArticulationList& GetArticulationList() const { return mArticulationList; }
 
    void                 AddComponent(Component* aComponentPtr) { mComponents.AddComponent(aComponentPtr); }
@@ -226,6 +228,7 @@ public:
    };
    unsigned mMaxBadPDU_Count;
    int      mMulticastTimeToLive;
+   unsigned mMaximumBundleSize;
    double   mThreadSleepTime;
 
 protected:
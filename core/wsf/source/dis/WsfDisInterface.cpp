@@ -98,6 +98,8 @@ WsfDisInterface::WsfDisInterface(WsfDisInput& aDIS_Input, WsfSimulation& aSim, W
    , mHeartbeatMultiplier(-2.4)
    , mIsDeferredConnection(false)
    , mIO_ThreadPtr(nullptr)
+   , mIncomingPduBatch()
+   , mDeadReckonTable()
    , mHasInputDevice(false)
    , mHasOutputDevice(false)
    , mHasExternalDevice(false)
@@ -313,6 +315,13 @@ bool WsfDisInterface::ActivateConnection(double aSimTime)
                out.AddNote() << "Port: " << config.mSendPort;
             }
 
+            auto udpDevicePtr = dynamic_cast<WsfDisUDP_Device*>(devicePtr);
+            if ((udpDevicePtr != nullptr) && (mMaximumBundleSize > 0))
+            {
+               udpDevicePtr->SetMaximumBundleSize(mMaximumBundleSize);
+               out.AddNote() << "Maximum Bundle Size: " << mMaximumBundleSize;
+            }
+
             if (mJoinExercise)
             {
                // join exercise is used for a scaled-and-stepped NRT simulation. Per the IEEE std,
@@ -894,6 +903,7 @@ void WsfDisInterface::DeletePlatform(double aSimTime, size_t aPlatformIndex)
          bool        hasBeenReplaced(disPlatformPtr->HasBeenReplaced()); // ...
 
          disPlatformPtr->PlatformDeleted(aSimTime);
+         mDeadReckonTable.Remove(aPlatformIndex);
          delete mDisPlatforms[aPlatformIndex];
          mDisPlatforms[aPlatformIndex] = nullptr;
 
@@ -1155,11 +1165,22 @@ void WsfDisInterface::ImmediatePutPdu(double aSimTime, DisPdu& aPdu)
          for (auto& device : mDevices)
          {
             device->PutPdu(aSimTime - deferredConnectionTime, aPdu);
+            device->Flush();
          }
       }
    }
 }
 
+// ============================================================================
+//! Send any PDUs that have been buffered for bundling by the devices.
+void WsfDisInterface::FlushDevices()
+{
+   for (auto& device : mDevices)
+   {
+      device->Flush();
+   }
+}
+
 // ============================================================================
 //! Read a DIS Entity Id from an input stream.
 //! @param aInput      The input stream
@@ -1214,67 +1235,95 @@ void WsfDisInterface::AdvanceTime(double aSimTime)
    // Get the next PDU from the device and process it.
    if (HasInputDevice())
    {
-      DisPdu* pduPtr = nullptr;
       if (mMultiThreaded)
       {
+         // Drain everything the I/O thread has queued in one batch. The I/O thread has already discarded
+         // PDUs from other exercises and those rejected by the input filters.
          mIO_ThreadPtr->AdvanceTime(aSimTime);
-         pduPtr = mIO_ThreadPtr->GetPdu();
+         for (unsigned int filteredCount = mIO_ThreadPtr->TakeFilteredPduCount(); filteredCount > 0; --filteredCount)
+         {
+            mPduFactoryPtr->IncrementFilteredPduCount();
+         }
+         mIncomingPduBatch.clear();
+         mIO_ThreadPtr->GetPdus(mIncomingPduBatch);
+         for (DisPdu* pduPtr : mIncomingPduBatch)
+         {
+            ProcessIncomingPdu(pduPtr, false);
+         }
+         mIncomingPduBatch.clear();
       }
       else
       {
-         pduPtr = GetPdu();
+         // Loop through all pending PDUs
+         DisPdu* pduPtr = GetPdu();
+         while (pduPtr != nullptr)
+         {
+            ProcessIncomingPdu(pduPtr, true);
+            pduPtr = GetPdu();
+         }
       }
+   }
 
-      // Loop through all pending PDUs
-      while (pduPtr != nullptr)
-      {
-         // Run the various PDU filters to see whether the pdu should be processed or rejected.
-         bool passedFilterCheck = RunFilterChecks(pduPtr);
+   // Send any PDUs that are still waiting to be bundled. If multi-threaded this is done by the I/O thread.
+   if (!mMultiThreaded)
+   {
+      FlushDevices();
+   }
 
-         // The pdu should be from the current exercise
-         // We can cache this number, as it will not change as the simulation is running. LBM: WHY BOTHER?
-         if (pduPtr->GetExerciseIdentifier() == Dis::GetExercise() && passedFilterCheck)
-         {
-            // If the PDU to process is of type Stop/Freeze then reset the
-            // mWaitForStartPDU flag; the worker thread continue to process
-            // incoming PDUs until a Start PDU is received
-            if (mMultiThreaded && (pduPtr->GetPduType() == DisEnum::Pdu::Type::StopFreeze))
-            {
-               mIO_ThreadPtr->WaitForStartPDU(true);
-            }
+   // Extrapolate all of the external entities to the current time in one pass. The results are applied
+   // to the platforms when they are next updated (see ExtrapolatePlatformState).
+   mDeadReckonTable.ExtrapolateAll(aSimTime);
+}
 
-            // A non-zero return code from Process() indicates that the PDU has been processed
-            // and is to be deleted.  A zero return code indicates that the PDU should be retained.
-            if (pduPtr->Process() != 0)
-            {
-               delete pduPtr;
-            }
-         }
-         else
-         {
-            delete pduPtr;
-         }
+// ============================================================================
+//! Filter and process a received PDU.
+//! @param aPduPtr            The received PDU. It is deleted if it is rejected or if Process() indicates
+//!                           that it is no longer needed.
+//! @param aCheckInputFilters true if the input filters (see PassesInputFilters) must be applied. This is false
+//!                           if they have already been applied by the I/O thread.
+// private
+void WsfDisInterface::ProcessIncomingPdu(DisPdu* aPduPtr, bool aCheckInputFilters)
+{
+   // Run the various PDU filters to see whether the pdu should be processed or rejected.
+   bool passedFilterCheck = RunFilterChecks(aPduPtr, aCheckInputFilters);
 
-         // Get the next PDU to process
-         if (mMultiThreaded)
-         {
-            pduPtr = mIO_ThreadPtr->GetPdu();
-         }
-         else
-         {
-            pduPtr = GetPdu();
-         }
+   // The pdu should be from the current exercise
+   // We can cache this number, as it will not change as the simulation is running. LBM: WHY BOTHER?
+   if (aPduPtr->GetExerciseIdentifier() == Dis::GetExercise() && passedFilterCheck)
+   {
+      // If the PDU to process is of type Stop/Freeze then reset the
+      // mWaitForStartPDU flag; the worker thread continue to process
+      // incoming PDUs until a Start PDU is received
+      if (mMultiThreaded && (aPduPtr->GetPduType() == DisEnum::Pdu::Type::StopFreeze))
+      {
+         mIO_ThreadPtr->WaitForStartPDU(true);
+      }
+
+      // A non-zero return code from Process() indicates that the PDU has been processed
+      // and is to be deleted.  A zero return code indicates that the PDU should be retained.
+      if (aPduPtr->Process() != 0)
+      {
+         delete aPduPtr;
       }
    }
+   else
+   {
+      delete aPduPtr;
+   }
 }
 
 //! Implement PDU rejection filtering by one of the following methods:
 //! <ul>
 //! <li> Sending DIS Site and Application
+//! <li> PDU type.
 //! <li> Entity Kind and Domain, of the DIS Entity Type record of the DIS Entity State PDU.
 //! <li> Full DIS Entity Type of the DIS Entity State PDU.
+//! <li> Range of the DIS Entity State PDU from a specified platform.
 //! </ul>
-bool WsfDisInterface::RunFilterChecks(const DisPdu* aPduPtr)
+//! @param aPduPtr            The PDU to be checked.
+//! @param aCheckInputFilters If false, the checks performed by PassesInputFilters are skipped because they
+//!                           have already been performed by the I/O thread.
+bool WsfDisInterface::RunFilterChecks(const DisPdu* aPduPtr, bool aCheckInputFilters /* = true */)
 {
    // Filter out by site AND application based on user request.
    bool passedFilterCheck = true;
@@ -1289,90 +1338,58 @@ bool WsfDisInterface::RunFilterChecks(const DisPdu* aPduPtr)
          passedFilterCheck = false;
          mPduFactoryPtr->IncrementFilteredPduCount();
       }
-      else if (!mIgnoredPduTypes.empty() && mIgnoredPduTypes.find(aPduPtr->GetPduType()) != mIgnoredPduTypes.end())
+      else if (aCheckInputFilters && (!PassesInputFilters(aPduPtr)))
       {
          passedFilterCheck = false;
          mPduFactoryPtr->IncrementFilteredPduCount();
       }
 
-      if (((!mIgnoredKindAndDomain.empty()) || (!mIgnoredTypes.empty()) || (!mRangeFilteredPlatforms.empty())) &&
-          passedFilterCheck)
+      if (passedFilterCheck && (!mRangeFilteredPlatforms.empty()) &&
+          (aPduPtr->GetClass() == DisEnum::Pdu::Type::EntityState))
       {
-         // If this is an entity state and we have specified in user input that we
-         // wish to ignore given (kind, domain) pairs, or specific entity types,
-         // check to see if we should filter out the entity state.
-         // We check both these filters here so we don't have to cast the PDU twice.
-         // Note that this filter only relates to entity state pdus,
-         // but filtering these will prevent creation of the dis platforms,
-         // so that other pdus from these entities will largely be ignored.
-         if (aPduPtr->GetClass() == DisEnum::Pdu::Type::EntityState)
+         const DisEntityState* esPtr = static_cast<const DisEntityState*>(aPduPtr);
+         double                targetLocWCS[3];
+         esPtr->GetLocation(targetLocWCS[0], targetLocWCS[1], targetLocWCS[2]);
+         unsigned platformNum = 0;
+         while (platformNum < mRangeFilteredPlatforms.size())
          {
-            const DisEntityState* esPtr = static_cast<const DisEntityState*>(aPduPtr);
-
-            if (!mIgnoredTypes.empty())
+            WsfPlatform* platformPtr = nullptr;
+            if (std::get<1>(mRangeFilteredPlatforms[platformNum]) == 0)
             {
-               if (mIgnoredTypes.find(WsfDisExt::ToExt(esPtr->GetEntityType())) != mIgnoredTypes.end())
+               platformPtr = GetSimulation().GetPlatformByName(std::get<0>(mRangeFilteredPlatforms[platformNum]));
+               if (platformPtr != nullptr)
                {
-                  passedFilterCheck = false;
-                  mPduFactoryPtr->IncrementFilteredPduCount();
+                  std::get<1>(mRangeFilteredPlatforms[platformNum]) = platformPtr->GetIndex();
                }
             }
-            if (passedFilterCheck && (!mIgnoredKindAndDomain.empty()))
+            else
+            {
+               platformPtr = GetSimulation().GetPlatformByIndex(std::get<1>(mRangeFilteredPlatforms[platformNum]));
+            }
+            if (platformPtr != nullptr)
             {
-               DisUint8 kind   = esPtr->GetEntityType().GetEntityKind();
-               DisUint8 domain = esPtr->GetEntityType().GetDomain();
-               if (mIgnoredKindAndDomain.find(std::make_pair(kind, domain)) != mIgnoredKindAndDomain.end())
+               // Get range squared from source to target.
+               double locWCS[3];
+               double targetVec[3];
+               platformPtr->GetLocationWCS(locWCS);
+               UtVec3d::Subtract(targetVec, targetLocWCS, locWCS);
+               double rangeSquared = UtVec3d::MagnitudeSquared(targetVec);
+               passedFilterCheck   = (rangeSquared < std::get<2>(mRangeFilteredPlatforms[platformNum]));
+
+               // only need to pass one check, not all.
+               if (passedFilterCheck)
                {
-                  passedFilterCheck = false;
-                  mPduFactoryPtr->IncrementFilteredPduCount();
+                  break;
                }
+               ++platformNum;
             }
-            if (passedFilterCheck && (!mRangeFilteredPlatforms.empty()))
+            else
             {
-               double targetLocWCS[3];
-               esPtr->GetLocation(targetLocWCS[0], targetLocWCS[1], targetLocWCS[2]);
-               unsigned platformNum = 0;
-               while (platformNum < mRangeFilteredPlatforms.size())
-               {
-                  WsfPlatform* platformPtr = nullptr;
-                  if (std::get<1>(mRangeFilteredPlatforms[platformNum]) == 0)
-                  {
-                     platformPtr = GetSimulation().GetPlatformByName(std::get<0>(mRangeFilteredPlatforms[platformNum]));
-                     if (platformPtr != nullptr)
-                     {
-                        std::get<1>(mRangeFilteredPlatforms[platformNum]) = platformPtr->GetIndex();
-                     }
-                  }
-                  else
-                  {
-                     platformPtr = GetSimulation().GetPlatformByIndex(std::get<1>(mRangeFilteredPlatforms[platformNum]));
-                  }
-                  if (platformPtr != nullptr)
-                  {
-                     // Get range squared from source to target.
-                     double locWCS[3];
-                     double targetVec[3];
-                     platformPtr->GetLocationWCS(locWCS);
-                     UtVec3d::Subtract(targetVec, targetLocWCS, locWCS);
-                     double rangeSquared = UtVec3d::MagnitudeSquared(targetVec);
-                     passedFilterCheck   = (rangeSquared < std::get<2>(mRangeFilteredPlatforms[platformNum]));
-
-                     // only need to pass one check, not all.
-                     if (passedFilterCheck)
-                     {
-                        break;
-                     }
-                     ++platformNum;
-                  }
-                  else
-                  {
-                     auto out = ut::log::warning()
-                                << "Platform specified for range filtering, does not (or, does no longer) exist.";
-                     out.AddNote() << "Platform: " << std::get<0>(mRangeFilteredPlatforms[platformNum]);
+               auto out = ut::log::warning()
+                          << "Platform specified for range filtering, does not (or, does no longer) exist.";
+               out.AddNote() << "Platform: " << std::get<0>(mRangeFilteredPlatforms[platformNum]);
 
-                     mRangeFilteredPlatforms.erase(mRangeFilteredPlatforms.begin() + platformNum);
-                  }
-               }
+               mRangeFilteredPlatforms.erase(mRangeFilteredPlatforms.begin() + platformNum);
             }
          }
       }
@@ -1380,6 +1397,46 @@ bool WsfDisInterface::RunFilterChecks(const DisPdu* aPduPtr)
    return passedFilterCheck;
 }
 
+// ============================================================================
+//! Apply the PDU filters that are defined entirely by input (PDU type, entity type and entity kind/domain).
+//! These filters do not change once the simulation has started and this method does not modify any state,
+//! so it may be called from the DIS I/O thread.
+//! @returns true if the PDU passed the checks or false if it should be discarded.
+bool WsfDisInterface::PassesInputFilters(const DisPdu* aPduPtr) const
+{
+   if (!mIgnoredPduTypes.empty() && mIgnoredPduTypes.find(aPduPtr->GetPduType()) != mIgnoredPduTypes.end())
+   {
+      return false;
+   }
+
+   // If this is an entity state and we have specified in user input that we
+   // wish to ignore given (kind, domain) pairs, or specific entity types,
+   // check to see if we should filter out the entity state.
+   // We check both these filters here so we don't have to cast the PDU twice.
+   // Note that this filter only relates to entity state pdus,
+   // but filtering these will prevent creation of the dis platforms,
+   // so that other pdus from these entities will largely be ignored.
+   if (((!mIgnoredKindAndDomain.empty()) || (!mIgnoredTypes.empty())) &&
+       (aPduPtr->GetClass() == DisEnum::Pdu::Type::EntityState))
+   {
+      const DisEntityState* esPtr = static_cast<const DisEntityState*>(aPduPtr);
+      if ((!mIgnoredTypes.empty()) && (mIgnoredTypes.find(WsfDisExt::ToExt(esPtr->GetEntityType())) != mIgnoredTypes.end()))
+      {
+         return false;
+      }
+      if (!mIgnoredKindAndDomain.empty())
+      {
+         DisUint8 kind   = esPtr->GetEntityType().GetEntityKind();
+         DisUint8 domain = esPtr->GetEntityType().GetDomain();
+         if (mIgnoredKindAndDomain.find(std::make_pair(kind, domain)) != mIgnoredKindAndDomain.end())
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
 // ============================================================================
 void WsfDisInterface::Comment(double aSimTime, WsfPlatform* aPlatformPtr, const std::string& aComment)
 {
@@ -2151,38 +2208,20 @@ void WsfDisInterface::ExtrapolatePlatformState(double aSimTime, WsfDisPlatform*
    // Assume the entity is not moving (static, frozen or inactive).
    // Get just the position and orientation. Assume the velocity and acceleration are zero.
 
+   // The dead reckoning table treats static, frozen or inactive entities as having zero velocity and acceleration.
+   // The state will usually have been extrapolated to the current time by the batch update in AdvanceTime.
    double locationWCS[3];
-   double velocityWCS[3]     = {0.0, 0.0, 0.0};
-   double accelerationWCS[3] = {0.0, 0.0, 0.0};
+   double velocityWCS[3];
+   double accelerationWCS[3];
    float  psi, theta, phi;
-   entityStatePtr->GetLocation(locationWCS[0], locationWCS[1], locationWCS[2]);
+   mDeadReckonTable.GetState(aSimTime,
+                             platformPtr->GetIndex(),
+                             entityStateUpdateTime,
+                             *entityStatePtr,
+                             locationWCS,
+                             velocityWCS,
+                             accelerationWCS);
    entityStatePtr->GetOrientation(psi, theta, phi);
-
-   DisUint32 frozenOrInactive = (1 << 21) | (1 << 23);
-   DisEnum8  algorithm        = entityStatePtr->GetDeadreckoningAlgorithm();
-   if ((algorithm != 1) &&                                          // Not static ...
-       ((entityStatePtr->GetAppearance() & frozenOrInactive) == 0)) // ... and not (frozen or inactive)
-   {
-      float vx, vy, vz;
-      float ax = 0.0F, ay = 0.0F, az = 0.0F;
-      entityStatePtr->GetVelocity(vx, vy, vz);
-      if ((algorithm == 4) || // DRM(RVW)
-          (algorithm == 5))   // DRM(FVW)
-      {
-         entityStatePtr->GetAcceleration(ax, ay, az);
-      }
-      double dt      = aSimTime - entityStateUpdateTime;
-      double halfDt2 = 0.5 * dt * dt;
-      locationWCS[0] += (vx * dt) + (ax * halfDt2);
-      locationWCS[1] += (vy * dt) + (ay * halfDt2);
-      locationWCS[2] += (vz * dt) + (az * halfDt2);
-      velocityWCS[0]     = vx + (ax * dt);
-      velocityWCS[1]     = vy + (ay * dt);
-      velocityWCS[2]     = vz + (az * dt);
-      accelerationWCS[0] = ax;
-      accelerationWCS[1] = ay;
-      accelerationWCS[2] = az;
-   }
    platformPtr->SetLocationWCS(locationWCS);
 
 
@@ -37,6 +37,7 @@ class UtCalendar;
 #include "UtRandom.hpp"
 
 class WsfDisArticulatedPartList;
+#include "WsfDisDeadReckonTable.hpp"
 #include "WsfDisDevice.hpp"
 class WsfDisEntityState;
 #include "WsfDisExchange.hpp"
@@ -174,6 +175,8 @@ public:
 
    DisPdu* GetPdu();
 
+   bool PassesInputFilters(const DisPdu* aPduPtr) const;
+
    //! Get the local random number generator.
    ut::Random& GetRandom();
 
@@ -181,6 +184,8 @@ public:
 
    void ImmediatePutPdu(double aSimTime, DisPdu& aPduPtr);
 
+   void FlushDevices();
+
    static void ReadEntityId(UtInput& aInput, DisEntityId& aEntityId);
 
    static void ReadEntityType(UtInput& aInput, DisEntityType& aEntityType);
@@ -313,6 +318,9 @@ public:
    //@{
    void ExtrapolatePlatformState(double aSimTime, WsfDisPlatform* aDisPlatformPtr);
 
+   //! Indicate a new entity state has been received for the platform with the specified index.
+   void EntityStateChanged(size_t aPlatformIndex) { mDeadReckonTable.Invalidate(aPlatformIndex); }
+
    void PrepareFinalEntityState(double aSimTime, WsfPlatform* aPlatformPtr, DisEntityState* aEntityStatePtr);
 
    bool UpdateAppearanceFromPlatform(double aSimTime, WsfPlatform* aPlatformPtr, DisEntityState* aEntityStatePtr);
@@ -405,7 +413,9 @@ private:
 
    bool GetEntityType(const WsfObject* aObjectPtr, DisEntityType& aEntityType) const;
 
-   bool RunFilterChecks(const DisPdu* aPdu);
+   bool RunFilterChecks(const DisPdu* aPdu, bool aCheckInputFilters = true);
+
+   void ProcessIncomingPdu(DisPdu* aPduPtr, bool aCheckInputFilters);
 
    DisUint32 ConvertDamageFactorToDamageState(double aDamageFactor);
    double    ConvertDamageStateToDamageFactor(DisUint32 aDamageState);
@@ -436,6 +446,12 @@ private:
 
    WsfDisIO_Thread* mIO_ThreadPtr;
 
+   //! PDUs drained from the I/O thread in AdvanceTime. Retained to avoid reallocating each frame.
+   std::vector<DisPdu*> mIncomingPduBatch;
+
+   //! Kinematic state of the external entities, used by ExtrapolatePlatformState.
+   WsfDisDeadReckonTable mDeadReckonTable;
+
    DeviceList   mDevices;
    bool         mHasInputDevice;
    bool         mHasOutputDevice;
@@ -0,0 +1,89 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "dis/WsfDisPduRing.hpp"
+
+#include "DisPdu.hpp"
+
+// ============================================================================
+//! Constructor.
+//! @param aCapacity The requested capacity. It is rounded up to the next power of two.
+WsfDisPduRing::WsfDisPduRing(size_t aCapacity)
+   : mSlots()
+   , mMask(0)
+   , mHead(0)
+   , mTail(0)
+{
+   size_t capacity = 2;
+   while (capacity < aCapacity)
+   {
+      capacity <<= 1;
+   }
+   mSlots.resize(capacity, nullptr);
+   mMask = capacity - 1;
+}
+
+// ============================================================================
+WsfDisPduRing::~WsfDisPduRing()
+{
+   DisPdu* pduPtr = Pop();
+   while (pduPtr != nullptr)
+   {
+      delete pduPtr;
+      pduPtr = Pop();
+   }
+}
+
+// ============================================================================
+//! Add a PDU to the end of the queue.
+//! @returns true if the PDU was queued (and the queue has assumed ownership) or false if the queue was full.
+bool WsfDisPduRing::Push(DisPdu* aPduPtr)
+{
+   size_t tail = mTail.load(std::memory_order_relaxed);
+   if ((tail - mHead.load(std::memory_order_acquire)) >= mSlots.size())
+   {
+      return false;
+   }
+   mSlots[tail & mMask] = aPduPtr;
+   mTail.store(tail + 1, std::memory_order_release);
+   return true;
+}
+
+// ============================================================================
+//! Remove the PDU at the front of the queue.
+//! @returns The PDU (ownership passes to the caller) or nullptr if the queue is empty.
+DisPdu* WsfDisPduRing::Pop()
+{
+   size_t head = mHead.load(std::memory_order_relaxed);
+   if (head == mTail.load(std::memory_order_acquire))
+   {
+      return nullptr;
+   }
+   DisPdu* pduPtr = mSlots[head & mMask];
+   mHead.store(head + 1, std::memory_order_release);
+   return pduPtr;
+}
+
+// ============================================================================
+//! Remove all of the PDUs that are currently in the queue.
+//! @param aPdus [output] The PDUs are appended to this list in the order they were queued.
+//! Ownership of the PDUs passes to the caller.
+//! @returns The number of PDUs that were removed.
+size_t WsfDisPduRing::PopAll(std::vector<DisPdu*>& aPdus)
+{
+   size_t head  = mHead.load(std::memory_order_relaxed);
+   size_t tail  = mTail.load(std::memory_order_acquire);
+   size_t count = tail - head;
+   for (size_t i = head; i != tail; ++i)
+   {
+      aPdus.push_back(mSlots[i & mMask]);
+   }
+   mHead.store(tail, std::memory_order_release);
+   return count;
+}
@@ -0,0 +1,65 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFDISPDURING_HPP
+#define WSFDISPDURING_HPP
+
+#include "wsf_export.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+class DisPdu;
+
+//! A bounded, lock-free, single-producer/single-consumer queue of PDUs.
+//!
+//! This is used to pass received PDUs from the DIS I/O thread (the only producer) to the
+//! simulation thread (the only consumer) without taking a lock per PDU. The queue assumes
+//! ownership of any PDU that is successfully pushed until it is popped; PDUs that remain in
+//! the queue when it is destroyed are deleted.
+class WSF_EXPORT WsfDisPduRing
+{
+public:
+   explicit WsfDisPduRing(size_t aCapacity);
+   ~WsfDisPduRing();
+   WsfDisPduRing(const WsfDisPduRing&) = delete;
+   WsfDisPduRing& operator=(const WsfDisPduRing&) = delete;
+
+   //! @name Producer methods.
+   //! These may only be called from the producing thread.
+   //@{
+   bool Push(DisPdu* aPduPtr);
+   //@}
+
+   //! @name Consumer methods.
+   //! These may only be called from the consuming thread.
+   //@{
+   DisPdu* Pop();
+   size_t  PopAll(std::vector<DisPdu*>& aPdus);
+   //@}
+
+   //! Returns true if the queue is empty. This may be called from either thread, but the
+   //! answer is only a snapshot if the other thread is active.
+   bool Empty() const { return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire); }
+
+   //! Returns the maximum number of PDUs that may be queued.
+   size_t Capacity() const { return mSlots.size(); }
+
+private:
+   std::vector<DisPdu*> mSlots;
+   size_t               mMask;
+
+   //! The index of the next slot to be read. Written only by the consumer.
+   std::atomic<size_t> mHead;
+   //! The index of the next slot to be written. Written only by the producer.
+   std::atomic<size_t> mTail;
+};
+
+#endif
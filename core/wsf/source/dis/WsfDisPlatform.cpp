@@ -326,6 +326,10 @@ void WsfDisPlatform::SetEntityState(double aSimTime, DisEntityState* aEntityStat
       mEntityStatePtr.reset(aEntityStatePtr);
       mEntityStateUpdateTime = aSimTime;
    }
+   if (mPlatformPtr != nullptr)
+   {
+      mInterfacePtr->EntityStateChanged(mPlatformPtr->GetIndex());
+   }
 
    // If the entity has been deactivated then delete it from the simulation. (IEEE 1278.1-1995, para 4.5.2.1.4)
    if (((aEntityStatePtr->GetAppearance() >> 23) & 1) != 0)
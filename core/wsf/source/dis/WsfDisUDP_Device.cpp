@@ -40,6 +40,8 @@ WsfDisUDP_Device::WsfDisUDP_Device(WsfDisInterface*   aInterfacePtr,
                                    bool               aRememberSenderHostname)
    : WsfDisDevice(aInterfacePtr)
    , mGenIOPtr(nullptr)
+   , mMaximumBundleSize(0)
+   , mBundleSize(0)
 {
 #ifdef WSF_USE_UMP
    mGenIOPtr = new GenUmpIO();
@@ -83,6 +85,8 @@ WsfDisUDP_Device::WsfDisUDP_Device(WsfDisInterface*   aInterfacePtr,
                                    bool               aRememberSenderHostname)
    : WsfDisDevice(aInterfacePtr)
    , mGenIOPtr(nullptr)
+   , mMaximumBundleSize(0)
+   , mBundleSize(0)
 {
 #ifdef WSF_USE_UMP
    std::string address(aMulticastAddress);
@@ -119,6 +123,10 @@ WsfDisUDP_Device::WsfDisUDP_Device(WsfDisInterface*   aInterfacePtr,
 // virtual
 WsfDisUDP_Device::~WsfDisUDP_Device()
 {
+   if (mGenIOPtr != nullptr)
+   {
+      Flush();
+   }
    delete mGenIOPtr;
 }
 
@@ -169,6 +177,36 @@ void WsfDisUDP_Device::PutPduP(double aSimTime, DisPdu& aPdu)
    {
       aPdu.SetTime(aSimTime);
    }
+
+   if (mMaximumBundleSize == 0)
+   {
+      aPdu.Put(*mGenIOPtr);
+      mGenIOPtr->Send();
+      return;
+   }
+
+   // Bundle the PDU with those already buffered (as permitted by the DIS standard) unless doing so would exceed the
+   // bundle size. A PDU larger than the bundle size is simply sent on its own.
+   unsigned int pduLength = aPdu.GetLength();
+   if ((mBundleSize > 0) && ((mBundleSize + pduLength) > mMaximumBundleSize))
+   {
+      Flush();
+   }
    aPdu.Put(*mGenIOPtr);
-   mGenIOPtr->Send();
+   mBundleSize += pduLength;
+   if (mBundleSize >= mMaximumBundleSize)
+   {
+      Flush();
+   }
+}
+
+// virtual
+void WsfDisUDP_Device::Flush()
+{
+   // Send the current bundle of PDUs (if any).
+   if (mBundleSize > 0)
+   {
+      mGenIOPtr->Send();
+      mBundleSize = 0;
+   }
 }
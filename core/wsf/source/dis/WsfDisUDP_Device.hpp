@@ -55,6 +55,12 @@ public:
 
    void PutPduP(double aSimTime, DisPdu& aPdu) override;
 
+   void Flush() override;
+
+   //! Set the maximum number of bytes of PDUs that may be bundled into a single datagram.
+   //! A value of zero (the default) disables bundling so each PDU is sent in its own datagram.
+   void SetMaximumBundleSize(unsigned int aMaximumBundleSize) { mMaximumBundleSize = aMaximumBundleSize; }
+
 #ifdef WSF_USE_UMP
    GenUmpIO* UmpIOPtr() { return mGenIOPtr; }
 #else
@@ -67,6 +73,11 @@ private:
 #else
    GenUDP_IO* mGenIOPtr;
 #endif
+
+   //! The maximum size of a bundle (bytes), or zero if bundling is disabled.
+   unsigned int mMaximumBundleSize;
+   //! The number of bytes of PDUs in the current (unsent) bundle.
+   unsigned int mBundleSize;
 };
 
 #endif
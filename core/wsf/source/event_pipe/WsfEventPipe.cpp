@@ -187,6 +187,11 @@ bool WsfEventPipeExtension::ProcessInput(UtInput& aInput)
             aInput.ReadValueOfType(mData.mMaximumMoverUpdateInterval, UtInput::cTIME);
             aInput.ValueGreaterOrEqual(mData.mMaximumMoverUpdateInterval, 0.0);
          }
+         else if (cmd == "keyframe_interval")
+         {
+            aInput.ReadValueOfType(mData.mKeyframeInterval, UtInput::cTIME);
+            aInput.ValueGreaterOrEqual(mData.mKeyframeInterval, 0.0);
+         }
          else if (mData.mDetailSettings["default"].ProcessInput(aInput, this->GetEventNames()))
          {
          }
@@ -11,9 +11,17 @@
 
 #include "WsfEventPipeFileWriteWorker.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 wsf::eventpipe::FileWriterWorker::FileWriterWorker()
    : UtThread()
+   , mStreamPtr(nullptr)
+   , mFileStreamPtr(nullptr)
    , mClock()
+   , mKeyframeInterval(0.0)
+   , mNextKeyframeTime(0.0)
+   , mLastSimTime(0.0)
 {
    mClock.ResetClock();
 }
@@ -106,7 +114,7 @@ void wsf::eventpipe::FileWriterWorker::Run()
             mBackMessagesPopped.notify_all();
          }
          // write a message
-         mStreamPtr->Write(*msgPtr);
+         Write(*msgPtr);
          ++messagesWritten;
       }
    }
@@ -116,8 +124,9 @@ void wsf::eventpipe::FileWriterWorker::Run()
    {
       auto msgPtr = std::move(mFrontMessageQueue.front());
       mFrontMessageQueue.pop();
-      mStreamPtr->Write(*msgPtr);
+      Write(*msgPtr);
    }
+   WriteKeyframeIndex();
 }
 
 void wsf::eventpipe::FileWriterWorker::StartRunning()
@@ -135,3 +144,70 @@ void wsf::eventpipe::FileWriterWorker::StopRunning()
    // awaken the running thread to let it know that it has stopped.
    mBackMessagesAdded.notify_one();
 }
+
+// write a message, preceded by a keyframe if the message is at or after the time of the next keyframe
+// the keyframe holds the state of the messages written before it
+void wsf::eventpipe::FileWriterWorker::Write(const UtPackMessage& aMessage)
+{
+   if (mKeyframeInterval > 0.0)
+   {
+      auto msgPtr = dynamic_cast<const WsfEventPipe::MsgBase*>(&aMessage);
+      if (msgPtr != nullptr)
+      {
+         mLastSimTime = std::max(mLastSimTime, msgPtr->simTime());
+         if (msgPtr->simTime() >= mNextKeyframeTime)
+         {
+            if (mNextKeyframeTime > 0.0)
+            {
+               WriteKeyframe(msgPtr->simTime());
+            }
+            mNextKeyframeTime = (std::floor(msgPtr->simTime() / mKeyframeInterval) + 1.0) * mKeyframeInterval;
+         }
+      }
+      mState.Apply(aMessage);
+   }
+   mStreamPtr->Write(aMessage);
+}
+
+void wsf::eventpipe::FileWriterWorker::WriteKeyframe(double aSimTime)
+{
+   WsfEventPipe::MsgKeyframe keyframe;
+   keyframe.simTime(aSimTime);
+   keyframe.simIndex(0);
+   keyframe.keyframeNumber(static_cast<unsigned int>(mKeyframes.size()));
+   mState.Save(keyframe);
+
+   // flush any message data held by the message stream so the file position is the offset of the keyframe
+   mStreamPtr->Flush();
+   WsfEventPipe::KeyframeIndexEntry entry;
+   entry.simTime(aSimTime);
+   entry.offset(static_cast<long long>(mFileStreamPtr->tellp()));
+   mKeyframes.push_back(entry);
+
+   mStreamPtr->Write(keyframe);
+}
+
+// write the index of the keyframes followed by its location, which is the last message in the file
+// readers that do not know these messages skip them like any other unknown message
+void wsf::eventpipe::FileWriterWorker::WriteKeyframeIndex()
+{
+   if (mKeyframes.empty() || (mFileStreamPtr == nullptr))
+   {
+      return;
+   }
+
+   WsfEventPipe::MsgKeyframeIndex index;
+   index.simTime(mLastSimTime);
+   index.simIndex(0);
+   index.keyframes() = mKeyframes;
+
+   mStreamPtr->Flush();
+   WsfEventPipe::MsgKeyframeIndexLocation location;
+   location.simTime(mLastSimTime);
+   location.simIndex(0);
+   location.indexOffset(static_cast<long long>(mFileStreamPtr->tellp()));
+
+   mStreamPtr->Write(index);
+   mStreamPtr->Write(location);
+   mStreamPtr->Flush();
+}
@@ -14,17 +14,21 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <ostream>
 #include <queue>
 
 #include "UtPack.hpp"
 #include "UtThread.hpp"
 #include "UtWallClock.hpp"
+#include "WsfEventPipeClasses.hpp"
+#include "WsfEventPipeRecordingState.hpp"
 
 namespace wsf
 {
 namespace eventpipe
 {
 // this class manages a double-buffer for the writing of event-pipe messages to file
+// if a keyframe interval is set, it also writes keyframes and, when it stops, the index of the keyframes
 class FileWriterWorker : public UtThread
 {
 public:
@@ -35,9 +39,16 @@ public:
    void StartRunning();
    void StopRunning();
 
+   void SetKeyframeInterval(double aInterval) { mKeyframeInterval = aInterval; }
+
    UtPackMessageStdStreamO* mStreamPtr;
+   std::ostream*            mFileStreamPtr; // the file written by mStreamPtr, used to find the offsets of keyframes
 
 private:
+   void Write(const UtPackMessage& aMessage);
+   void WriteKeyframe(double aSimTime);
+   void WriteKeyframeIndex();
+
    bool        mRunning;
    UtWallClock mClock;
    std::mutex  mFrontAccessMutex; // this is to prevent collisions of multiple sim-threads
@@ -46,6 +57,15 @@ private:
    std::queue<std::unique_ptr<UtPackMessage>> mBackMessageQueue;
    std::condition_variable                    mBackMessagesAdded;
    std::condition_variable                    mBackMessagesPopped;
+
+   //! @name Keyframe data, used only by the write thread.
+   //@{
+   double                               mKeyframeInterval;
+   double                               mNextKeyframeTime;
+   double                               mLastSimTime;
+   RecordingState                       mState;
+   WsfEventPipe::KeyframeIndexEntryList mKeyframes;
+   //@}
 };
 } // namespace eventpipe
 } // namespace wsf
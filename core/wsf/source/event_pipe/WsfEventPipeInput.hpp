@@ -37,6 +37,7 @@ public:
    ut::optional<double> mAngleThreshold{0.052};         // ~ 3 degrees
    double               mEntityStateMaximumInterval{10.0};
    double               mMaximumMoverUpdateInterval{5.0};
+   double               mKeyframeInterval{0.0}; // 0 disables keyframes
 };
 
 #endif
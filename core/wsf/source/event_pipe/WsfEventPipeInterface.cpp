@@ -466,8 +466,10 @@ void WsfEventPipeInterface::AddedToSimulation()
    SendExecData();
    SendScenarioData();
 
-   mWriteThreadPtr             = new wsf::eventpipe::FileWriterWorker;
-   mWriteThreadPtr->mStreamPtr = mStreamPtr;
+   mWriteThreadPtr                 = new wsf::eventpipe::FileWriterWorker;
+   mWriteThreadPtr->mStreamPtr     = mStreamPtr;
+   mWriteThreadPtr->mFileStreamPtr = mFileStreamPtr.get();
+   mWriteThreadPtr->SetKeyframeInterval(mInput.mKeyframeInterval);
    mWriteThreadPtr->StartRunning();
    mWriteThreadPtr->Start();
 
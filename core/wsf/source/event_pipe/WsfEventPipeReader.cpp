@@ -0,0 +1,308 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEventPipeReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "UtLog.hpp"
+#include "UtMemory.hpp"
+#include "UtTextDocument.hpp"
+#include "Utml.hpp"
+#include "WsfEventPipeClassesRegister.hpp"
+
+// =================================================================================================
+wsf::eventpipe::Reader::Reader()
+   : mDataOffset(0)
+   , mFileSize(0)
+{
+}
+
+// =================================================================================================
+//! Open a recording, read its schema and read its keyframe index (if it has one).
+//! @returns false if the file could not be opened or is not an event pipe recording.
+bool wsf::eventpipe::Reader::Open(const std::string& aFileName)
+{
+   mFileName = aFileName;
+   mStreamPtr.reset();
+   mKeyframes.clear();
+   mFileStream.close();
+   mFileStream.clear();
+   mFileStream.open(aFileName, std::ios::in | std::ios::binary);
+   if ((!mFileStream.is_open()) || (!ReadHeader()))
+   {
+      auto out = ut::log::error() << "Unable to read event_pipe file.";
+      out.AddNote() << "File: " << aFileName;
+      mSerializerPtr.reset();
+      return false;
+   }
+   mFileStream.seekg(0, std::ios::end);
+   mFileSize = mFileStream.tellg();
+   ReadKeyframeIndex();
+   return true;
+}
+
+// =================================================================================================
+//! Find the state of the recording at a time, starting from the last keyframe at or before the time.
+//! @param aSimTime The simulation time.
+//! @param aState   [output] The state after all of the messages at or before aSimTime.
+//! @returns false if no recording is open.
+bool wsf::eventpipe::Reader::Seek(double aSimTime, RecordingState& aState)
+{
+   if (mSerializerPtr == nullptr)
+   {
+      return false;
+   }
+   auto iter = std::upper_bound(mKeyframes.begin(),
+                                mKeyframes.end(),
+                                aSimTime,
+                                [](double aTime, const WsfEventPipe::KeyframeIndexEntry& aEntry)
+                                { return aTime < aEntry.simTime(); });
+   if (iter == mKeyframes.begin())
+   {
+      return ReadSequential(aSimTime, aState);
+   }
+   --iter;
+
+   SetPosition(iter->offset());
+   std::unique_ptr<UtPackMessage> msgPtr      = Read();
+   auto                           keyframePtr = dynamic_cast<const WsfEventPipe::MsgKeyframe*>(msgPtr.get());
+   if (keyframePtr == nullptr)
+   {
+      auto out = ut::log::warning() << "Keyframe index of event_pipe file is not valid. Reading from the start.";
+      out.AddNote() << "File: " << mFileName;
+      mKeyframes.clear();
+      return ReadSequential(aSimTime, aState);
+   }
+   aState.Load(*keyframePtr);
+   ReadUntil(aSimTime, aState);
+   return true;
+}
+
+// =================================================================================================
+//! Find the state of the recording at a time by decoding every message from the start of the recording.
+//! @param aSimTime The simulation time.
+//! @param aState   [output] The state after all of the messages at or before aSimTime.
+//! @returns false if no recording is open.
+bool wsf::eventpipe::Reader::ReadSequential(double aSimTime, RecordingState& aState)
+{
+   if (mSerializerPtr == nullptr)
+   {
+      return false;
+   }
+   aState.Clear();
+   SetPosition(mDataOffset);
+   ReadUntil(aSimTime, aState);
+   return true;
+}
+
+// =================================================================================================
+//! Check the keyframes of the recording.
+//! The recording is decoded once from the start. The state loaded from each keyframe must match the state built from
+//! the messages before it, and each entry of the keyframe index must locate the keyframe with the same number.
+//! @returns true if all of the keyframes are valid.
+bool wsf::eventpipe::Reader::VerifyKeyframes()
+{
+   if (mSerializerPtr == nullptr)
+   {
+      return false;
+   }
+
+   bool           valid = true;
+   size_t         count = 0;
+   RecordingState sequentialState;
+   RecordingState keyframeState;
+   SetPosition(mDataOffset);
+   for (std::unique_ptr<UtPackMessage> msgPtr = Read(); msgPtr != nullptr; msgPtr = Read())
+   {
+      auto keyframePtr = dynamic_cast<const WsfEventPipe::MsgKeyframe*>(msgPtr.get());
+      if (keyframePtr != nullptr)
+      {
+         keyframeState.Load(*keyframePtr);
+         if (Encode(keyframeState) != Encode(sequentialState))
+         {
+            auto out = ut::log::error() << "Keyframe does not match the sequentially decoded state.";
+            out.AddNote() << "File: " << mFileName;
+            out.AddNote() << "Keyframe: " << keyframePtr->keyframeNumber();
+            out.AddNote() << "T = " << keyframePtr->simTime();
+            valid = false;
+         }
+         ++count;
+      }
+      else
+      {
+         sequentialState.Apply(*msgPtr);
+      }
+   }
+
+   if ((!mKeyframes.empty()) && (mKeyframes.size() != count))
+   {
+      auto out = ut::log::error() << "Keyframe index does not list every keyframe.";
+      out.AddNote() << "File: " << mFileName;
+      out.AddNote() << "Keyframes: " << count;
+      out.AddNote() << "Index entries: " << mKeyframes.size();
+      valid = false;
+   }
+   for (size_t i = 0; i < mKeyframes.size(); ++i)
+   {
+      SetPosition(mKeyframes[i].offset());
+      std::unique_ptr<UtPackMessage> msgPtr      = Read();
+      auto                           keyframePtr = dynamic_cast<const WsfEventPipe::MsgKeyframe*>(msgPtr.get());
+      if ((keyframePtr == nullptr) || (keyframePtr->keyframeNumber() != i) ||
+          (keyframePtr->simTime() != mKeyframes[i].simTime()))
+      {
+         auto out = ut::log::error() << "Keyframe index entry does not locate its keyframe.";
+         out.AddNote() << "File: " << mFileName;
+         out.AddNote() << "Index entry: " << i;
+         valid = false;
+      }
+   }
+   return valid;
+}
+
+// =================================================================================================
+//! Read the file header: the file type identifier and the schema, followed by a null terminator.
+//! The serializer is created from the schema in the file rather than the schema of the application.
+// private
+bool wsf::eventpipe::Reader::ReadHeader()
+{
+   char identifier[11];
+   mFileStream.read(identifier, sizeof(identifier));
+   if ((!mFileStream) || (std::memcmp(identifier, "\0\0WSF_PIPE\n", sizeof(identifier)) != 0))
+   {
+      return false;
+   }
+   std::string text;
+   if (!std::getline(mFileStream, text, '\0'))
+   {
+      return false;
+   }
+   mDataOffset = mFileStream.tellg();
+
+   UtTextDocument schemaText;
+   schemaText.Insert(schemaText.Size() - 1, text);
+   UtmlObject schemaDoc = UtmlObject::makeContainer("schema");
+   UtmlParser parser(schemaText);
+   parser.Parse(schemaDoc);
+
+   mSchemaPtr = ut::make_unique<UtPackSchema>();
+   mSchemaPtr->Read(schemaDoc);
+   mSchemaPtr->Resolve();
+
+   mSerializerPtr = ut::make_unique<UtPackSerializer>();
+   mSerializerPtr->RegisterBuiltinTypes();
+   WsfEventPipe::UtPack_register_all_wsf_types(*mSerializerPtr);
+   mSerializerPtr->Initialize(*mSchemaPtr);
+   return true;
+}
+
+// =================================================================================================
+//! Read the keyframe index using the MsgKeyframeIndexLocation at the end of the file.
+//! The index is left empty if the recording does not have one (it was written without keyframes or was not
+//! completed).
+// private
+void wsf::eventpipe::Reader::ReadKeyframeIndex()
+{
+   // The location message has a fixed size, which is found by encoding one.
+   std::streamoff locationSize = static_cast<std::streamoff>(Encode(WsfEventPipe::MsgKeyframeIndexLocation()).size());
+   if ((mFileSize - mDataOffset) < locationSize)
+   {
+      return;
+   }
+   SetPosition(mFileSize - locationSize);
+   std::unique_ptr<UtPackMessage> msgPtr      = Read();
+   auto                           locationPtr =
+      dynamic_cast<const WsfEventPipe::MsgKeyframeIndexLocation*>(msgPtr.get());
+   if ((locationPtr == nullptr) || (locationPtr->indexOffset() < mDataOffset) ||
+       (locationPtr->indexOffset() >= (mFileSize - locationSize)))
+   {
+      return;
+   }
+
+   SetPosition(locationPtr->indexOffset());
+   msgPtr        = Read();
+   auto indexPtr = dynamic_cast<const WsfEventPipe::MsgKeyframeIndex*>(msgPtr.get());
+   if ((indexPtr != nullptr) &&
+       std::is_sorted(indexPtr->keyframes().begin(),
+                      indexPtr->keyframes().end(),
+                      [](const WsfEventPipe::KeyframeIndexEntry& aLhs, const WsfEventPipe::KeyframeIndexEntry& aRhs)
+                      { return aLhs.simTime() < aRhs.simTime(); }))
+   {
+      mKeyframes = indexPtr->keyframes();
+   }
+}
+
+// =================================================================================================
+//! Position the reader at a file offset, which must be the offset of a message.
+// private
+void wsf::eventpipe::Reader::SetPosition(std::streamoff aOffset)
+{
+   mFileStream.clear();
+   mFileStream.seekg(aOffset);
+   // A new message stream is used so no data read before the new position is retained.
+   mStreamPtr = ut::make_unique<UtPackMessageStdStreamI>(&mFileStream, mSerializerPtr.get());
+}
+
+// =================================================================================================
+//! Read the next message.
+//! @returns The message, or nullptr at the end of the file.
+// private
+std::unique_ptr<UtPackMessage> wsf::eventpipe::Reader::Read()
+{
+   if (!mFileStream.good())
+   {
+      return nullptr;
+   }
+   std::unique_ptr<UtPackMessage> msgPtr(mStreamPtr->Read());
+   return msgPtr;
+}
+
+// =================================================================================================
+//! Apply messages to the state until the end of the file or the first message after a time.
+// private
+void wsf::eventpipe::Reader::ReadUntil(double aSimTime, RecordingState& aState)
+{
+   for (std::unique_ptr<UtPackMessage> msgPtr = Read(); msgPtr != nullptr; msgPtr = Read())
+   {
+      auto basePtr = dynamic_cast<const WsfEventPipe::MsgBase*>(msgPtr.get());
+      if ((basePtr != nullptr) && (basePtr->simTime() > aSimTime))
+      {
+         break;
+      }
+      aState.Apply(*msgPtr);
+   }
+}
+
+// =================================================================================================
+//! Return the bytes of a message as they would be written to a recording.
+// private
+std::string wsf::eventpipe::Reader::Encode(const UtPackMessage& aMessage) const
+{
+   std::ostringstream      stream;
+   UtPackMessageStdStreamO messageStream(&stream, mSerializerPtr.get());
+   messageStream.Write(aMessage);
+   messageStream.Flush();
+   return stream.str();
+}
+
+// =================================================================================================
+//! Return the bytes of the keyframe that would be written for a state.
+//! Equal states have equal encodings.
+// private
+std::string wsf::eventpipe::Reader::Encode(const RecordingState& aState) const
+{
+   WsfEventPipe::MsgKeyframe keyframe;
+   keyframe.simTime(0.0);
+   keyframe.simIndex(0);
+   keyframe.keyframeNumber(0);
+   aState.Save(keyframe);
+   return Encode(keyframe);
+}
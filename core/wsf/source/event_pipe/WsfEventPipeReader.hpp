@@ -0,0 +1,73 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEVENTPIPEREADER_HPP
+#define WSFEVENTPIPEREADER_HPP
+
+#include "wsf_export.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "UtPack.hpp"
+#include "WsfEventPipeClasses.hpp"
+#include "WsfEventPipeRecordingState.hpp"
+
+namespace wsf
+{
+namespace eventpipe
+{
+//! Reads an event pipe recording and finds the state of the recording at a time.
+//!
+//! If the recording was written with a 'keyframe_interval', the reader uses the keyframe index at the end of the file
+//! to find the last keyframe at or before the requested time, loads the state from it and decodes only the messages
+//! that follow it. Otherwise (or if the recording is incomplete) the reader decodes the recording from the start.
+//!
+//! VerifyKeyframes checks that the state loaded from each keyframe is the state built by decoding every message
+//! before it, and that the index locates each keyframe.
+class WSF_EXPORT Reader
+{
+public:
+   Reader();
+
+   bool Open(const std::string& aFileName);
+
+   //! Returns the keyframes listed in the index, which is empty if the recording has no keyframe index.
+   const WsfEventPipe::KeyframeIndexEntryList& GetKeyframes() const { return mKeyframes; }
+
+   bool Seek(double aSimTime, RecordingState& aState);
+   bool ReadSequential(double aSimTime, RecordingState& aState);
+
+   bool VerifyKeyframes();
+
+private:
+   bool ReadHeader();
+   void ReadKeyframeIndex();
+
+   void                           SetPosition(std::streamoff aOffset);
+   std::unique_ptr<UtPackMessage> Read();
+   void                           ReadUntil(double aSimTime, RecordingState& aState);
+
+   std::string Encode(const UtPackMessage& aMessage) const;
+   std::string Encode(const RecordingState& aState) const;
+
+   std::string                              mFileName;
+   std::ifstream                            mFileStream;
+   std::streamoff                           mDataOffset;
+   std::streamoff                           mFileSize;
+   std::unique_ptr<UtPackSchema>            mSchemaPtr;
+   std::unique_ptr<UtPackSerializer>        mSerializerPtr;
+   std::unique_ptr<UtPackMessageStdStreamI> mStreamPtr;
+   WsfEventPipe::KeyframeIndexEntryList     mKeyframes;
+};
+} // namespace eventpipe
+} // namespace wsf
+
+#endif
@@ -0,0 +1,169 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEventPipeRecordingState.hpp"
+
+#include <limits>
+
+// =================================================================================================
+void wsf::eventpipe::RecordingState::Clear()
+{
+   mEntityStates.clear();
+   mPartStates.clear();
+   mLocalTracks.clear();
+   mSensorTracks.clear();
+}
+
+// =================================================================================================
+//! Update the state with a message of the recording.
+//! @returns true if the message affects the state.
+bool wsf::eventpipe::RecordingState::Apply(const UtPackMessage& aMessage)
+{
+   if (auto entityStatePtr = dynamic_cast<const WsfEventPipe::MsgEntityState*>(&aMessage))
+   {
+      const WsfEventPipe::EntityState& state = entityStatePtr->state();
+      mEntityStates[state.platformIndex()]   = state;
+   }
+   else if (auto partPtr = dynamic_cast<const WsfEventPipe::MsgPartStatus*>(&aMessage))
+   {
+      WsfEventPipe::PartState& part =
+         mPartStates[PartKey(partPtr->platformIndex(), partPtr->partName(), static_cast<int>(partPtr->partType()))];
+      part.platformIndex(partPtr->platformIndex());
+      part.partName(partPtr->partName());
+      part.partType(partPtr->partType());
+      part.on(partPtr->on());
+      part.broken(partPtr->broken());
+      part.disabled(partPtr->disabled());
+   }
+   else if (auto localUpdatePtr = dynamic_cast<const WsfEventPipe::MsgLocalTrackUpdate*>(&aMessage))
+   {
+      UpdateTrack(mLocalTracks,
+                  localUpdatePtr->ownerIndex(),
+                  localUpdatePtr->track(),
+                  localUpdatePtr->masterProcessor());
+   }
+   else if (auto localDropPtr = dynamic_cast<const WsfEventPipe::MsgLocalTrackDrop*>(&aMessage))
+   {
+      mLocalTracks.erase(MakeTrackKey(localDropPtr->ownerIndex(), localDropPtr->trackId()));
+   }
+   else if (auto sensorUpdatePtr = dynamic_cast<const WsfEventPipe::MsgSensorTrackUpdate*>(&aMessage))
+   {
+      UpdateTrack(mSensorTracks, sensorUpdatePtr->ownerIndex(), sensorUpdatePtr->track(), false);
+   }
+   else if (auto sensorDropPtr = dynamic_cast<const WsfEventPipe::MsgSensorTrackDrop*>(&aMessage))
+   {
+      mSensorTracks.erase(MakeTrackKey(sensorDropPtr->ownerIndex(), sensorDropPtr->trackId()));
+   }
+   else if (auto platformStatusPtr = dynamic_cast<const WsfEventPipe::MsgPlatformStatus*>(&aMessage))
+   {
+      if (!platformStatusPtr->removed())
+      {
+         return false;
+      }
+      RemovePlatform(platformStatusPtr->platformIndex());
+   }
+   else
+   {
+      return false;
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Replace the state with the state saved in a keyframe.
+void wsf::eventpipe::RecordingState::Load(const WsfEventPipe::MsgKeyframe& aKeyframe)
+{
+   Clear();
+   for (const auto& state : aKeyframe.entityStates())
+   {
+      mEntityStates[state.platformIndex()] = state;
+   }
+   for (const auto& part : aKeyframe.partStates())
+   {
+      mPartStates[PartKey(part.platformIndex(), part.partName(), static_cast<int>(part.partType()))] = part;
+   }
+   for (const auto& track : aKeyframe.localTracks())
+   {
+      mLocalTracks[MakeTrackKey(track.ownerIndex(), track.track().trackId())] = track;
+   }
+   for (const auto& track : aKeyframe.sensorTracks())
+   {
+      mSensorTracks[MakeTrackKey(track.ownerIndex(), track.track().trackId())] = track;
+   }
+}
+
+// =================================================================================================
+//! Save the state into a keyframe.
+//! The lists of the keyframe are in key order, so equal states produce identical keyframes.
+void wsf::eventpipe::RecordingState::Save(WsfEventPipe::MsgKeyframe& aKeyframe) const
+{
+   aKeyframe.entityStates().clear();
+   aKeyframe.partStates().clear();
+   aKeyframe.localTracks().clear();
+   aKeyframe.sensorTracks().clear();
+   for (const auto& state : mEntityStates)
+   {
+      aKeyframe.entityStates().push_back(state.second);
+   }
+   for (const auto& part : mPartStates)
+   {
+      aKeyframe.partStates().push_back(part.second);
+   }
+   for (const auto& track : mLocalTracks)
+   {
+      aKeyframe.localTracks().push_back(track.second);
+   }
+   for (const auto& track : mSensorTracks)
+   {
+      aKeyframe.sensorTracks().push_back(track.second);
+   }
+}
+
+// =================================================================================================
+// static private
+wsf::eventpipe::RecordingState::TrackKey
+wsf::eventpipe::RecordingState::MakeTrackKey(unsigned int aOwnerIndex, const WsfEventPipe::Track_Id& aTrackId)
+{
+   return TrackKey(aOwnerIndex, aTrackId.owner(), aTrackId.localTrackNumber());
+}
+
+// =================================================================================================
+// private
+void wsf::eventpipe::RecordingState::UpdateTrack(TrackMap&                  aTracks,
+                                                 unsigned int               aOwnerIndex,
+                                                 const WsfEventPipe::Track& aTrack,
+                                                 bool                       aMasterProcessor)
+{
+   WsfEventPipe::TrackState& state = aTracks[MakeTrackKey(aOwnerIndex, aTrack.trackId())];
+   state.ownerIndex(aOwnerIndex);
+   state.track(aTrack);
+   state.masterProcessor(aMasterProcessor);
+}
+
+// =================================================================================================
+//! Remove the state of a platform that has been removed from the simulation, including the tracks it holds.
+// private
+void wsf::eventpipe::RecordingState::RemovePlatform(unsigned int aPlatformIndex)
+{
+   mEntityStates.erase(aPlatformIndex);
+
+   auto partIter = mPartStates.lower_bound(PartKey(aPlatformIndex, std::string(), std::numeric_limits<int>::min()));
+   while ((partIter != mPartStates.end()) && (std::get<0>(partIter->first) == aPlatformIndex))
+   {
+      partIter = mPartStates.erase(partIter);
+   }
+   for (TrackMap* tracksPtr : {&mLocalTracks, &mSensorTracks})
+   {
+      auto trackIter = tracksPtr->lower_bound(TrackKey(aPlatformIndex, std::string(), std::numeric_limits<int>::min()));
+      while ((trackIter != tracksPtr->end()) && (std::get<0>(trackIter->first) == aPlatformIndex))
+      {
+         trackIter = tracksPtr->erase(trackIter);
+      }
+   }
+}
@@ -0,0 +1,66 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEVENTPIPERECORDINGSTATE_HPP
+#define WSFEVENTPIPERECORDINGSTATE_HPP
+
+#include "wsf_export.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "UtPack.hpp"
+#include "WsfEventPipeClasses.hpp"
+
+namespace wsf
+{
+namespace eventpipe
+{
+//! The state of the platforms in an event pipe recording: the latest entity state and part status of each platform,
+//! and the latest update of each local and sensor track.
+//!
+//! The state is built by applying the messages of a recording in order. The file writer saves it into each keyframe
+//! (MsgKeyframe), and a reader that starts decoding at a keyframe loads it from the keyframe. Because both use Apply,
+//! the state loaded from a keyframe is the state that is built by decoding every message before it.
+class WSF_EXPORT RecordingState
+{
+public:
+   void Clear();
+
+   bool Apply(const UtPackMessage& aMessage);
+
+   void Load(const WsfEventPipe::MsgKeyframe& aKeyframe);
+   void Save(WsfEventPipe::MsgKeyframe& aKeyframe) const;
+
+   size_t GetEntityCount() const { return mEntityStates.size(); }
+
+private:
+   //! A part key: the platform index, the part name and the part type.
+   using PartKey = std::tuple<unsigned int, std::string, int>;
+   //! A track key: the index of the platform that holds the track, and the track id (owner name and number).
+   using TrackKey = std::tuple<unsigned int, std::string, int>;
+   using TrackMap = std::map<TrackKey, WsfEventPipe::TrackState>;
+
+   static TrackKey MakeTrackKey(unsigned int aOwnerIndex, const WsfEventPipe::Track_Id& aTrackId);
+   void            UpdateTrack(TrackMap&                  aTracks,
+                               unsigned int               aOwnerIndex,
+                               const WsfEventPipe::Track& aTrack,
+                               bool                       aMasterProcessor);
+   void            RemovePlatform(unsigned int aPlatformIndex);
+
+   std::map<unsigned int, WsfEventPipe::EntityState> mEntityStates;
+   std::map<PartKey, WsfEventPipe::PartState>        mPartStates;
+   TrackMap                                          mLocalTracks;
+   TrackMap                                          mSensorTracks;
+};
+} // namespace eventpipe
+} // namespace wsf
+
+#endif
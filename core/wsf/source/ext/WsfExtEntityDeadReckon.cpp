@@ -12,6 +12,7 @@
 #include "ext/WsfExtEntityDeadReckon.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 #include "UtInput.hpp"
 #include "UtMath.hpp"
@@ -30,6 +31,7 @@ WsfExtEntityDeadReckon::WsfExtEntityDeadReckon(WsfExtInterface* aExtInterfacePtr
    , mUseInitialDistrubutionInterval(false)
    , mHeartbeatTimerOverride(0.0)
    , mInitialDistributionStart(0.0)
+   , mHeartbeatPhaseCount(0)
    , mExtInterfacePtr(aExtInterfacePtr)
 {
 }
@@ -113,7 +115,7 @@ void WsfExtEntityDeadReckon::HandlePlatformAdded(double aSimTime, WsfPlatform* a
       dr.mInitialized = true;
       if ((mHeartbeatRequired && (mHeartbeatTimer > 0.0)) || (mMoverUpdateTimer > 0.0))
       {
-         dr.mHeartbeatTimer = CalculateHeartbeatTimer(mHeartbeatTimer, mExtInterfacePtr->GetRandom().Uniform(0.9, 1.1));
+         dr.mHeartbeatTimer          = NextHeartbeatTimer(dr);
          double initialHeartbeatTime = aSimTime;
          if (initialHeartbeatTime - mInitialDistributionStart < mInitialDistributionInterval &&
              mUseInitialDistrubutionInterval)
@@ -215,8 +217,8 @@ double WsfExtEntityDeadReckon::HandleHeartbeat(double aSimTime, size_t aPlatform
    {
       if (heartbeatIntervalExpired)
       {
-         // Re-randomize the heartbeat timer for this platform +/- 10%
-         dr.mHeartbeatTimer = CalculateHeartbeatTimer(mHeartbeatTimer, mExtInterfacePtr->GetRandom().Uniform(0.9, 1.1));
+         // Re-randomize the heartbeat timer for this platform +/- 10% (or assign its phase if spreading heartbeats)
+         dr.mHeartbeatTimer = NextHeartbeatTimer(dr);
          // The above call to WsfPlatform::Update may not result in a call to
          // GetSimulation()->GetObserver().MoverUpdated. If the mover update time is not modified then MoverUpdated will
          // be called explicitly. if (lastPlatformUpdateTime == dr.mPlatformPtr->GetLastUpdateTime())
@@ -329,15 +331,17 @@ void WsfExtEntityDeadReckon::DR_State::Extrapolate(double aDeltaTime, WsfPlatfor
 WsfExtEntityDeadReckon::PlatformDR::PlatformDR(double aSimTime, WsfPlatform* aPlatformPtr)
    : mPlatformPtr(aPlatformPtr)
 {
-   mInitialized         = false;
-   mLastSendTime        = -1.0E9;
-   mLastTimeMoverUpdate = aSimTime;
+   mInitialized            = false;
+   mLastSendTime           = -1.0E9;
+   mLastTimeMoverUpdate    = aSimTime;
+   mHeartbeatPhaseAssigned = false;
    mSentState.LoadFromPlatform(aSimTime, *aPlatformPtr);
    mUpdatedState = mSentState;
 }
 
 WsfExtEntityDeadReckon::PlatformDR::PlatformDR()
    : mLastUpdateType(WsfExtEntityDeadReckon::cNO_CHANGE)
+   , mHeartbeatPhaseAssigned(false)
    , mPlatformPtr(nullptr)
 {
 }
@@ -363,6 +367,33 @@ double WsfExtEntityDeadReckon::CalculateHeartbeatTimer(double aAverageHeartbeatT
    return heartbeatTimer;
 }
 
+//! Return the heartbeat timer to be used for the next heartbeat interval of a platform.
+//! Normally this is the heartbeat timer randomized by +/- 10%. When spreading heartbeats, the first interval after
+//! the platform's initial heartbeat is a fraction of the heartbeat timer taken from the golden ratio sequence and
+//! all others are the full heartbeat timer. This places the heartbeats of any number of platforms evenly over the
+//! heartbeat interval, rather than relying on the random variation to separate them.
+double WsfExtEntityDeadReckon::NextHeartbeatTimer(PlatformDR& aDR)
+{
+   if (!mSpreadHeartbeats)
+   {
+      return CalculateHeartbeatTimer(mHeartbeatTimer, mExtInterfacePtr->GetRandom().Uniform(0.9, 1.1));
+   }
+   if (aDR.mLastSendTime < 0.0)
+   {
+      // The initial heartbeat has not been sent.
+      return CalculateHeartbeatTimer(mHeartbeatTimer, 1.0);
+   }
+   if (!aDR.mHeartbeatPhaseAssigned)
+   {
+      static const double cGOLDEN_RATIO_CONJUGATE = 0.6180339887498949;
+      aDR.mHeartbeatPhaseAssigned                 = true;
+      double fraction = std::fmod(static_cast<double>(mHeartbeatPhaseCount) * cGOLDEN_RATIO_CONJUGATE, 1.0);
+      ++mHeartbeatPhaseCount;
+      return CalculateHeartbeatTimer(mHeartbeatTimer, 1.0 - fraction); // (0, 1]
+   }
+   return CalculateHeartbeatTimer(mHeartbeatTimer, 1.0);
+}
+
 WsfExtEntityDeadReckon::DR_State::DR_State()
 {
    for (size_t i = 0; i < 3; ++i)
@@ -432,5 +463,6 @@ WsfExtEntityDeadReckonSetup::WsfExtEntityDeadReckonSetup()
    , mInitialDistributionInterval(0.0)
    , mEntityPositionThreshold(1.0)
    , mEntityOrientationThreshold(3.0 * UtMath::cRAD_PER_DEG)
+   , mSpreadHeartbeats(false)
 {
 }
@@ -37,6 +37,9 @@ struct WSF_EXPORT WsfExtEntityDeadReckonSetup
 
    double mEntityPositionThreshold;
    double mEntityOrientationThreshold;
+
+   //! If true, heartbeats are spread evenly over the heartbeat interval rather than randomized.
+   bool mSpreadHeartbeats;
 };
 
 //! Provides a central place where external interfaces can register for entity position updates
@@ -116,6 +119,8 @@ public:
       double       mLastSendTime;
       double       mLastTimeMoverUpdate;
       double       mHeartbeatTimer;
+      //! 'true' once the heartbeat phase has been assigned (when spreading heartbeats).
+      bool         mHeartbeatPhaseAssigned;
       WsfPlatform* mPlatformPtr;
       // State before MoverUpdated was last called with 'true'
       DR_State mSentState;
@@ -144,6 +149,8 @@ private:
 
    double CalculateHeartbeatTimer(double aAverageHeartbeatTimer, double aMultiplier) const;
 
+   double NextHeartbeatTimer(PlatformDR& aDR);
+
    //! Executes at a regular interval ensuring that a platform's mover is
    //! updated regularly.
    class HeartbeatEvent : public WsfEvent
@@ -175,6 +182,8 @@ private:
    bool   mUseInitialDistrubutionInterval;
    double mHeartbeatTimerOverride;
    double mInitialDistributionStart;
+   //! The number of heartbeat phases assigned (when spreading heartbeats).
+   size_t mHeartbeatPhaseCount;
 
    WsfExtInterface* mExtInterfacePtr;
 };
@@ -665,6 +665,10 @@ bool WsfExtData::ProcessDeadReckonInput(UtInput& aInput)
       aInput.ReadValueOfType(mDR_Setup.mInitialDistributionInterval, UtInput::cTIME);
       aInput.ValueGreater(mDR_Setup.mInitialDistributionInterval, 0.0);
    }
+   else if (command == "spread_heartbeats")
+   {
+      mDR_Setup.mSpreadHeartbeats = aInput.ReadBool();
+   }
    else if (command == "test_dead_reckon")
    {
       // allow this to be requested for testing without an external interface
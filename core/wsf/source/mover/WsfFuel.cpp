@@ -300,6 +300,11 @@ double WsfFuel::GetNetDepletionRate(const double aAltitude, const double aSpeed)
    return CalcConsumptionRateAltitudeSpeed(aAltitude, aSpeed) + GetSupplyRate() - GetReceiveRate();
 }
 
+// =================================================================================================
+//! Fuel is not told about other platforms by default (see WsfTankedFuel for an exception).
+// virtual
+void WsfFuel::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // =================================================================================================
 //! Updates the fuel data.
 //!
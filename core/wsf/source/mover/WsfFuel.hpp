@@ -60,6 +60,7 @@ public:
    bool Initialize2(double aSimTime) override;
    bool ProcessInput(UtInput& aInput) override;
    void Update(double aSimTime) override;
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    // NOTE: Fuel does not utilize TurnOn/TurnOff. It is updated when the mover is updated.
    //       If the mover is off then the fuel is considered to be off, and vice versa.
    //@}
@@ -312,6 +312,12 @@ void WsfMover::Update(double aSimTime)
    mLastUpdateTime = aSimTime;
 }
 
+// ================================================================================================
+//! A mover is not told about other platforms by default.
+//! A derived mover that overrides PlatformAdded or PlatformDeleted must declare the platforms it needs.
+// virtual
+void WsfMover::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // ================================================================================================
 //! Should the mover update calls by WsfPlatform be allowed?
 //! WsfPlatform::Update will invoke this to determine if the mover should be updated as part of the call.
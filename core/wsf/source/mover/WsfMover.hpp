@@ -65,6 +65,7 @@ public:
    using WsfPlatformPart::Initialize2;
    bool ProcessInput(UtInput& aInput) override;
    void Update(double aSimTime) override;
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    //@}
 
    //! @name Status methods.
@@ -14,9 +14,17 @@
 
 #include "WsfNavigationMesh.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <fstream>
+#include <iomanip>
 #include <memory>
+#include <random>
+#include <sstream>
 
 #include "UtEllipsoidalEarth.hpp"
 #include "UtInput.hpp"
@@ -24,6 +32,8 @@
 #include "UtLog.hpp"
 #include "UtMemory.hpp"
 #include "UtRandom.hpp"
+#include "UtThread.hpp"
+#include "WsfMappedFile.hpp"
 #include "WsfRoute.hpp"
 #include "WsfScenario.hpp"
 #include "WsfSimulation.hpp"
@@ -33,6 +43,93 @@
 
 #define MAX_TESSILLATION_LEVEL 5
 
+namespace
+{
+//! The navigation mesh cache file layout (all values in the byte order of the writing host) is:
+//! - The header (CacheHeader).
+//! - The cache key, padded to a multiple of 8 bytes.
+//! - A CacheCell for each cell.
+//! - The neighbor cell indices (std::uint32_t) of all of the cells.
+const char          cCACHE_MAGIC[8] = {'W', 'S', 'F', 'N', 'M', 'S', 'H', '\0'};
+const std::uint32_t cCACHE_VERSION  = 1;
+
+struct CacheHeader
+{
+   char          mMagic[8];
+   std::uint32_t mVersion;
+   std::uint32_t mKeySize;
+   std::uint64_t mCellCount;
+   std::uint64_t mNeighborCount;
+   double        mMinLat;
+   double        mMaxLat;
+   double        mMinLon;
+   double        mMaxLon;
+};
+
+struct CacheCell
+{
+   double        mVerts[3][3]; //!< The latitude, longitude and altitude of each vertex.
+   std::uint32_t mFirstNeighbor;
+   std::uint32_t mNeighborCount;
+   std::int32_t  mTessellationLevel;
+   std::uint32_t mTessellated;
+};
+
+size_t PadToCell(size_t aSize)
+{
+   return ((aSize + 7) / 8) * 8;
+}
+
+template<typename T>
+void AppendValue(std::string& aKey, const T& aValue)
+{
+   aKey.append(reinterpret_cast<const char*>(&aValue), sizeof(T));
+}
+
+//! Return the 64-bit FNV-1a hash of the specified bytes.
+std::uint64_t HashKey(const std::string& aKey)
+{
+   std::uint64_t hash = 14695981039346656037ULL;
+   for (char byte : aKey)
+   {
+      hash ^= static_cast<unsigned char>(byte);
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+//! Tessellates top level cells of the mesh. Each thread takes the next cell that has not been taken.
+class TessellationThread : public UtThread
+{
+public:
+   TessellationThread(WsfNavigationMesh&                            aMesh,
+                      std::vector<WsfNavigationMesh::TopLevelCell>& aTopLevelCells,
+                      std::atomic<size_t>&                          aNextCell)
+      : mMesh(aMesh)
+      , mTopLevelCells(aTopLevelCells)
+      , mNextCell(aNextCell)
+   {
+   }
+
+   void Run() override
+   {
+      for (size_t i = mNextCell++; i < mTopLevelCells.size(); i = mNextCell++)
+      {
+         WsfNavigationMesh::TopLevelCell& topLevelCell = mTopLevelCells[i];
+         if (topLevelCell.mZonePtr != nullptr)
+         {
+            mMesh.TessellateCell(topLevelCell.mCellPtr, topLevelCell.mZonePtr, 0, topLevelCell.mCells);
+         }
+      }
+   }
+
+private:
+   WsfNavigationMesh&                            mMesh;
+   std::vector<WsfNavigationMesh::TopLevelCell>& mTopLevelCells;
+   std::atomic<size_t>&                          mNextCell;
+};
+} // namespace
+
 WsfNavigationMesh::WsfNavigationMesh(WsfScenario* aScenarioPtr)
    : WsfPathFinder(aScenarioPtr)
    , mMeshCells()
@@ -50,6 +147,7 @@ WsfNavigationMesh::WsfNavigationMesh(WsfScenario* aScenarioPtr)
    , mNavMeshThinkTime(0.0)
    , mInputFile()
    , mOutputFile()
+   , mCacheDirectory()
    , mLoadBinaryFile(false)
    , mCellMap()
 {
@@ -80,7 +178,34 @@ bool WsfNavigationMesh::Initialize(WsfSimulation* aSimulationPtr)
 
    if (mInputFile.empty())
    {
-      CreateNavigationMesh();
+      // The mesh depends only on the grid and the zone geometry, so it can be reused if neither changes.
+      std::string cacheKey;
+      std::string cacheFileName;
+      if (!mCacheDirectory.empty())
+      {
+         if (HasFixedZones())
+         {
+            cacheKey = GetMeshCacheKey();
+            std::ostringstream oss;
+            oss << mCacheDirectory << "/navmesh_" << std::hex << std::setw(16) << std::setfill('0') << HashKey(cacheKey)
+                << ".bin";
+            cacheFileName = oss.str();
+         }
+         else
+         {
+            auto out = ut::log::warning() << "Navigation mesh cache not used because a zone is not fixed.";
+            out.AddNote() << "Navigation Mesh: " << GetName();
+         }
+      }
+
+      if (cacheFileName.empty() || (!LoadMeshCache(cacheFileName, cacheKey)))
+      {
+         CreateNavigationMesh();
+         if (!cacheFileName.empty())
+         {
+            WriteMeshCache(cacheFileName, cacheKey);
+         }
+      }
       if (!mOutputFile.empty())
       {
          GenerateExportedNavMesh();
@@ -104,6 +229,10 @@ void WsfNavigationMesh::CreateNavigationMesh()
    WsfGeoPoint  tempPoint;
    unsigned int cellNumber = 0;
 
+   // The top level cells that intersect a zone are tessellated after they have all been created,
+   // which allows them to be tessellated in parallel.
+   std::vector<TopLevelCell> topLevelCells;
+
    // Static cast is okay here, mXSize and mYSize are logically enforced to be 0 or greater.
    // These member variables should be updated in future maintenance efforts.
    for (x = 0U; x < static_cast<unsigned int>(mXSize); ++x)
@@ -149,7 +278,7 @@ void WsfNavigationMesh::CreateNavigationMesh()
          }
          if (insideCount == NO_INTERACTION)
          {
-            mMeshCells.push_back(navCellPtr);
+            topLevelCells.push_back(TopLevelCell{navCellPtr, nullptr, {navCellPtr}});
             ++cellNumber;
             ++y;
          }
@@ -157,7 +286,7 @@ void WsfNavigationMesh::CreateNavigationMesh()
          {
             if (insideCount != THREE_VERTS_INSIDE)
             {
-               TessellateCell(navCellPtr, zonePtr, 0);
+               topLevelCells.push_back(TopLevelCell{navCellPtr, zonePtr, {}});
             }
          }
 
@@ -198,7 +327,7 @@ void WsfNavigationMesh::CreateNavigationMesh()
          }
          if (insideCount == NO_INTERACTION)
          {
-            mMeshCells.push_back(mirrorPtr);
+            topLevelCells.push_back(TopLevelCell{mirrorPtr, nullptr, {mirrorPtr}});
             ++cellNumber;
             ++y;
          }
@@ -206,12 +335,18 @@ void WsfNavigationMesh::CreateNavigationMesh()
          {
             if (insideCount != THREE_VERTS_INSIDE)
             {
-               TessellateCell(mirrorPtr, zonePtr, 0);
+               topLevelCells.push_back(TopLevelCell{mirrorPtr, zonePtr, {}});
             }
          }
       }
    }
 
+   TessellateTopLevelCells(topLevelCells);
+   for (const TopLevelCell& topLevelCell : topLevelCells)
+   {
+      mMeshCells.insert(mMeshCells.end(), topLevelCell.mCells.begin(), topLevelCell.mCells.end());
+   }
+
    // at this point the boundaries have been calculated, set the center
    SetMeshCenter();
    // set a unique identifier for each cell...
@@ -325,12 +460,13 @@ void WsfNavigationMesh::LinkGridNeighbors(WsfNavigationCell* aNavCellPtr)
    while (aNavCellPtr->mNeighborIterator != aNavCellPtr->mNeighbors.end())
    {
       WsfNavigationCell* neighborPtr       = *aNavCellPtr->mNeighborIterator;
-      WsfPFNode          anotherNode       = (WsfPFNode&)*GetGrid(neighborPtr->mCellNumber, 0);
+      WsfPFNode          anotherNode       = (WsfPFNode&)*mGrid.at(neighborPtr->mCellNumber);
       WsfPFNode*         anotherTmpNodePtr = &anotherNode;
       if (anotherTmpNodePtr->mX >= 0 && anotherTmpNodePtr->mY >= 0 && tmpNodePtr->mX >= 0 && tmpNodePtr->mY >= 0)
       {
          WsfPFEdge tempEdge(tmpNodePtr, anotherTmpNodePtr);
-         insert_edge(GetGrid((long)aNavCellPtr->mCellNumber, 0), GetGrid((long)neighborPtr->mCellNumber, 0), tempEdge);
+         // Look up the nodes in mGrid by cell number rather than with GetGrid, which scans every node in the graph.
+         insert_edge(mGrid.at(aNavCellPtr->mCellNumber), mGrid.at(neighborPtr->mCellNumber), tempEdge);
       }
       ++(aNavCellPtr->mNeighborIterator);
    }
@@ -1139,6 +1275,16 @@ WsfNavigationMesh::ZONE_INTERACTION WsfNavigationMesh::GetCellZoneInteraction(Ws
    return (ZONE_INTERACTION)insideCount;
 }
 void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefinition* aZonePtr, int aCurrentTessLevel)
+{
+   TessellateCell(aCellPtr, aZonePtr, aCurrentTessLevel, mMeshCells);
+}
+
+//! Tessellate a cell against a zone, appending the resulting cells to aCells.
+//! This does not modify the mesh, so cells may be tessellated concurrently if the zones are fixed (see HasFixedZones).
+void WsfNavigationMesh::TessellateCell(WsfNavigationCell*               aCellPtr,
+                                       WsfZoneDefinition*               aZonePtr,
+                                       int                              aCurrentTessLevel,
+                                       std::vector<WsfNavigationCell*>& aCells)
 {
    // The following should always be true about the cell passed into this function
    // point 1 is the where the right angle of the cell is
@@ -1232,14 +1378,14 @@ void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefin
    if (insideCount == NO_INTERACTION)
    {
       navCellAPtr->mTessillated = true;
-      mMeshCells.push_back(navCellAPtr);
+      aCells.push_back(navCellAPtr);
    }
    else
    {
       // if this is the case then all points of the cell are inside of the zone, no need to make this cell
       if (insideCount != THREE_VERTS_INSIDE && aCurrentTessLevel < MAX_TESSILLATION_LEVEL)
       {
-         TessellateCell(navCellAPtr, aZonePtr, aCurrentTessLevel + 1);
+         TessellateCell(navCellAPtr, aZonePtr, aCurrentTessLevel + 1, aCells);
       }
    }
 
@@ -1257,14 +1403,14 @@ void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefin
    if (insideCount == NO_INTERACTION)
    {
       navCellBPtr->mTessillated = true;
-      mMeshCells.push_back(navCellBPtr);
+      aCells.push_back(navCellBPtr);
    }
    else
    {
       // if this is the case then all points of the cell are inside of the zone, no need to make this cell
       if (insideCount != THREE_VERTS_INSIDE && aCurrentTessLevel < MAX_TESSILLATION_LEVEL)
       {
-         TessellateCell(navCellBPtr, aZonePtr, aCurrentTessLevel + 1);
+         TessellateCell(navCellBPtr, aZonePtr, aCurrentTessLevel + 1, aCells);
       }
    }
 
@@ -1280,7 +1426,7 @@ void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefin
 
    if (insideCount == NO_INTERACTION)
    {
-      mMeshCells.push_back(navCellCPtr);
+      aCells.push_back(navCellCPtr);
    }
    else
    {
@@ -1288,7 +1434,7 @@ void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefin
       if (insideCount != THREE_VERTS_INSIDE && aCurrentTessLevel < MAX_TESSILLATION_LEVEL)
       {
          navCellCPtr->mTessillated = true;
-         TessellateCell(navCellCPtr, aZonePtr, aCurrentTessLevel + 1);
+         TessellateCell(navCellCPtr, aZonePtr, aCurrentTessLevel + 1, aCells);
       }
    }
 
@@ -1306,14 +1452,14 @@ void WsfNavigationMesh::TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefin
    if (insideCount == NO_INTERACTION)
    {
       navCellDPtr->mTessillated = true;
-      mMeshCells.push_back(navCellDPtr);
+      aCells.push_back(navCellDPtr);
    }
    else
    {
       // if this is the case then all points of the cell are inside of the zone, no need to make this cell
       if (insideCount != THREE_VERTS_INSIDE && aCurrentTessLevel < MAX_TESSILLATION_LEVEL)
       {
-         TessellateCell(navCellDPtr, aZonePtr, aCurrentTessLevel + 1);
+         TessellateCell(navCellDPtr, aZonePtr, aCurrentTessLevel + 1, aCells);
       }
    }
 }
@@ -1550,6 +1696,270 @@ void WsfNavigationMesh::ImportNavMesh()
    ut::log::info() << "Finished processing Navigation Mesh.";
 }
 
+//! Return 'true' if every zone is a zone definition whose geometry does not depend on another platform
+//! or the observer. Only then is the mesh determined by its inputs and may the zones be tested concurrently.
+bool WsfNavigationMesh::HasFixedZones()
+{
+   for (WsfZone* zonePtr : mZones)
+   {
+      WsfZoneDefinition* zoneDefPtr = dynamic_cast<WsfZoneDefinition*>(zonePtr);
+      if ((zoneDefPtr == nullptr) || (!zoneDefPtr->GetReferencePlatformName().Empty()) ||
+          (zoneDefPtr->GetRelativeType() == WsfZoneDefinition::cOBSERVER))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+//! Return the key of the mesh cache, which contains everything the mesh depends on.
+//! The zones must be fixed (see HasFixedZones).
+std::string WsfNavigationMesh::GetMeshCacheKey()
+{
+   std::string key;
+   AppendValue(key, cCACHE_VERSION);
+   AppendValue(key, static_cast<std::int32_t>(MAX_TESSILLATION_LEVEL));
+   AppendValue(key, mUpperLeft.GetLat());
+   AppendValue(key, mUpperLeft.GetLon());
+   AppendValue(key, mLowerRight.GetLat());
+   AppendValue(key, mLowerRight.GetLon());
+   AppendValue(key, mGridSizeDegrees);
+   AppendValue(key, static_cast<std::uint64_t>(mZones.size()));
+   for (WsfZone* zonePtr : mZones)
+   {
+      WsfZoneDefinition* zoneDefPtr = static_cast<WsfZoneDefinition*>(zonePtr);
+      double             values[2];
+      AppendValue(key, static_cast<std::int32_t>(zoneDefPtr->GetShapeType()));
+      AppendValue(key, static_cast<std::int32_t>(zoneDefPtr->GetRelativeType()));
+      AppendValue(key, zoneDefPtr->IsNegative());
+      AppendValue(key, zoneDefPtr->PointsAreLatLon());
+      AppendValue(key, zoneDefPtr->GetReferenceLat());
+      AppendValue(key, zoneDefPtr->GetReferenceLon());
+      AppendValue(key, zoneDefPtr->GetReferenceHeading());
+      AppendValue(key, zoneDefPtr->GetRadius());
+      AppendValue(key, zoneDefPtr->GetMinRadius());
+      AppendValue(key, zoneDefPtr->GetLatAxisLength());
+      AppendValue(key, zoneDefPtr->GetLonAxisLength());
+      zoneDefPtr->GetAltBounds(values[0], values[1]);
+      AppendValue(key, values);
+      zoneDefPtr->GetAngleBounds(values[0], values[1]);
+      AppendValue(key, values);
+      AppendValue(key, static_cast<std::uint64_t>(zoneDefPtr->GetPoints().size()));
+      for (const WsfZone::Point& point : zoneDefPtr->GetPoints())
+      {
+         AppendValue(key, point.mX);
+         AppendValue(key, point.mY);
+      }
+   }
+   return key;
+}
+
+//! Load the mesh from a cache file written by WriteMeshCache.
+//! The cells and their neighbors are read directly from the mapped file; nothing is tessellated.
+//! @returns 'false' if the file does not exist or was not written for the specified key.
+bool WsfNavigationMesh::LoadMeshCache(const std::string& aFileName, const std::string& aKey)
+{
+   WsfMappedFile file;
+   if (!file.Open(aFileName))
+   {
+      return false;
+   }
+
+   const char* dataPtr  = file.GetData();
+   size_t      dataSize = file.GetSize();
+   CacheHeader header;
+   if (dataSize < sizeof(header))
+   {
+      return false;
+   }
+   std::memcpy(&header, dataPtr, sizeof(header));
+   size_t cellOffset = sizeof(header) + PadToCell(aKey.size());
+   if ((std::memcmp(header.mMagic, cCACHE_MAGIC, sizeof(cCACHE_MAGIC)) != 0) || (header.mVersion != cCACHE_VERSION) ||
+       (header.mKeySize != aKey.size()) || (cellOffset > dataSize) ||
+       (std::memcmp(dataPtr + sizeof(header), aKey.data(), aKey.size()) != 0) ||
+       (header.mCellCount > (dataSize - cellOffset) / sizeof(CacheCell)))
+   {
+      return false;
+   }
+   size_t neighborOffset = cellOffset + static_cast<size_t>(header.mCellCount) * sizeof(CacheCell);
+   if (header.mNeighborCount > (dataSize - neighborOffset) / sizeof(std::uint32_t))
+   {
+      return false;
+   }
+
+   auto cellsPtr     = reinterpret_cast<const CacheCell*>(dataPtr + cellOffset);
+   auto neighborsPtr = reinterpret_cast<const std::uint32_t*>(dataPtr + neighborOffset);
+   for (std::uint64_t i = 0; i < header.mCellCount; ++i)
+   {
+      const CacheCell& cell = cellsPtr[i];
+      if ((cell.mFirstNeighbor > header.mNeighborCount) ||
+          (cell.mNeighborCount > header.mNeighborCount - cell.mFirstNeighbor))
+      {
+         return false;
+      }
+      for (std::uint32_t j = 0; j < cell.mNeighborCount; ++j)
+      {
+         if (neighborsPtr[cell.mFirstNeighbor + j] >= header.mCellCount)
+         {
+            return false;
+         }
+      }
+   }
+
+   mMeshCells.reserve(static_cast<size_t>(header.mCellCount));
+   for (std::uint64_t i = 0; i < header.mCellCount; ++i)
+   {
+      const CacheCell&   cell       = cellsPtr[i];
+      WsfNavigationCell* navCellPtr = new WsfNavigationCell();
+      for (const auto& vert : cell.mVerts)
+      {
+         navCellPtr->AddVertex(WsfGeoPoint(vert[0], vert[1], vert[2]));
+      }
+      navCellPtr->mCellID           = static_cast<unsigned int>(i);
+      navCellPtr->mCellNumber       = static_cast<unsigned int>(i);
+      navCellPtr->mTessilationLevel = cell.mTessellationLevel;
+      navCellPtr->mTessillated      = (cell.mTessellated != 0);
+      mMeshCells.push_back(navCellPtr);
+   }
+   for (std::uint64_t i = 0; i < header.mCellCount; ++i)
+   {
+      const CacheCell& cell = cellsPtr[i];
+      for (std::uint32_t j = 0; j < cell.mNeighborCount; ++j)
+      {
+         mMeshCells[i]->mNeighbors.push_back(mMeshCells[neighborsPtr[cell.mFirstNeighbor + j]]);
+      }
+   }
+
+   mMinLat = header.mMinLat;
+   mMaxLat = header.mMaxLat;
+   mMinLon = header.mMinLon;
+   mMaxLon = header.mMaxLon;
+   SetMeshCenter();
+
+   mGrid = std::vector<node_iterator>(mMeshCells.size());
+   for (WsfNavigationCell* tmpPtr : mMeshCells)
+   {
+      InsertCellIntoGrid(tmpPtr);
+   }
+   for (WsfNavigationCell* tmpPtr : mMeshCells)
+   {
+      LinkGridNeighbors(tmpPtr);
+   }
+
+   auto out = ut::log::info() << "Loaded navigation mesh from cache.";
+   out.AddNote() << "Navigation Mesh: " << GetName();
+   out.AddNote() << "File: " << aFileName;
+   return true;
+}
+
+//! Write the mesh to a cache file that can be loaded by LoadMeshCache.
+//! The file is written under a temporary name and then renamed, so simultaneous runs never read a partial file.
+void WsfNavigationMesh::WriteMeshCache(const std::string& aFileName, const std::string& aKey)
+{
+   CacheHeader header;
+   std::memcpy(header.mMagic, cCACHE_MAGIC, sizeof(cCACHE_MAGIC));
+   header.mVersion       = cCACHE_VERSION;
+   header.mKeySize       = static_cast<std::uint32_t>(aKey.size());
+   header.mCellCount     = mMeshCells.size();
+   header.mNeighborCount = 0;
+   header.mMinLat        = mMinLat;
+   header.mMaxLat        = mMaxLat;
+   header.mMinLon        = mMinLon;
+   header.mMaxLon        = mMaxLon;
+
+   std::vector<CacheCell>     cells(mMeshCells.size());
+   std::vector<std::uint32_t> neighbors;
+   for (size_t i = 0; i < mMeshCells.size(); ++i)
+   {
+      const WsfNavigationCell* navCellPtr = mMeshCells[i];
+      CacheCell&               cell       = cells[i];
+      if (navCellPtr->mVerts.size() != 3)
+      {
+         return; // Only the triangles created by CreateNavigationMesh can be cached.
+      }
+      for (size_t j = 0; j < 3; ++j)
+      {
+         cell.mVerts[j][0] = navCellPtr->mVerts[j].GetLat();
+         cell.mVerts[j][1] = navCellPtr->mVerts[j].GetLon();
+         cell.mVerts[j][2] = navCellPtr->mVerts[j].GetAlt();
+      }
+      cell.mFirstNeighbor     = static_cast<std::uint32_t>(neighbors.size());
+      cell.mNeighborCount     = static_cast<std::uint32_t>(navCellPtr->mNeighbors.size());
+      cell.mTessellationLevel = navCellPtr->mTessilationLevel;
+      cell.mTessellated       = navCellPtr->mTessillated ? 1 : 0;
+      for (const WsfNavigationCell* neighborPtr : navCellPtr->mNeighbors)
+      {
+         neighbors.push_back(neighborPtr->mCellID);
+      }
+   }
+   header.mNeighborCount = neighbors.size();
+
+   std::ostringstream tempFileName;
+   tempFileName << aFileName << '.' << std::hex << std::random_device()() << ".tmp";
+   std::ofstream stream(tempFileName.str(), std::ios::binary | std::ios::out);
+   if (stream.is_open())
+   {
+      std::string paddedKey(aKey);
+      paddedKey.resize(PadToCell(aKey.size()), '\0');
+      stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      stream.write(paddedKey.data(), paddedKey.size());
+      stream.write(reinterpret_cast<const char*>(cells.data()), cells.size() * sizeof(CacheCell));
+      stream.write(reinterpret_cast<const char*>(neighbors.data()), neighbors.size() * sizeof(std::uint32_t));
+      stream.close();
+   }
+   // If the rename fails the cache was probably written by another run, which is just as good.
+   if ((!stream) || (std::rename(tempFileName.str().c_str(), aFileName.c_str()) != 0))
+   {
+      std::remove(tempFileName.str().c_str());
+      if (!stream)
+      {
+         auto out = ut::log::warning() << "Unable to write navigation mesh cache.";
+         out.AddNote() << "Navigation Mesh: " << GetName();
+         out.AddNote() << "File: " << aFileName;
+      }
+   }
+}
+
+//! Tessellate the top level cells that intersect a zone.
+//! If the zones are fixed and the simulation is multi-threaded, the cells are tessellated in parallel (using the
+//! number_of_threads of the simulation), as each may be tessellated independently.
+void WsfNavigationMesh::TessellateTopLevelCells(std::vector<TopLevelCell>& aTopLevelCells)
+{
+   size_t threadCount = 1;
+   if ((GetSimulation() != nullptr) && GetSimulation()->MultiThreaded())
+   {
+      size_t tessellationCount =
+         std::count_if(aTopLevelCells.begin(),
+                       aTopLevelCells.end(),
+                       [](const TopLevelCell& aTopLevelCell) { return aTopLevelCell.mZonePtr != nullptr; });
+      int configuredCount = GetSimulation()->GetSimulationInput().GetNumberOfThreads();
+      threadCount         = std::min(static_cast<size_t>(std::max(configuredCount, 1)), tessellationCount);
+   }
+   if ((threadCount > 1) && HasFixedZones())
+   {
+      std::atomic<size_t>                              nextCell(0);
+      std::vector<std::unique_ptr<TessellationThread>> threads;
+      UtThread::UtThreads                              threadPtrs;
+      for (size_t i = 0; i < threadCount; ++i)
+      {
+         threads.push_back(ut::make_unique<TessellationThread>(*this, aTopLevelCells, nextCell));
+         threadPtrs.push_back(threads.back().get());
+         threads.back()->Start();
+      }
+      UtThread::JoinAll(threadPtrs);
+   }
+   else
+   {
+      for (TopLevelCell& topLevelCell : aTopLevelCells)
+      {
+         if (topLevelCell.mZonePtr != nullptr)
+         {
+            TessellateCell(topLevelCell.mCellPtr, topLevelCell.mZonePtr, 0, topLevelCell.mCells);
+         }
+      }
+   }
+}
+
 bool WsfNavigationMesh::ProcessInput(UtInput& aInput)
 {
    bool        myCommand = true;
@@ -1615,6 +2025,11 @@ bool WsfNavigationMesh::ProcessInput(UtInput& aInput)
       aInput.ReadValue(mInputFile);
       mLoadBinaryFile = true;
    }
+   else if (command == "cache_directory")
+   {
+      aInput.ReadValueQuoted(mCacheDirectory);
+      mCacheDirectory = aInput.SubstitutePathVariables(mCacheDirectory);
+   }
    else if (command == "think_time")
    {
       std::string sTime;
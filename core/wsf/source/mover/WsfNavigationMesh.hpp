@@ -19,6 +19,8 @@
 
 #include <limits>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "UtVec3.hpp"
 #include "WsfDraw.hpp"
@@ -73,7 +75,19 @@ public:
    WsfNavigationCell*              GetCellForPoint(const WsfGeoPoint& aPoint);
    std::vector<WsfNavigationCell*> GetCellsForPoint(const WsfGeoPoint& aPoint);
 
+   //! A top level cell of the mesh and the cells that replace it.
+   struct TopLevelCell
+   {
+      WsfNavigationCell*              mCellPtr;
+      WsfZoneDefinition*              mZonePtr; //!< The zone the cell must be tessellated against, or nullptr.
+      std::vector<WsfNavigationCell*> mCells;
+   };
+
    void TessellateCell(WsfNavigationCell* aCellPtr, WsfZoneDefinition* aZonePtr, int aCurrentTessLevel);
+   void TessellateCell(WsfNavigationCell*               aCellPtr,
+                       WsfZoneDefinition*               aZonePtr,
+                       int                              aCurrentTessLevel,
+                       std::vector<WsfNavigationCell*>& aCells);
 
    ZONE_INTERACTION GetCellZoneInteraction(WsfNavigationCell* aCellPtr, WsfZoneDefinition* aZonePtr);
    void             ReNumberMeshCells();
@@ -105,6 +119,12 @@ private:
    void GenerateExportedNavMesh();
    void ImportNavMesh();
 
+   bool        HasFixedZones();
+   std::string GetMeshCacheKey();
+   bool        LoadMeshCache(const std::string& aFileName, const std::string& aKey);
+   void        WriteMeshCache(const std::string& aFileName, const std::string& aKey);
+   void        TessellateTopLevelCells(std::vector<TopLevelCell>& aTopLevelCells);
+
    class pf_cost_func : public PFGraph::cost_func
    {
    public:
@@ -156,6 +176,7 @@ private:
    double                                     mNavMeshThinkTime;
    std::string                                mInputFile;
    std::string                                mOutputFile;
+   std::string                                mCacheDirectory;
    bool                                       mLoadBinaryFile;
    std::map<unsigned int, WsfNavigationCell*> mCellMap;
 };
@@ -20,6 +20,7 @@
 #include "UtQuaternion.hpp"
 #include "UtVec3.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSimulation.hpp"
 
 namespace
@@ -152,6 +153,17 @@ void WsfOffsetMover::SetPlatform(WsfPlatform* aPlatformPtr)
    WsfMover::SetPlatform(aPlatformPtr);
 }
 
+//! The mover is interested only in its reference platform.
+// virtual
+void WsfOffsetMover::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddPlatformName(mReferenceNameId);
+   if (mReferencePtr != nullptr)
+   {
+      aInterest.AddPlatformName(mReferencePtr->GetNameId());
+   }
+}
+
 // virtual
 void WsfOffsetMover::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 {
@@ -267,6 +279,7 @@ void WsfOffsetMover::SetReference(double aSimTime, const std::string& aReference
          mReferencePtr->AttachObserver(this);
          GetPlatform()->Update(aSimTime);
       }
+      GetSimulation()->PlatformInterestChanged(*GetPlatform());
    }
 }
 
@@ -57,6 +57,7 @@ public:
    bool             ProcessInput(UtInput& aInput) override;
    void             Update(double aSimTime) override;
    void             SetPlatform(WsfPlatform* aPlatformPtr) override;
+   void             AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void             PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) override;
    void             PlatformDeleted(WsfPlatform* aPlatformPtr) override;
    //@}
@@ -28,6 +28,7 @@
 
 #include "WsfPathFinder.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -60,6 +61,63 @@
 #include "script/WsfScriptContext.hpp"
 #include "script/WsfScriptManager.hpp"
 
+namespace
+{
+//! An entry in the open list of the A* search of the grid.
+struct OpenNode
+{
+   double mEstimate; //!< The cost from the source plus the estimated cost to the destination.
+   double mCost;     //!< The cost from the source.
+   long   mIndex;
+};
+
+//! The heap ordering of the open list; the node with the lowest estimate is at the top.
+//! Ties are broken deterministically (see WsfPathFinder::FindGridPath): the node with the higher cost from the
+//! source (i.e., closer to the destination) and then the node with the lower index is at the top.
+bool OpenNodeFollows(const OpenNode& aLhs, const OpenNode& aRhs)
+{
+   if (aLhs.mEstimate != aRhs.mEstimate)
+   {
+      return aLhs.mEstimate > aRhs.mEstimate;
+   }
+   if (aLhs.mCost != aRhs.mCost)
+   {
+      return aLhs.mCost < aRhs.mCost;
+   }
+   return aLhs.mIndex > aRhs.mIndex;
+}
+
+//! The working storage of the A* search. Each thread has its own, which is reused by all of its searches.
+struct SearchWorkspace
+{
+   //! Prepare for a search of a grid with the specified number of nodes.
+   void Reset(size_t aNodeCount)
+   {
+      if (mVisit.size() < aNodeCount)
+      {
+         mCost.resize(aNodeCount);
+         mParent.resize(aNodeCount);
+         mVisit.resize(aNodeCount, 0);
+      }
+      // A node has been reached by the current search only if it is marked with the current visit number,
+      // so nothing has to be cleared between searches.
+      if (++mVisitNumber == 0)
+      {
+         std::fill(mVisit.begin(), mVisit.end(), 0);
+         mVisitNumber = 1;
+      }
+      mOpen.clear();
+   }
+
+   std::vector<double>       mCost;
+   std::vector<long>         mParent;
+   std::vector<unsigned int> mVisit;
+   unsigned int              mVisitNumber = 0;
+   std::vector<OpenNode>     mOpen;
+};
+
+thread_local SearchWorkspace sSearchWorkspace;
+} // namespace
 
 WsfPathFinder::WsfPathFinder(WsfScenario* aScenarioPtr, WsfGeoPoint& aUpperLeft, WsfGeoPoint& aLowerRight, double aGridSizeDegrees)
    : mScenarioPtr(aScenarioPtr)
@@ -75,6 +133,8 @@ WsfPathFinder::WsfPathFinder(WsfScenario* aScenarioPtr, WsfGeoPoint& aUpperLeft,
    , mInitialized(false)
    , mDebugDrawObjPtr(nullptr)
    , mDebugEnabled(false)
+   , mGridLocationsWCS()
+   , mGridWeightsPtr()
 {
    mLowerRight.SetLocationLLA(0, 0, 0);
    mUpperLeft.SetLocationLLA(0, 0, 0);
@@ -94,6 +154,8 @@ WsfPathFinder::WsfPathFinder(WsfScenario* aScenarioPtr)
    , mInitialized(false)
    , mDebugDrawObjPtr(nullptr)
    , mDebugEnabled(false)
+   , mGridLocationsWCS()
+   , mGridWeightsPtr()
 {
    mLowerRight.SetLocationLLA(0, 0, 0);
    mUpperLeft.SetLocationLLA(0, 0, 0);
@@ -177,6 +239,15 @@ bool WsfPathFinder::Initialize(WsfSimulation* aSimulationPtr)
    }
 
 
+   // Save the node locations so path queries do not have to use (and update) the locations of the nodes.
+   mGridLocationsWCS.resize(mGrid.size());
+   for (size_t index = 0; index < mGrid.size(); ++index)
+   {
+      double locWCS[3];
+      mGrid[index]->first.mLoc.GetLocationWCS(locWCS);
+      mGridLocationsWCS[index] = UtVec3d(locWCS);
+   }
+
    mInitialized = true;
    //   mEnabled = true;
    RecalculateWeights();
@@ -210,13 +281,24 @@ void WsfPathFinder::AddZone(WsfZone* aZonePtr, double aWeight)
    {
       mZones.push_back(aZonePtr);
       mZoneWeights[aZonePtr] = aWeight;
+      if (mInitialized && (!mGridLocationsWCS.empty()))
+      {
+         UpdateGridWeights(aZonePtr, true);
+      }
    }
 }
 
 void WsfPathFinder::RemoveZone(WsfZone* aZonePtr)
 {
-   mZones.remove(aZonePtr);
-   mZoneWeights.erase(aZonePtr);
+   if (ContainsZone(aZonePtr))
+   {
+      mZones.remove(aZonePtr);
+      mZoneWeights.erase(aZonePtr);
+      if (mInitialized && (!mGridLocationsWCS.empty()))
+      {
+         UpdateGridWeights(aZonePtr, false);
+      }
+   }
 }
 
 bool WsfPathFinder::ContainsZone(WsfZone* aZonePtr)
@@ -287,6 +369,153 @@ void WsfPathFinder::RecalculateWeights()
          }
       }
    }
+
+   if (!mGridLocationsWCS.empty())
+   {
+      PublishGridWeights();
+   }
+}
+
+//! Get the range of grid cells whose nodes may be inside the zone.
+void WsfPathFinder::GetGridBounds(WsfZone* aZonePtr, long& aMinX, long& aMinY, long& aMaxX, long& aMaxY) const
+{
+   aMinX = 0;
+   aMinY = 0;
+   aMaxX = mXSize - 1;
+   aMaxY = mYSize - 1;
+
+   // Longitudes are not wrapped, so the whole grid is used if either the zone or the grid is not within [-180, 180].
+   double minLat;
+   double minLon;
+   double maxLat;
+   double maxLon;
+   if ((!aZonePtr->GetInclusionBounds(minLat, minLon, maxLat, maxLon)) || (minLon < -180.0) || (maxLon > 180.0) ||
+       (mUpperLeft.GetLon() < -180.0) || (mLowerRight.GetLon() > 180.0))
+   {
+      return;
+   }
+
+   // Node (i, j) is at the center of its cell. The range is expanded by a cell to allow for round-off.
+   double minX = std::floor((minLon - mUpperLeft.GetLon()) / mGridSizeDegrees - 0.5) - 1.0;
+   double maxX = std::ceil((maxLon - mUpperLeft.GetLon()) / mGridSizeDegrees - 0.5) + 1.0;
+   double minY = std::floor((mUpperLeft.GetLat() - maxLat) / mGridSizeDegrees - 0.5) - 1.0;
+   double maxY = std::ceil((mUpperLeft.GetLat() - minLat) / mGridSizeDegrees - 0.5) + 1.0;
+   aMinX       = static_cast<long>(std::max(minX, 0.0));
+   aMinY       = static_cast<long>(std::max(minY, 0.0));
+   aMaxX       = static_cast<long>(std::min(maxX, static_cast<double>(mXSize - 1)));
+   aMaxY       = static_cast<long>(std::min(maxY, static_cast<double>(mYSize - 1)));
+}
+
+//! Update the weights of the nodes affected by adding or removing a zone.
+//! The resulting weights are the same as those computed by RecalculateWeights.
+void WsfPathFinder::UpdateGridWeights(WsfZone* aZonePtr, bool aZoneAdded)
+{
+   long minX;
+   long minY;
+   long maxX;
+   long maxY;
+   GetGridBounds(aZonePtr, minX, minY, maxX, maxY);
+
+   // Compute the new weights before taking the lock, so queries are not held up by the zone tests.
+   std::vector<std::pair<long, double>> newWeights;
+   double                               locWCS[3];
+   for (long y = minY; y <= maxY; ++y)
+   {
+      for (long x = minX; x <= maxX; ++x)
+      {
+         const WsfPFNode& node   = mGrid[x + mXSize * y]->first;
+         double           weight = node.mWeight;
+         if (weight == std::numeric_limits<double>::max())
+         {
+            continue;
+         }
+         UtVec3d::Set(locWCS, mGridLocationsWCS[x + mXSize * y].GetData());
+         if (aZoneAdded)
+         {
+            // The zone is last in the list, so adding its weight gives the same result as recalculating.
+            if (aZonePtr->PointIsInside(GetSimulation(), locWCS, nullptr, 0))
+            {
+               newWeights.emplace_back(x + mXSize * y, weight + mZoneWeights[aZonePtr]);
+            }
+         }
+         else if (aZonePtr->PointIsInside(GetSimulation(), locWCS, nullptr, 0))
+         {
+            weight = node.mBaseWeight;
+            for (WsfZone* zonePtr : mZones)
+            {
+               if (zonePtr->PointIsInside(GetSimulation(), locWCS, nullptr, 0))
+               {
+                  if (weight != std::numeric_limits<double>::max())
+                  {
+                     weight += mZoneWeights[zonePtr];
+                  }
+               }
+            }
+            newWeights.emplace_back(x + mXSize * y, weight);
+         }
+      }
+   }
+
+   if (newWeights.empty())
+   {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(mGridWeightsMutex);
+   if (mGridWeightsPtr.use_count() > 1)
+   {
+      // A query is using the current weights.
+      mGridWeightsPtr = std::make_shared<GridWeights>(*mGridWeightsPtr);
+   }
+   GridWeights& gridWeights = *mGridWeightsPtr;
+   bool         minRaised   = false;
+   for (const auto& newWeight : newWeights)
+   {
+      double& weight = gridWeights.mWeights[newWeight.first];
+      minRaised      = minRaised || ((weight == gridWeights.mMinWeight) && (newWeight.second > weight));
+      weight         = newWeight.second;
+
+      mGrid[newWeight.first]->first.mWeight = weight;
+      if ((weight < gridWeights.mMinWeight) && (weight != std::numeric_limits<double>::max()))
+      {
+         gridWeights.mMinWeight = weight;
+      }
+   }
+   if (minRaised)
+   {
+      gridWeights.mMinWeight = std::numeric_limits<double>::max();
+      for (double weight : gridWeights.mWeights)
+      {
+         if (weight < gridWeights.mMinWeight)
+         {
+            gridWeights.mMinWeight = weight;
+         }
+      }
+   }
+}
+
+//! Return the weights to be used by a path query.
+std::shared_ptr<const WsfPathFinder::GridWeights> WsfPathFinder::GetGridWeights() const
+{
+   std::lock_guard<std::mutex> lock(mGridWeightsMutex);
+   return mGridWeightsPtr;
+}
+
+//! Replace the weights used by path queries with the current node weights.
+void WsfPathFinder::PublishGridWeights()
+{
+   auto gridWeightsPtr        = std::make_shared<GridWeights>();
+   gridWeightsPtr->mMinWeight = std::numeric_limits<double>::max();
+   gridWeightsPtr->mWeights.reserve(mGrid.size());
+   for (const auto& nodeIter : mGrid)
+   {
+      double weight = nodeIter->first.mWeight;
+      gridWeightsPtr->mWeights.push_back(weight);
+      gridWeightsPtr->mMinWeight = std::min(gridWeightsPtr->mMinWeight, weight);
+   }
+
+   std::lock_guard<std::mutex> lock(mGridWeightsMutex);
+   mGridWeightsPtr = std::move(gridWeightsPtr);
 }
 
 const WsfPFNode* WsfPathFinder::GetClosestNode(const WsfGeoPoint& aPointPtr)
@@ -411,10 +640,132 @@ bool WsfPathFinder::shortest_path(const_node_iterator aSrcNodeIter,
       // The reinterprest_cast is required by the Visual Studio 6.0 compiler.
       // It should be necessary because comm_cost_func derives from cost_func.
       aCostFuncPtr = reinterpret_cast<cost_func*>(&costFunc);
+
+      // The default costs on the grid built by Initialize are searched directly,
+      // unless there are negative weights (which are left to the general search).
+      if ((!mGridLocationsWCS.empty()) && (aSrcNodeIter != end()) && (aDstNodeIter != end()))
+      {
+         std::shared_ptr<const GridWeights> gridWeightsPtr = GetGridWeights();
+         if (gridWeightsPtr->mMinWeight >= 0.0)
+         {
+            return FindGridPath(*gridWeightsPtr,
+                                aSrcNodeIter->first.mX + mXSize * aSrcNodeIter->first.mY,
+                                aDstNodeIter->first.mX + mXSize * aDstNodeIter->first.mY,
+                                aPath,
+                                aCost);
+         }
+      }
    }
    return PFGraph::shortest_path(aSrcNodeIter, aDstNodeIter, aPath, aCost, aCostFuncPtr);
 }
 
+//! Find the least cost path on the grid built by Initialize using the default costs (see pf_cost_func).
+//! This is an A* search whose estimate of the remaining cost is the straight line distance to the destination
+//! times the smallest node weight. As the estimate never exceeds the actual cost, the path cost is the same as
+//! that found by the general search of the graph. Where several paths have the least cost, the path may differ from
+//! that of the general search, but it is always the same for the same grid and weights: nodes with equal estimates
+//! are expanded in the order given by OpenNodeFollows, the adjacent nodes are visited in order of increasing index,
+//! and a node keeps the first parent through which its least cost was found.
+//! This may be called from several threads at once, and concurrently with AddZone and RemoveZone.
+//! The weights must not be negative.
+bool WsfPathFinder::FindGridPath(const GridWeights& aGridWeights,
+                                 long               aSrcIndex,
+                                 long               aDstIndex,
+                                 NodeList&          aPath,
+                                 double&            aCost) const
+{
+   aPath.clear();
+   aCost = std::numeric_limits<double>::max();
+
+   const std::vector<double>& weights = aGridWeights.mWeights;
+   if ((aDstIndex != aSrcIndex) && (weights[aDstIndex] == std::numeric_limits<double>::max()))
+   {
+      return false;
+   }
+
+   // The estimate is reduced very slightly so round-off cannot make it exceed the actual cost.
+   double estimateScale = 0.0;
+   if ((aGridWeights.mMinWeight > 0.0) && (aGridWeights.mMinWeight != std::numeric_limits<double>::max()))
+   {
+      estimateScale = aGridWeights.mMinWeight * (1.0 - 1.0E-9);
+   }
+   const UtVec3d& dstLocWCS = mGridLocationsWCS[aDstIndex];
+
+   SearchWorkspace& workspace = sSearchWorkspace;
+   workspace.Reset(weights.size());
+   workspace.mCost[aSrcIndex]   = 0.0;
+   workspace.mParent[aSrcIndex] = aSrcIndex;
+   workspace.mVisit[aSrcIndex]  = workspace.mVisitNumber;
+   workspace.mOpen.push_back(
+      OpenNode{(mGridLocationsWCS[aSrcIndex] - dstLocWCS).Magnitude() * estimateScale, 0.0, aSrcIndex});
+
+   bool found = false;
+   while (!workspace.mOpen.empty())
+   {
+      std::pop_heap(workspace.mOpen.begin(), workspace.mOpen.end(), OpenNodeFollows);
+      OpenNode openNode = workspace.mOpen.back();
+      workspace.mOpen.pop_back();
+      if (openNode.mCost > workspace.mCost[openNode.mIndex])
+      {
+         continue; // A lower cost to the node has since been found.
+      }
+      if (openNode.mIndex == aDstIndex)
+      {
+         found = true;
+         break;
+      }
+
+      // Visit the (up to) 8 adjacent nodes.
+      long           x      = openNode.mIndex % mXSize;
+      long           y      = openNode.mIndex / mXSize;
+      const UtVec3d& locWCS = mGridLocationsWCS[openNode.mIndex];
+      for (long adjY = std::max(y - 1, 0L); adjY <= std::min(y + 1, mYSize - 1); ++adjY)
+      {
+         for (long adjX = std::max(x - 1, 0L); adjX <= std::min(x + 1, mXSize - 1); ++adjX)
+         {
+            long   adjIndex = adjX + mXSize * adjY;
+            double weight   = weights[adjIndex];
+            if ((adjIndex == openNode.mIndex) || (weight == std::numeric_limits<double>::max()))
+            {
+               continue;
+            }
+            const UtVec3d& adjLocWCS = mGridLocationsWCS[adjIndex];
+            double         cost      = openNode.mCost + (locWCS - adjLocWCS).Magnitude() * weight;
+            if ((workspace.mVisit[adjIndex] != workspace.mVisitNumber) || (cost < workspace.mCost[adjIndex]))
+            {
+               workspace.mCost[adjIndex]   = cost;
+               workspace.mParent[adjIndex] = openNode.mIndex;
+               workspace.mVisit[adjIndex]  = workspace.mVisitNumber;
+               workspace.mOpen.push_back(
+                  OpenNode{cost + (adjLocWCS - dstLocWCS).Magnitude() * estimateScale, cost, adjIndex});
+               std::push_heap(workspace.mOpen.begin(), workspace.mOpen.end(), OpenNodeFollows);
+            }
+         }
+      }
+   }
+
+   if (found)
+   {
+      aCost = workspace.mCost[aDstIndex];
+
+      std::vector<long> indices;
+      for (long index = aDstIndex; index != aSrcIndex; index = workspace.mParent[index])
+      {
+         indices.push_back(index);
+      }
+      indices.push_back(aSrcIndex);
+
+      // The nodes are copied under the lock because AddZone and RemoveZone update their weights.
+      std::lock_guard<std::mutex> lock(mGridWeightsMutex);
+      aPath.reserve(indices.size());
+      for (auto indexIter = indices.rbegin(); indexIter != indices.rend(); ++indexIter)
+      {
+         aPath.push_back(mGrid[*indexIter]->first);
+      }
+   }
+   return found;
+}
+
 WsfPathFinder::node_iterator WsfPathFinder::GetGrid(long aX, long aY)
 {
    return mGrid.at(aX + mXSize * aY);
@@ -1456,6 +1807,14 @@ bool WsfPathFinderTypes::ProcessInput(UtInput& aInput)
    return LoadInstance(aInput);
 }
 
+bool WsfPathFinderTypes::GetInputKeywords(std::vector<std::string>& aKeywords) const
+{
+   aKeywords.push_back("pathfinder");
+   aKeywords.push_back("terrainpathfinder");
+   aKeywords.push_back("navigationmesh");
+   return true;
+}
+
 WsfPathFinderList::WsfPathFinderList()
 {
    mSimulationPtr = nullptr;
@@ -34,12 +34,15 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 class pf_cost_func;
 #include "UtGraph.hpp"
 class UtInput;
 class UtInputBlock;
+#include "UtVec3.hpp"
 class WsfDraw;
 #include "WsfGeoPoint.hpp"
 #include "WsfObject.hpp"
@@ -122,13 +125,20 @@ public:
 
    // Add aZonePtr with weight aWeight.  Higher weights mean stronger avoidance.
    // Does not allow duplicates.
+   // Once the grid has been initialized, only the weights of the nodes within the bounds of the zone are updated.
    void AddZone(WsfZone* aZonePtr, double aWeight);
 
    // Remove aZonePtr if it exists.
+   // Once the grid has been initialized, only the weights of the nodes within the bounds of the zone are updated.
    void RemoveZone(WsfZone* aZonePtr);
 
+   // Recalculate the weights of every node (e.g. after zones have moved).
+   // This must not be called while paths are being found.
    void RecalculateWeights();
 
+   // Find the least cost path between two points.
+   // For the grid built by WsfPathFinder::Initialize this may be called from several threads at once,
+   // and concurrently with AddZone and RemoveZone.
    virtual bool FindPath(const WsfGeoPoint& aStartPtr, WsfGeoPoint& aEndPtr, WsfRoute& aRoute, double& aCost);
 
    virtual const WsfPFNode* GetClosestNode(const WsfGeoPoint& aPointPtr);
@@ -227,6 +237,35 @@ protected:
          return (aNode1.mWeight == std::numeric_limits<double>::max() ? false : true);
       }
    };
+
+private:
+   //! The node weights used by path queries on the grid built by WsfPathFinder::Initialize.
+   //! A query uses the weights that were current when it started, so weights that may be in use are never modified;
+   //! they are replaced instead.
+   struct GridWeights
+   {
+      std::vector<double> mWeights;   //!< The weight of each node, indexed by grid index.
+      double              mMinWeight; //!< The smallest weight of a node that may be entered.
+   };
+
+   bool FindGridPath(const GridWeights& aGridWeights,
+                     long               aSrcIndex,
+                     long               aDstIndex,
+                     NodeList&          aPath,
+                     double&            aCost) const;
+
+   void GetGridBounds(WsfZone* aZonePtr, long& aMinX, long& aMinY, long& aMaxX, long& aMaxY) const;
+   void UpdateGridWeights(WsfZone* aZonePtr, bool aZoneAdded);
+   void PublishGridWeights();
+
+   std::shared_ptr<const GridWeights> GetGridWeights() const;
+
+   //! The WCS location of each node of the grid, indexed by grid index.
+   //! This is empty unless the grid was built by WsfPathFinder::Initialize.
+   std::vector<UtVec3d> mGridLocationsWCS;
+
+   std::shared_ptr<GridWeights> mGridWeightsPtr;
+   mutable std::mutex           mGridWeightsMutex; //!< Guards mGridWeightsPtr and the node weights.
 };
 
 class WsfPathFinderTypes : public WsfObjectTypeList<WsfPathFinder>
@@ -237,6 +276,7 @@ public:
    virtual LoadResult             LoadInstance(UtInput& aInput);
    void                           ProcessBlock(UtInputBlock& aInputBlock, WsfPathFinder* aPFPtr, bool init);
    bool                           ProcessInput(UtInput& aInput) override;
+   bool                           GetInputKeywords(std::vector<std::string>& aKeywords) const override;
 
    // static WsfPathFinder* FindPathFinder(const std::string& aName);
 
@@ -0,0 +1,358 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfTSPI_Archive.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "UtInput.hpp"
+#include "UtInputBlock.hpp"
+#include "UtLog.hpp"
+#include "WsfTSPI.hpp"
+
+namespace
+{
+//! The archives that are currently open, keyed by file name.
+//! Entries are weak so an archive is unmapped when its last user releases it.
+std::mutex                                                  sOpenArchivesMutex;
+std::map<std::string, std::weak_ptr<const WsfTSPI_Archive>> sOpenArchives;
+
+//! Round an offset up to the alignment of a record.
+std::uint64_t AlignToRecord(std::uint64_t aOffset)
+{
+   const std::uint64_t alignment = alignof(WsfTSPI_Archive::Record);
+   return ((aOffset + alignment - 1) / alignment) * alignment;
+}
+
+//! Return the modification time of a file, or false if the file does not exist.
+bool GetModificationTime(const std::string& aFileName, time_t& aTime)
+{
+   struct stat results;
+   if (stat(aFileName.c_str(), &results) != 0)
+   {
+      return false;
+   }
+   aTime = results.st_mtime;
+   return true;
+}
+} // namespace
+
+const char WsfTSPI_Archive::cMAGIC[8] = {'W', 'S', 'F', 'T', 'S', 'P', 'I', '\0'};
+
+// =================================================================================================
+//! Return the index of the first record whose time is not less than the specified time.
+//! If all records are before the specified time then the record count is returned.
+size_t WsfTSPI_Archive::Trajectory::FindIndex(double aTime) const
+{
+   const Record* endPtr = mRecordsPtr + mRecordCount;
+   const Record* iter   = std::lower_bound(mRecordsPtr,
+                                         endPtr,
+                                         aTime,
+                                         [](const Record& aRecord, double aValue) { return aRecord.mTime < aValue; });
+   return static_cast<size_t>(iter - mRecordsPtr);
+}
+
+// =================================================================================================
+//! Add a trajectory to the archive being created.
+//! @param aName    The name of the trajectory.
+//! @param aRecords The records of the trajectory.
+//! @returns false if the name is already in use or the records are empty or not in increasing time order.
+bool WsfTSPI_Archive::Writer::AddTrajectory(const std::string& aName, std::vector<Record> aRecords)
+{
+   for (const auto& trajectory : mTrajectories)
+   {
+      if (trajectory.first == aName)
+      {
+         return false;
+      }
+   }
+   if (aRecords.empty() ||
+       !std::is_sorted(aRecords.begin(),
+                       aRecords.end(),
+                       [](const Record& aLhs, const Record& aRhs) { return aLhs.mTime < aRhs.mTime; }))
+   {
+      return false;
+   }
+   mTrajectories.emplace_back(aName, std::move(aRecords));
+   return true;
+}
+
+// =================================================================================================
+//! Write the archive file.
+//! The archive is written to a temporary file that is then renamed, so a reader never sees a partially written
+//! archive.
+//! @returns false if the file could not be written.
+bool WsfTSPI_Archive::Writer::Write(const std::string& aFileName) const
+{
+   Header header;
+   std::memcpy(header.mMagic, cMAGIC, sizeof(header.mMagic));
+   header.mVersion         = cVERSION;
+   header.mTrajectoryCount = static_cast<std::uint32_t>(mTrajectories.size());
+
+   // Lay out the file: header, directory, names and then the (aligned) records.
+   std::vector<DirectoryEntry> directory(mTrajectories.size());
+   std::uint64_t               offset = sizeof(Header) + directory.size() * sizeof(DirectoryEntry);
+   for (size_t i = 0; i < mTrajectories.size(); ++i)
+   {
+      directory[i].mNameOffset = offset;
+      directory[i].mNameLength = mTrajectories[i].first.size();
+      offset += directory[i].mNameLength;
+   }
+   for (size_t i = 0; i < mTrajectories.size(); ++i)
+   {
+      offset                     = AlignToRecord(offset);
+      directory[i].mRecordOffset = offset;
+      directory[i].mRecordCount  = mTrajectories[i].second.size();
+      offset += directory[i].mRecordCount * sizeof(Record);
+   }
+
+   std::ostringstream tempFileName;
+   tempFileName << aFileName << '.' << std::hex << std::random_device()() << ".tmp";
+   std::ofstream stream(tempFileName.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+   if (!stream)
+   {
+      return false;
+   }
+   stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   stream.write(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(DirectoryEntry));
+   for (const auto& trajectory : mTrajectories)
+   {
+      stream.write(trajectory.first.data(), trajectory.first.size());
+   }
+   for (size_t i = 0; i < mTrajectories.size(); ++i)
+   {
+      static const char padding[alignof(Record)] = {};
+      std::uint64_t     position = static_cast<std::uint64_t>(stream.tellp());
+      stream.write(padding, directory[i].mRecordOffset - position);
+      stream.write(reinterpret_cast<const char*>(mTrajectories[i].second.data()),
+                   mTrajectories[i].second.size() * sizeof(Record));
+   }
+   stream.close();
+   if ((!stream) || (std::rename(tempFileName.str().c_str(), aFileName.c_str()) != 0))
+   {
+      std::remove(tempFileName.str().c_str());
+      return false;
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Open an archive.
+//! An archive that is already open is shared rather than mapped again.
+//! @param aFileName The name of the archive file.
+//! @returns The archive, or an empty pointer if the file could not be opened or is not a valid archive.
+// static
+std::shared_ptr<const WsfTSPI_Archive> WsfTSPI_Archive::Open(const std::string& aFileName)
+{
+   std::lock_guard<std::mutex> lock(sOpenArchivesMutex);
+
+   std::shared_ptr<const WsfTSPI_Archive> archivePtr = sOpenArchives[aFileName].lock();
+   if (archivePtr == nullptr)
+   {
+      std::shared_ptr<WsfTSPI_Archive> newArchivePtr(new WsfTSPI_Archive(aFileName));
+      if (newArchivePtr->mFile.Open(aFileName) && newArchivePtr->Load())
+      {
+         archivePtr               = newArchivePtr;
+         sOpenArchives[aFileName] = archivePtr;
+      }
+      else
+      {
+         sOpenArchives.erase(aFileName);
+      }
+   }
+   return archivePtr;
+}
+
+// =================================================================================================
+//! Convert a TSPI value to an archive record.
+// static
+void WsfTSPI_Archive::ToRecord(const WsfTSPI& aTSPI, Record& aRecord)
+{
+   aRecord.mTime    = aTSPI.mTime();
+   aRecord.mLat     = aTSPI.mLat();
+   aRecord.mLon     = aTSPI.mLon();
+   aRecord.mAlt     = aTSPI.mAlt();
+   aRecord.mSpeed   = aTSPI.mSpeed();
+   aRecord.mHeading = aTSPI.mHeading();
+   aRecord.mPitch   = aTSPI.mPitch();
+   aRecord.mRoll    = aTSPI.mRoll();
+}
+
+// =================================================================================================
+//! Convert an archive record to a TSPI value.
+//! The unit conversions of the TSPI elements are not applied because records are in internal units.
+// static
+void WsfTSPI_Archive::ToTSPI(const Record& aRecord, WsfTSPI& aTSPI)
+{
+   aTSPI.mTime    = aRecord.mTime;
+   aTSPI.mLat     = aRecord.mLat;
+   aTSPI.mLon     = aRecord.mLon;
+   aTSPI.mAlt     = aRecord.mAlt;
+   aTSPI.mSpeed   = aRecord.mSpeed;
+   aTSPI.mHeading = aRecord.mHeading;
+   aTSPI.mPitch   = aRecord.mPitch;
+   aTSPI.mRoll    = aRecord.mRoll;
+}
+
+// =================================================================================================
+// private
+WsfTSPI_Archive::WsfTSPI_Archive(const std::string& aFileName)
+   : mFileName(aFileName)
+   , mFile()
+   , mTrajectories()
+{
+}
+
+// =================================================================================================
+//! Return the trajectory with the specified name, or nullptr if the archive does not contain it.
+const WsfTSPI_Archive::Trajectory* WsfTSPI_Archive::FindTrajectory(const std::string& aName) const
+{
+   auto iter = mTrajectories.find(aName);
+   return (iter != mTrajectories.end()) ? &iter->second : nullptr;
+}
+
+// =================================================================================================
+//! Validate the mapped file and build the trajectory directory.
+// private
+bool WsfTSPI_Archive::Load()
+{
+   const char* dataPtr  = mFile.GetData();
+   size_t      dataSize = mFile.GetSize();
+   if (dataSize < sizeof(Header))
+   {
+      return false;
+   }
+   Header header;
+   std::memcpy(&header, dataPtr, sizeof(header));
+   if ((std::memcmp(header.mMagic, cMAGIC, sizeof(cMAGIC)) != 0) || (header.mVersion != cVERSION))
+   {
+      return false;
+   }
+
+   std::uint64_t directoryEnd = sizeof(Header) + std::uint64_t(header.mTrajectoryCount) * sizeof(DirectoryEntry);
+   if (directoryEnd > dataSize)
+   {
+      return false;
+   }
+   for (std::uint32_t i = 0; i < header.mTrajectoryCount; ++i)
+   {
+      DirectoryEntry entry;
+      std::memcpy(&entry, dataPtr + sizeof(Header) + i * sizeof(DirectoryEntry), sizeof(entry));
+      if ((entry.mNameOffset > dataSize) || (entry.mNameLength > (dataSize - entry.mNameOffset)) ||
+          (entry.mRecordOffset > dataSize) || ((entry.mRecordOffset % alignof(Record)) != 0) ||
+          (entry.mRecordCount > ((dataSize - entry.mRecordOffset) / sizeof(Record))))
+      {
+         return false;
+      }
+      std::string name(dataPtr + entry.mNameOffset, static_cast<size_t>(entry.mNameLength));
+      auto        recordsPtr = reinterpret_cast<const Record*>(dataPtr + entry.mRecordOffset);
+      mTrajectories.emplace(name, Trajectory(recordsPtr, static_cast<size_t>(entry.mRecordCount)));
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Process the 'tspi_archive' block, which converts text TSPI files into an archive.
+//! The data format commands of WSF_TSPI_MOVER apply to the text files of the trajectories that follow them.
+bool WsfTSPI_ArchiveExtension::ProcessInput(UtInput& aInput)
+{
+   if (aInput.GetCommand() != "tspi_archive")
+   {
+      return false;
+   }
+
+   std::string archiveName;
+   aInput.ReadValueQuoted(archiveName);
+   archiveName = aInput.SubstitutePathVariables(archiveName);
+
+   // Gather the trajectories and the data format that applies to each.
+   struct Source
+   {
+      std::string mName;
+      std::string mFileName;
+      WsfTSPI     mFormat;
+   };
+   std::vector<Source> sources;
+   WsfTSPI             format;
+   UtInputBlock        block(aInput);
+   std::string         command;
+   while (block.ReadCommand(command))
+   {
+      if (command == "trajectory")
+      {
+         Source source;
+         aInput.ReadValue(source.mName);
+         aInput.ReadValueQuoted(source.mFileName);
+         source.mFileName = aInput.LocateFile(source.mFileName);
+         source.mFormat   = format;
+         sources.push_back(source);
+      }
+      else if (!format.ProcessInput(aInput))
+      {
+         throw UtInput::UnknownCommand(aInput);
+      }
+   }
+
+   // The archive need not be rebuilt if it is newer than the input file defining it and every text file.
+   time_t archiveTime;
+   time_t sourceTime;
+   bool   upToDate = GetModificationTime(archiveName, archiveTime) &&
+                   GetModificationTime(aInput.GetCurrentFileName(), sourceTime) && (sourceTime <= archiveTime);
+   for (size_t i = 0; upToDate && (i < sources.size()); ++i)
+   {
+      upToDate = GetModificationTime(sources[i].mFileName, sourceTime) && (sourceTime <= archiveTime);
+   }
+   if (upToDate)
+   {
+      auto out = ut::log::info() << "TSPI archive is up to date.";
+      out.AddNote() << "File: " << archiveName;
+      return true;
+   }
+
+   WsfTSPI_Archive::Writer writer;
+   for (const Source& source : sources)
+   {
+      std::ifstream stream(source.mFileName);
+      if (!stream)
+      {
+         throw UtInput::BadValue(aInput, "Unable to open TSPI file: " + source.mFileName);
+      }
+      std::vector<WsfTSPI_Archive::Record> records;
+      WsfTSPI                              tspi(source.mFormat);
+      while (stream >> tspi)
+      {
+         records.emplace_back();
+         WsfTSPI_Archive::ToRecord(tspi, records.back());
+      }
+      if (!writer.AddTrajectory(source.mName, std::move(records)))
+      {
+         throw UtInput::BadValue(aInput,
+                                 "Trajectory " + source.mName +
+                                    " is a duplicate, is empty or is not in increasing time order: " +
+                                    source.mFileName);
+      }
+   }
+
+   if (!writer.Write(archiveName))
+   {
+      throw UtInput::BadValue(aInput, "Unable to write TSPI archive: " + archiveName);
+   }
+   auto out = ut::log::info() << "Wrote TSPI archive.";
+   out.AddNote() << "File: " << archiveName;
+   return true;
+}
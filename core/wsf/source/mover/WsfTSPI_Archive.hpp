@@ -0,0 +1,142 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFTSPI_ARCHIVE_HPP
+#define WSFTSPI_ARCHIVE_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class UtInput;
+#include "WsfMappedFile.hpp"
+#include "WsfScenarioExtension.hpp"
+class WsfTSPI;
+
+//! A binary archive of TSPI trajectories (see WsfTSPI).
+//!
+//! An archive holds the trajectories of any number of platforms, each identified by name. The records of a
+//! trajectory are stored contiguously in increasing time order and in internal units (seconds, degrees, meters,
+//! meters/second and radians), so they are used directly from the memory mapped file without any parsing and a
+//! record at a given time is found with a binary search.
+//!
+//! Archives are opened with Open(), which maps each file only once and shares it between all of its users.
+//! Archives are written with the Writer class, normally through the 'tspi_archive' input block which converts
+//! text TSPI files (see WsfTSPI_ArchiveExtension).
+//!
+//! The file layout (all values in the byte order of the writing host) is:
+//! - The header (Header).
+//! - The trajectory directory (a DirectoryEntry for each trajectory).
+//! - The trajectory names.
+//! - The records of each trajectory, each block aligned so the records may be accessed in place.
+class WSF_EXPORT WsfTSPI_Archive
+{
+public:
+   //! A single TSPI record.
+   struct Record
+   {
+      double mTime;    //!< seconds
+      double mLat;     //!< degrees
+      double mLon;     //!< degrees
+      double mAlt;     //!< meters
+      double mSpeed;   //!< meters/second
+      double mHeading; //!< radians
+      double mPitch;   //!< radians
+      double mRoll;    //!< radians
+   };
+
+   //! The records of a single trajectory. The records refer directly to the mapped archive.
+   class Trajectory
+   {
+   public:
+      Trajectory(const Record* aRecordsPtr = nullptr, size_t aRecordCount = 0)
+         : mRecordsPtr(aRecordsPtr)
+         , mRecordCount(aRecordCount)
+      {
+      }
+
+      const Record* GetRecords() const { return mRecordsPtr; }
+      size_t        GetRecordCount() const { return mRecordCount; }
+      const Record& GetRecord(size_t aIndex) const { return mRecordsPtr[aIndex]; }
+
+      size_t FindIndex(double aTime) const;
+
+   private:
+      const Record* mRecordsPtr;
+      size_t        mRecordCount;
+   };
+
+   //! Creates an archive file.
+   class WSF_EXPORT Writer
+   {
+   public:
+      bool AddTrajectory(const std::string& aName, std::vector<Record> aRecords);
+      bool Write(const std::string& aFileName) const;
+
+   private:
+      std::vector<std::pair<std::string, std::vector<Record>>> mTrajectories;
+   };
+
+   static std::shared_ptr<const WsfTSPI_Archive> Open(const std::string& aFileName);
+
+   static void ToRecord(const WsfTSPI& aTSPI, Record& aRecord);
+   static void ToTSPI(const Record& aRecord, WsfTSPI& aTSPI);
+
+   ~WsfTSPI_Archive() = default;
+   WsfTSPI_Archive(const WsfTSPI_Archive& aSrc) = delete;
+   WsfTSPI_Archive& operator=(const WsfTSPI_Archive& aRhs) = delete;
+
+   const std::string& GetFileName() const { return mFileName; }
+
+   const Trajectory* FindTrajectory(const std::string& aName) const;
+
+private:
+   //! The archive file header.
+   struct Header
+   {
+      char          mMagic[8];
+      std::uint32_t mVersion;
+      std::uint32_t mTrajectoryCount;
+   };
+
+   //! Describes a trajectory in the archive. Offsets are from the start of the file.
+   struct DirectoryEntry
+   {
+      std::uint64_t mNameOffset;
+      std::uint64_t mNameLength;
+      std::uint64_t mRecordOffset;
+      std::uint64_t mRecordCount;
+   };
+
+   static const char          cMAGIC[8];
+   static const std::uint32_t cVERSION = 1;
+
+   explicit WsfTSPI_Archive(const std::string& aFileName);
+
+   bool Load();
+
+   std::string   mFileName;
+   WsfMappedFile mFile;
+
+   std::unordered_map<std::string, Trajectory> mTrajectories;
+};
+
+//! The scenario extension that processes the 'tspi_archive' block, which converts text TSPI files to an archive.
+class WSF_EXPORT WsfTSPI_ArchiveExtension : public WsfScenarioExtension
+{
+public:
+   bool ProcessInput(UtInput& aInput) override;
+};
+
+#endif
@@ -14,6 +14,7 @@
 
 #include "WsfTSPI_Mover.hpp"
 
+#include <algorithm>
 #include <cstdio>  // for std::remove()
 #include <cstdlib> // for system()
 #include <fstream>
@@ -58,9 +59,56 @@ WsfTSPI_Mover::WsfTSPI_Mover(WsfScenario& aScenario)
    , mCurrentTSPI()
    , mReadTSPI()
    , mMovement()
+   , mArchiveName()
+   , mTrajectoryName()
+   , mArchivePtr()
+   , mRecords()
+   , mMovedRecords()
+   , mNextRecord(0)
 {
 }
 
+//-------------------------------------------------------------------------------------------------
+//! Copy constructor (for Clone()).
+//! The copy does not share the input file of the source, and its trajectory refers to its own copy of any relocated
+//! archive records rather than to those of the source.
+// protected
+WsfTSPI_Mover::WsfTSPI_Mover(const WsfTSPI_Mover& aSrc)
+   : WsfMover(aSrc)
+   , mInputStreamPtr(nullptr)
+   , mFileName(aSrc.mFileName)
+   , mIsOpen(false)
+   , mEOF(aSrc.mEOF)
+   , mIsInitialized(aSrc.mIsInitialized)
+   , mTranslate(aSrc.mTranslate)
+   , mStartAtInitialTime(aSrc.mStartAtInitialTime)
+   , mDeleteOnDestruct(aSrc.mDeleteOnDestruct)
+   , mIsExtrapolating(aSrc.mIsExtrapolating)
+   , mAtEndOfPath(aSrc.mAtEndOfPath)
+   , mStartTime(aSrc.mStartTime)
+   , mTSPI_StartTime(aSrc.mTSPI_StartTime)
+   , mCurrentUpdateTime(aSrc.mCurrentUpdateTime)
+   , mDeltaLat(aSrc.mDeltaLat)
+   , mDeltaLon(aSrc.mDeltaLon)
+   , mRefLat(aSrc.mRefLat)
+   , mRefLon(aSrc.mRefLon)
+   , mLastTSPI(aSrc.mLastTSPI)
+   , mCurrentTSPI(aSrc.mCurrentTSPI)
+   , mReadTSPI(aSrc.mReadTSPI)
+   , mMovement(aSrc.mMovement)
+   , mArchiveName(aSrc.mArchiveName)
+   , mTrajectoryName(aSrc.mTrajectoryName)
+   , mArchivePtr(aSrc.mArchivePtr)
+   , mRecords(aSrc.mRecords)
+   , mMovedRecords(aSrc.mMovedRecords)
+   , mNextRecord(aSrc.mNextRecord)
+{
+   if (!mMovedRecords.empty())
+   {
+      mRecords = WsfTSPI_Archive::Trajectory(mMovedRecords.data(), mMovedRecords.size());
+   }
+}
+
 //-------------------------------------------------------------------------------------------------
 // virtual
 WsfTSPI_Mover::~WsfTSPI_Mover()
@@ -74,6 +122,7 @@ bool WsfTSPI_Mover::SetFileName(const std::string& aName)
    if (!mIsOpen)
    {
       mFileName = GetScenario().GetInput().LocateFile(aName);
+      mArchiveName.clear();
       return true;
    }
    return false;
@@ -93,6 +142,17 @@ bool WsfTSPI_Mover::ProcessInput(UtInput& aInput)
       aInput.ReadValue(fn);
       SetFileName(fn); // will provide variable substitution
    }
+   else if (command == "archive")
+   {
+      std::string fileName;
+      aInput.ReadValueQuoted(fileName);
+      mArchiveName = aInput.LocateFile(fileName);
+      mFileName.clear();
+   }
+   else if (command == "trajectory")
+   {
+      aInput.ReadValue(mTrajectoryName);
+   }
    else if (command == "start_time")
    {
       aInput.ReadValueOfType(mStartTime, UtInput::cTIME);
@@ -215,9 +275,16 @@ bool WsfTSPI_Mover::Initialize(double aSimTime)
    bool ok = WsfMover::Initialize(aSimTime);
 
    // Initialize TSPI file and data
-   mInputStreamPtr = new std::ifstream();
-   OpenFile(mFileName);
-   *mInputStreamPtr >> mReadTSPI;
+   if (!mArchiveName.empty())
+   {
+      OpenArchive();
+   }
+   else
+   {
+      mInputStreamPtr = new std::ifstream();
+      OpenFile(mFileName);
+   }
+   ReadNextTSPI();
    mCurrentTSPI    = mReadTSPI;
    mTSPI_StartTime = mCurrentTSPI.mTime();
 
@@ -310,6 +377,22 @@ void WsfTSPI_Mover::TranslateAndRotateToNewFile()
 
    TransformPoints(points, fullTransform);
 
+   if (mArchivePtr != nullptr)
+   {
+      // The archive is shared, so replay the moved points from memory rather than rewriting anything.
+      mMovedRecords.resize(points.size());
+      for (size_t i = 0; i < points.size(); ++i)
+      {
+         WsfTSPI_Archive::ToRecord(points[i].mMovedTSPI, mMovedRecords[i]);
+      }
+      mRecords    = WsfTSPI_Archive::Trajectory(mMovedRecords.data(), mMovedRecords.size());
+      mNextRecord = 0;
+      ReadNextTSPI();
+      mCurrentTSPI    = mReadTSPI;
+      mTSPI_StartTime = mCurrentTSPI.mTime();
+      return;
+   }
+
    // Write a new TSPI file to replace the old one:
    // Must use the platform index to assure the file name is unique.
    // string outName("./temp_out.txt"); // Old Name
@@ -551,8 +634,7 @@ void WsfTSPI_Mover::TranslateLocation()
 // private
 void WsfTSPI_Mover::ReadTSPI()
 {
-   *mInputStreamPtr >> mReadTSPI;
-   mEOF = mInputStreamPtr->eof();
+   mEOF = !ReadNextTSPI();
    if (!mEOF)
    {
       mLastTSPI    = mCurrentTSPI;
@@ -573,8 +655,7 @@ void WsfTSPI_Mover::ReadTSPI()
 // private
 bool WsfTSPI_Mover::Fetch_TSPI()
 {
-   *mInputStreamPtr >> mReadTSPI;
-   if (!mInputStreamPtr->eof())
+   if (ReadNextTSPI())
    {
       mLastTSPI    = mCurrentTSPI;
       mCurrentTSPI = mReadTSPI;
@@ -583,6 +664,47 @@ bool WsfTSPI_Mover::Fetch_TSPI()
    return false;
 }
 
+//-------------------------------------------------------------------------------------------------
+//! Read the next record into mReadTSPI, from either the archive trajectory or the text file.
+//! @returns false if the end of the data has been reached.
+// private
+bool WsfTSPI_Mover::ReadNextTSPI()
+{
+   if (mRecords.GetRecords() != nullptr)
+   {
+      if (mNextRecord >= mRecords.GetRecordCount())
+      {
+         return false;
+      }
+      WsfTSPI_Archive::ToTSPI(mRecords.GetRecord(mNextRecord), mReadTSPI);
+      ++mNextRecord;
+      return true;
+   }
+   *mInputStreamPtr >> mReadTSPI;
+   return !mInputStreamPtr->eof();
+}
+
+//-------------------------------------------------------------------------------------------------
+//! Skip over the archive records that Update would read and immediately discard in reaching aSimTime.
+//! The last two records before aSimTime are left to be read by Update, so the mover state is the same
+//! as if every record had been read.
+// private
+void WsfTSPI_Mover::SeekTSPI(double aSimTime)
+{
+   // The update time of a record is computed as in ReadTSPI.
+   auto isBefore = [this, aSimTime](const WsfTSPI_Archive::Record& aRecord)
+   { return (mStartTime + (aRecord.mTime - mTSPI_StartTime)) < aSimTime; };
+
+   const WsfTSPI_Archive::Record* recordsPtr = mRecords.GetRecords();
+   const WsfTSPI_Archive::Record* firstPtr =
+      std::partition_point(recordsPtr + mNextRecord, recordsPtr + mRecords.GetRecordCount(), isBefore);
+   size_t index = static_cast<size_t>(firstPtr - recordsPtr);
+   if (index > (mNextRecord + 2))
+   {
+      mNextRecord = index - 2;
+   }
+}
+
 //-------------------------------------------------------------------------------------------------
 // Implementation of the base class method.
 void WsfTSPI_Mover::Update(double aSimTime)
@@ -592,6 +714,10 @@ void WsfTSPI_Mover::Update(double aSimTime)
    if (mIsInitialized)
    {
       // Schedule the next update
+      if ((mRecords.GetRecords() != nullptr) && (mCurrentUpdateTime < aSimTime) && (!mEOF))
+      {
+         SeekTSPI(aSimTime);
+      }
       while ((mCurrentUpdateTime < aSimTime) && (!mEOF))
       {
          ReadTSPI();
@@ -789,6 +915,33 @@ void WsfTSPI_Mover::OpenFile(const std::string& aFileName)
    }
 }
 
+//-------------------------------------------------------------------------------------------------
+//! Open the TSPI archive and find the trajectory of the mover.
+//! This will throw an OpenError exception if the archive cannot be opened or does not contain the trajectory.
+void WsfTSPI_Mover::OpenArchive()
+{
+   std::string trajectoryName = mTrajectoryName.empty() ? GetPlatform()->GetName() : mTrajectoryName;
+
+   mArchivePtr = WsfTSPI_Archive::Open(mArchiveName);
+   if (mArchivePtr == nullptr)
+   {
+      auto out = ut::log::error() << "Cannot open TSPI archive.";
+      out.AddNote() << "File: " << mArchiveName;
+      throw OpenError();
+   }
+   const WsfTSPI_Archive::Trajectory* trajectoryPtr = mArchivePtr->FindTrajectory(trajectoryName);
+   if (trajectoryPtr == nullptr)
+   {
+      auto out = ut::log::error() << "TSPI archive does not contain the trajectory.";
+      out.AddNote() << "File: " << mArchiveName;
+      out.AddNote() << "Trajectory: " << trajectoryName;
+      throw OpenError();
+   }
+   mRecords    = *trajectoryPtr;
+   mNextRecord = 0;
+   GetScenario().GetSystemLog().WriteLogEntry("file " + mArchiveName);
+}
+
 //-------------------------------------------------------------------------------------------------
 // virtual
 void WsfTSPI_Mover::TriggerExtrapolation()
@@ -831,11 +984,16 @@ WsfTSPI_Mover::TSPI_Model::TSPI_Model(double               aSimTime,
    , mTSPI_StartTime(aTSPI_StartTime)
    , mPoints()
 {
-   // Open the TSPi file and tabulate all points:
-   std::string   filePath = aTSPI_MoverPtr->FileName();
-   std::ifstream inputStream{filePath};
+   // Open the TSPi file (or use the archive records) and tabulate all points:
+   const WsfTSPI_Archive::Trajectory& records    = aTSPI_MoverPtr->mRecords;
+   bool                               useArchive = (records.GetRecords() != nullptr);
+   std::ifstream                      inputStream;
+   if (!useArchive)
+   {
+      inputStream.open(aTSPI_MoverPtr->FileName());
+   }
 
-   if (inputStream.good())
+   if (useArchive || inputStream.good())
    {
       double apogeeTime          = 0.0;
       double apogeeRadiusSquared = 0.0;
@@ -844,10 +1002,19 @@ WsfTSPI_Mover::TSPI_Model::TSPI_Model(double               aSimTime,
       double thisLocSpher[3];
 
       WsfTSPI tspiPoint;
+      size_t  recordIndex = 0;
 
-      while (!inputStream.eof())
+      while (useArchive ? (recordIndex < records.GetRecordCount()) : (!inputStream.eof()))
       {
-         inputStream >> tspiPoint;
+         if (useArchive)
+         {
+            WsfTSPI_Archive::ToTSPI(records.GetRecord(recordIndex), tspiPoint);
+            ++recordIndex;
+         }
+         else
+         {
+            inputStream >> tspiPoint;
+         }
          thisTime            = tspiPoint.mTime();
          double thisEllipAlt = tspiPoint.mAlt();
          UtEntity::ConvertLLAToWCS(tspiPoint.mLat.Get(), tspiPoint.mLon.Get(), thisEllipAlt, thisLocWCS);
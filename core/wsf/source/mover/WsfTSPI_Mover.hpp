@@ -18,7 +18,9 @@
 #include "wsf_export.h"
 
 #include <iosfwd>
+#include <memory>
 #include <string>
+#include <vector>
 
 class UtInput;
 #include "UtOptional.hpp"
@@ -28,9 +30,13 @@ class WsfDraw;
 #include "WsfEvent.hpp"
 #include "WsfMover.hpp"
 #include "WsfTSPI.hpp"
+#include "WsfTSPI_Archive.hpp"
 
 //! WsfTSPI_Mover is a specialization of WsfMover that updates position based on
 //! data from a file (see WsfTSPI for details.)
+//!
+//! The data may be read from a text file or from a trajectory in a binary TSPI archive (see WsfTSPI_Archive).
+//! Archives are shared by all the movers that use them, and the records are accessed in place.
 
 class WSF_EXPORT WsfTSPI_Mover : public WsfMover
 {
@@ -65,10 +71,12 @@ public:
    bool InitializeMover(double aSimTime);
    void CloseFile();
    void OpenFile(const std::string& aFileName);
+   void OpenArchive();
 
    double      SimStartTime() const { return mStartTime; }
    double      TSPI_StartTime() const { return mTSPI_StartTime; }
    std::string FileName() const { return mFileName; }
+   std::string ArchiveName() const { return mArchiveName; }
 
    bool SetFileName(const std::string& aName);
    void SetStartAtInitialTime(bool aValue) { mStartAtInitialTime = aValue; }
@@ -160,10 +168,15 @@ public:
                                                   WsfDraw*     aDrawPtr) const override;
 
 protected:
+   WsfTSPI_Mover(const WsfTSPI_Mover& aSrc);
+   WsfTSPI_Mover& operator=(const WsfTSPI_Mover&) = delete;
+
    void UpdateMover(double aSimTime);
 
 private:
    void ReadTSPI();
+   bool ReadNextTSPI();
+   void SeekTSPI(double aSimTime);
    void TranslateLocation();
 
    bool ProcessInputRelocateAndRotate(UtInput& aInput);
@@ -197,6 +210,13 @@ private:
    WsfTSPI mReadTSPI;
 
    PathMovement mMovement;
+
+   std::string                            mArchiveName;    //!< The TSPI archive, if used rather than a text file.
+   std::string                            mTrajectoryName; //!< The archive trajectory (default: the platform name).
+   std::shared_ptr<const WsfTSPI_Archive> mArchivePtr;     //!< The shared archive reader.
+   WsfTSPI_Archive::Trajectory            mRecords;        //!< The archive trajectory, or mMovedRecords if relocated.
+   std::vector<WsfTSPI_Archive::Record>   mMovedRecords;   //!< The relocated and rotated archive records.
+   size_t                                 mNextRecord;     //!< The index of the next record to be read from mRecords.
 };
 
 #endif
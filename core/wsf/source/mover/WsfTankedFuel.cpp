@@ -23,6 +23,7 @@
 #include "WsfFuelObserver.hpp"
 #include "WsfMover.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfPlatformPart.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfStringId.hpp"
@@ -878,6 +879,12 @@ bool WsfTankedFuel::DisconnectFrom(double aSimTime, WsfPlatform* aPlatformPtr)
 }
 
 // virtual
+//! Any platform may be a receiver, so the tank must be told about the deletion of every platform.
+void WsfTankedFuel::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllDeletedPlatforms();
+}
+
 void WsfTankedFuel::PlatformDeleted(WsfPlatform* aPlatformPtr)
 {
    // Find out if we are Supplying to this platform...
@@ -47,6 +47,7 @@ public:
 
    void Update(double aSimTime) override;
 
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void PlatformDeleted(WsfPlatform* aPlatformPtr) override;
 
    //! Boolean accessor indicating that this tank is currently supplying fuel to
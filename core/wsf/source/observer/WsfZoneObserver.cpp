@@ -15,3 +15,5 @@
 
 WSF_OBSERVER_CALLBACK_DEFINE(Zone, ZoneFillColorChanged)
 WSF_OBSERVER_CALLBACK_DEFINE(Zone, ZoneLineColorChanged)
+WSF_OBSERVER_CALLBACK_DEFINE(Zone, ZoneEntered)
+WSF_OBSERVER_CALLBACK_DEFINE(Zone, ZoneExited)
@@ -15,16 +15,22 @@
 #include "wsf_export.h"
 
 #include "UtCallback.hpp"
+#include "UtVec3.hpp"
 #include "WsfZone.hpp"
+class WsfPlatform;
 class WsfSimulation;
 
 namespace WsfObserver
 {
 using ZoneFillColorChangedCallback = UtCallbackListN<void(const WsfZone&)>;
 using ZoneLineColorChangedCallback = UtCallbackListN<void(const WsfZone&)>;
+using ZoneEnteredCallback          = UtCallbackListN<void(double, WsfPlatform*, WsfZone*, double, const UtVec3d&)>;
+using ZoneExitedCallback           = UtCallbackListN<void(double, WsfPlatform*, WsfZone*, double, const UtVec3d&)>;
 
 WSF_EXPORT ZoneFillColorChangedCallback& ZoneFillColorChanged(const WsfSimulation* aSimulation);
 WSF_EXPORT ZoneLineColorChangedCallback& ZoneLineColorChanged(const WsfSimulation* aSimulation);
+WSF_EXPORT ZoneEnteredCallback&          ZoneEntered(const WsfSimulation* aSimulation);
+WSF_EXPORT ZoneExitedCallback&           ZoneExited(const WsfSimulation* aSimulation);
 } // namespace WsfObserver
 
 //! The implementation of the Zone observer objects.
@@ -36,6 +42,24 @@ struct WSF_EXPORT WsfZoneObserver
 
    //! Provide a callback to query the zone line color whenever it is changed.
    WsfObserver::ZoneLineColorChangedCallback ZoneLineColorChanged;
+
+   //! A platform has entered a zone monitored by the zone_monitor.
+   //! @param aSimTime             The time of the mover update that detected the crossing.
+   //! @param aPlatformPtr         The platform.
+   //! @param aZonePtr             The zone.
+   //! @param aCrossingTime        The estimated time at which the platform crossed the zone boundary.
+   //! @param aCrossingLocationWCS The estimated location at which the platform crossed the zone boundary.
+   //! @note The crossing is detected at the mover update that follows it, so aCrossingTime is not later than aSimTime.
+   WsfObserver::ZoneEnteredCallback ZoneEntered;
+
+   //! A platform has exited a zone monitored by the zone_monitor.
+   //! @param aSimTime             The time of the mover update that detected the crossing.
+   //! @param aPlatformPtr         The platform.
+   //! @param aZonePtr             The zone.
+   //! @param aCrossingTime        The estimated time at which the platform crossed the zone boundary.
+   //! @param aCrossingLocationWCS The estimated location at which the platform crossed the zone boundary.
+   //! @note See ZoneEntered.
+   WsfObserver::ZoneExitedCallback ZoneExited;
 };
 
 #endif
@@ -21,6 +21,7 @@
 #include "WsfAttributeContainer.hpp"
 #include "WsfExchangeObserver.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSimulation.hpp"
 #include "script/WsfScriptContext.hpp"
 #include "script/WsfScriptDefs.hpp"
@@ -323,6 +324,13 @@ void WsfExchangeProcessor::ExchangeCompleted(double                         aSim
    }
 }
 
+// ============================================================================
+//! Transactions may be conducted with any platform, so the deletion of every platform must be reported.
+void WsfExchangeProcessor::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllDeletedPlatforms();
+}
+
 // ============================================================================
 void WsfExchangeProcessor::PlatformDeleted(WsfPlatform* aPlatformPtr)
 {
@@ -57,6 +57,7 @@ public:
    bool IgnoreAllProximityChecks() const { return mIgnoreProxChecks; }
    bool ForceTransactionsInstantaneous() const { return mAllTransAreInstant; }
 
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void PlatformDeleted(WsfPlatform* aPlatformPtr) override;
 
    // ====================== Container Accessors =========================
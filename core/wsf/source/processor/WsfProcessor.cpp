@@ -120,6 +120,12 @@ bool WsfProcessor::Initialize2(double aSimTime)
 // virtual
 void WsfProcessor::Update(double /* aSimTime */) {}
 
+// ================================================================================================
+//! A processor is not told about other platforms unless a derived class declares an interest in them.
+//! @note A derived class that overrides PlatformAdded or PlatformDeleted must also override this method.
+// virtual
+void WsfProcessor::AddPlatformInterest(WsfPlatformInterest& /* aInterest */) const {}
+
 // ============================================================================
 // See WsfComponent::PreInput about this.
 void WsfProcessor::PreInput()
@@ -69,6 +69,7 @@ public:
    void          PreInput() override;
    bool          ProcessInput(UtInput& aInput) override;
    void          Update(double aSimTime) override;
+   void          AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    //@}
 
    //! @name Status methods.
@@ -20,6 +20,7 @@
 #include "UtScriptClassDefine.hpp"
 #include "UtScriptTypes.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfScenario.hpp"
 #include "WsfSensor.hpp"
 #include "WsfSimulation.hpp"
@@ -121,6 +122,16 @@ bool WsfSensorProcessor::ProcessInput(UtInput& aInput)
    return myCommand;
 }
 
+// =================================================================================================
+//! The processor is interested in the platforms that own its sensors.
+void WsfSensorProcessor::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   for (const auto& sensor : mSensors)
+   {
+      aInterest.AddPlatformName(sensor.first);
+   }
+}
+
 // =================================================================================================
 void WsfSensorProcessor::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 {
@@ -165,6 +176,10 @@ bool WsfSensorProcessor::AddSensor(WsfStringId aPlatformNameId, WsfStringId aSen
    if (find(mSensors.begin(), mSensors.end(), pltfrmSnsrId) == mSensors.end())
    {
       mSensors.push_back(pltfrmSnsrId);
+      if (GetPlatform()->GetIndex() != 0)
+      {
+         GetSimulation()->PlatformInterestChanged(*GetPlatform());
+      }
    }
 
    // Check to see if the platform and sensor are valid and add sensor
@@ -45,6 +45,7 @@ public:
    WsfProcessor* Clone() const override = 0;
    bool          Initialize(double aSimTime) override;
    bool          ProcessInput(UtInput& aInput) override;
+   void          AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void          PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) override;
    void          PlatformDeleted(WsfPlatform* aPlatformPtr) override;
    //@}
@@ -31,6 +31,7 @@
 #include "WsfLocalTrack.hpp"
 #include "WsfMessage.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfPlatformObserver.hpp"
 #include "WsfPlatformPart.hpp"
 #include "WsfProcessorObserver.hpp"
@@ -161,8 +162,10 @@ WsfTaskManager::WsfTaskManager(WsfScenario& aScenario, const std::string& aClass
    , mScenarioPtr(&aScenario)
    , mCallbacks()
    , mXmtdTaskList()
+   , mXmtdTaskIndex()
    , mPurgedXmtdTaskList()
    , mRcvdTaskList()
+   , mRcvdTaskIndex()
    , mPurgedRcvdTaskList()
    , mPendingRcvdTasks()
    , mTrackProcessorName()
@@ -210,8 +213,10 @@ WsfTaskManager::WsfTaskManager(const WsfTaskManager& aSrc)
    , mScenarioPtr(aSrc.mScenarioPtr)
    , mCallbacks()
    , mXmtdTaskList()
+   , mXmtdTaskIndex()
    , mPurgedXmtdTaskList()
    , mRcvdTaskList()
+   , mRcvdTaskIndex()
    , mPurgedRcvdTaskList()
    , mPendingRcvdTasks()
    , mTrackProcessorName(aSrc.mTrackProcessorName)
@@ -435,6 +440,14 @@ bool WsfTaskManager::ProcessInput(UtInput& aInput)
    return myCommand;
 }
 
+// =================================================================================================
+//! Tasks may be assigned to or received from any platform, so the deletion of every platform must be reported.
+// virtual
+void WsfTaskManager::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllDeletedPlatforms();
+}
+
 // =================================================================================================
 // virtual
 void WsfTaskManager::PlatformDeleted(WsfPlatform* aPlatformPtr)
@@ -448,21 +461,21 @@ void WsfTaskManager::PlatformDeleted(WsfPlatform* aPlatformPtr)
    // NOTE: This process of canceling is somewhat naive in that is doesn't consider task dependencies.
    // A task that doesn't get canceled may be relying on the task that did get canceled.
 
-   auto xtli = mXmtdTaskList.begin();
-   while (xtli != mXmtdTaskList.end())
+   std::vector<const WsfTask*> assignedTasks;
+   mXmtdTaskIndex.TasksForAssignee(aPlatformPtr->GetIndex(), assignedTasks);
+   for (const WsfTask* taskPtr : assignedTasks)
    {
-      if (xtli->GetAssigneePlatformIndex() == aPlatformPtr->GetIndex())
+      // A callback from a previous cancellation may have already removed the task.
+      auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, taskPtr);
+      if ((xtli != mXmtdTaskList.end()) && (xtli->GetAssigneePlatformIndex() == aPlatformPtr->GetIndex()))
       {
          // NOTE - In order to avoid problems in callbacks, the task is removed from the transmitted task
          //        list before proceeding. A temporary list is used to store the task before deletion.
+         mXmtdTaskIndex.Erase(*xtli);
          TaskList removedTaskList;
-         removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli++);
+         removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli);
          CancelTask(GetSimulation()->GetSimTime(), removedTaskList.front(), false);
       }
-      else
-      {
-         ++xtli;
-      }
    }
 
    // Check components
@@ -680,8 +693,11 @@ bool WsfTaskManager::AssignTask(double aSimTime, const WsfTrack& aTrack, const W
 
    // Create a transmitted task list entry if one doesn't already exist.
    // If one already exists then we just reuse it.
-   auto xtli =
-      FindTask(mXmtdTaskList, assigneePtr->GetIndex(), aTrack.GetTrackId(), aTask.GetTaskType(), aTask.GetResourceName());
+   auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList,
+                                   assigneePtr->GetIndex(),
+                                   aTrack.GetTrackId(),
+                                   aTask.GetTaskType(),
+                                   aTask.GetResourceName());
    if (xtli == mXmtdTaskList.end())
    {
       // Create the transmitted task list entry.
@@ -711,6 +727,7 @@ bool WsfTaskManager::AssignTask(double aSimTime, const WsfTrack& aTrack, const W
 
       mXmtdTaskList.push_front(task);
       xtli = mXmtdTaskList.begin();
+      mXmtdTaskIndex.Insert(xtli);
 
       // Lock the local track use count to prevent it from getting purged by the track manager.
       if (aLockTrack && !aTrack.GetTrackId().IsNull())
@@ -728,6 +745,7 @@ bool WsfTaskManager::AssignTask(double aSimTime, const WsfTrack& aTrack, const W
       task.SetCommName(commName);
       // overwrite the task in our transmitted list (update all the task data)
       *xtli = task;
+      mXmtdTaskIndex.Update(*xtli);
    }
 
    // Send the assignment message to the assignee.
@@ -900,9 +918,12 @@ bool WsfTaskManager::ReleaseResource(double aSimTime, WsfTask& aTask)
          // sensor. This makes book-keeping easy for them - but harder for us. We must make sure we don't
          // stop the sensor request if there is still other tasks assigned.
 
-         bool haveOtherTasks = false;
-         for (const WsfTask& task : mRcvdTaskList)
+         bool                        haveOtherTasks = false;
+         std::vector<const WsfTask*> trackTasks;
+         mRcvdTaskIndex.TasksForTrack(aTask.GetTrackId(), trackTasks);
+         for (const WsfTask* taskPtr : trackTasks)
          {
+            const WsfTask& task = *taskPtr;
             if (aTask.GetTaskId() != task.GetTaskId()) // Not the same task
             {
                if ((task.GetTrackId() == aTask.GetTrackId()) && (task.GetResourceType() == cTASK_RESOURCE_TYPE_SENSOR) &&
@@ -1106,7 +1127,7 @@ bool WsfTaskManager::DropFromPurgedTaskList(TaskList& aPurgedTaskList, size_t aA
 // virtual
 bool WsfTaskManager::CancelTask(double aSimTime, unsigned int aTaskId)
 {
-   auto iter = FindTask(mXmtdTaskList, aTaskId);
+   auto iter = mXmtdTaskIndex.Find(mXmtdTaskList, aTaskId);
    if (iter != mXmtdTaskList.end())
    {
       CancelTask(aSimTime, *iter, true);
@@ -1184,11 +1205,19 @@ bool WsfTaskManager::CancelTask(double                 aSimTime,
                                 const WsfTaskResource& aResource,
                                 size_t                 aAssigneeIndex)
 {
+   std::vector<const WsfTask*> candidates;
+   SelectAssignedTasks(aTrackId, aAssigneeIndex, candidates);
+
    // Find and cancel the selected tasks.
    bool taskCanceled = false;
-   auto xtli         = mXmtdTaskList.begin();
-   while (xtli != mXmtdTaskList.end())
+   for (const WsfTask* taskPtr : candidates)
    {
+      // A callback from a previous cancellation may have already removed the task.
+      auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, taskPtr);
+      if (xtli == mXmtdTaskList.end())
+      {
+         continue;
+      }
       WsfTask& task              = *xtli;
       bool     trackIdCheck      = (aTrackId == task.GetTrackId());
       bool     localTrackIdCheck = (aTrackId == task.GetLocalTrackId());
@@ -1200,16 +1229,13 @@ bool WsfTaskManager::CancelTask(double                 aSimTime,
          // NOTE - In order to avoid problems in callbacks, the task is removed from the transmitted task list before
          // proceeding.
          //        A temporary list is used to store the task before deletion.
+         mXmtdTaskIndex.Erase(task);
          TaskList removedTaskList;
-         removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli++);
+         removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli);
 
          CancelTask(aSimTime, removedTaskList.front(), true);
          taskCanceled = true;
       }
-      else
-      {
-         ++xtli;
-      }
    }
    return taskCanceled;
 }
@@ -1229,8 +1255,8 @@ bool WsfTaskManager::CreateDelayTask(double aSimTime, double aDelayTime, const W
    WsfStringId       resourceName;
 
    // Make sure a task with the same id/type/resource does not exist on either the sent or received task list.
-   auto xtli = FindTask(mXmtdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
-   auto rtli = FindTask(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
+   auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
+   auto rtli = mRcvdTaskIndex.Find(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
    if ((xtli != mXmtdTaskList.end()) || (rtli != mRcvdTaskList.end()))
    {
       return false;
@@ -1242,7 +1268,7 @@ bool WsfTaskManager::CreateDelayTask(double aSimTime, double aDelayTime, const W
    }
 
    // Schedule the event to complete the task at the required time.
-   xtli = FindTask(mXmtdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
+   xtli = mXmtdTaskIndex.Find(mXmtdTaskList, GetPlatform()->GetIndex(), trackId, aTaskType, resourceName);
    GetSimulation()->AddEvent(ut::make_unique<DelayCompleteEvent>(aSimTime + aDelayTime, this, *xtli));
    return true;
 }
@@ -1293,11 +1319,12 @@ bool WsfTaskManager::ReportTaskComplete(double            aSimTime,
    }
 
    bool ok   = true;
-   auto rtli = FindTask(mRcvdTaskList, GetPlatform()->GetIndex(), aTrackId, aTaskType, aResourceName);
+   auto rtli = mRcvdTaskIndex.Find(mRcvdTaskList, GetPlatform()->GetIndex(), aTrackId, aTaskType, aResourceName);
    if (rtli != mRcvdTaskList.end())
    {
       // NOTE - In order to avoid problems in callbacks, the task is removed from the received task list before proceeding.
       //        splice() is used to move the task to the front of mPurgedRcvdTaskList without deletion.
+      mRcvdTaskIndex.Erase(*rtli);
       mPurgedRcvdTaskList.splice(mPurgedRcvdTaskList.begin(), mRcvdTaskList, rtli);
       WsfTask& taskRef = mPurgedRcvdTaskList.front();
       if (mShowTaskMessages)
@@ -1367,7 +1394,7 @@ bool WsfTaskManager::ReportTaskProgress(double            aSimTime,
                                         WsfStringId       aSubStatus)
 {
    bool ok   = true;
-   auto rtli = FindTask(mRcvdTaskList, GetPlatform()->GetIndex(), aTrackId, aTaskType, aResourceName);
+   auto rtli = mRcvdTaskIndex.Find(mRcvdTaskList, GetPlatform()->GetIndex(), aTrackId, aTaskType, aResourceName);
    if (rtli != mRcvdTaskList.end())
    {
       WsfTask& task = *rtli;
@@ -1407,6 +1434,36 @@ bool WsfTaskManager::ReportTaskProgress(double            aSimTime,
    return ok;
 }
 
+// =================================================================================================
+//! Select the candidate transmitted tasks for a query, in transmitted task list order.
+//! The most selective index for the supplied criteria is used. The caller must still apply the complete
+//! selection criteria to the returned tasks.
+//! @param aTrackId       The track ID of interest. If null then the track ID is not a selection criteria.
+//! @param aAssigneeIndex The assignee platform index. If zero then the assignee is not a selection criteria.
+//! @param aTasks         [output] The candidate tasks.
+// private
+void WsfTaskManager::SelectAssignedTasks(const WsfTrackId&            aTrackId,
+                                         size_t                       aAssigneeIndex,
+                                         std::vector<const WsfTask*>& aTasks) const
+{
+   aTasks.clear();
+   if (!aTrackId.IsNull())
+   {
+      mXmtdTaskIndex.TasksForTrack(aTrackId, aTasks);
+   }
+   else if (aAssigneeIndex != 0)
+   {
+      mXmtdTaskIndex.TasksForAssignee(aAssigneeIndex, aTasks);
+   }
+   else
+   {
+      for (const WsfTask& task : mXmtdTaskList)
+      {
+         aTasks.push_back(&task);
+      }
+   }
+}
+
 // =================================================================================================
 //! Return the list of platform (indexes) of the assignees for the specified task.
 //! @param aTrackId   The local track ID of the track of interest.
@@ -1417,8 +1474,11 @@ bool WsfTaskManager::ReportTaskProgress(double            aSimTime,
 void WsfTaskManager::AssigneesForTask(const WsfTrackId& aTrackId, WsfStringId aTaskType, std::vector<size_t>& aAssignees) const
 {
    aAssignees.clear();
-   for (const WsfTask& task : mXmtdTaskList)
+   std::vector<const WsfTask*> tasks;
+   SelectAssignedTasks(aTrackId, 0, tasks);
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((aTrackId.IsNull() || (aTrackId == task.GetLocalTrackId())) &&
           ((aTaskType == nullptr) || (aTaskType == task.GetTaskType())))
       {
@@ -1439,9 +1499,12 @@ void WsfTaskManager::AssigneesForTask(const WsfTrackId& aTrackId, WsfStringId aT
 //! @returns The platform index of the assignee, which can be zero.
 size_t WsfTaskManager::AssigneeForTask(const WsfTrackId& aTrackId, WsfStringId aTaskType, WsfStringId aResourceName) const
 {
-   size_t assigneeIndex = 0;
-   for (const WsfTask& task : mXmtdTaskList)
+   size_t                      assigneeIndex = 0;
+   std::vector<const WsfTask*> tasks;
+   SelectAssignedTasks(aTrackId, 0, tasks);
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((aTrackId == task.GetLocalTrackId()) && (aTaskType == task.GetTaskType()) &&
           (aResourceName == task.GetResourceName()))
       {
@@ -1487,9 +1550,12 @@ int WsfTaskManager::TasksAssignedTo(size_t            aAssigneeIndex,
       assigneeIndex = GetPlatform()->GetIndex();
    }
 
-   int taskCount = 0;
-   for (const WsfTask& task : mXmtdTaskList)
+   int                         taskCount = 0;
+   std::vector<const WsfTask*> tasks;
+   SelectAssignedTasks(aTrackId, assigneeIndex, tasks);
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((assigneeIndex == task.GetAssigneePlatformIndex()) &&
           ((aTrackId.IsNull()) || (aTrackId == task.GetLocalTrackId())) &&
           ((aTaskType == nullptr) || (aTaskType == task.GetTaskType())) &&
@@ -1512,9 +1578,12 @@ int WsfTaskManager::TasksAssignedTo(size_t            aAssigneeIndex,
 // virtual
 int WsfTaskManager::TasksAssignedFor(const WsfTrackId& aTrackId, WsfStringId aTaskType, WsfStringId aResourceName) const
 {
-   int taskCount = 0;
-   for (const WsfTask& task : mXmtdTaskList)
+   int                         taskCount = 0;
+   std::vector<const WsfTask*> tasks;
+   SelectAssignedTasks(aTrackId, 0, tasks);
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((aTrackId.IsNull() || (aTrackId == task.GetLocalTrackId())) &&
           ((aTaskType == nullptr) || (aTaskType == task.GetTaskType())) &&
           ((aResourceName == nullptr) || (aResourceName == task.GetResourceName())))
@@ -1535,9 +1604,23 @@ int WsfTaskManager::TasksAssignedFor(const WsfTrackId& aTrackId, WsfStringId aTa
 //! @returns The number of tasks that have been received.
 int WsfTaskManager::TasksReceivedFor(const WsfTrackId& aTrackId, WsfStringId aTaskType, WsfStringId aResourceName) const
 {
+   std::vector<const WsfTask*> tasks;
+   if (!aTrackId.IsNull())
+   {
+      mRcvdTaskIndex.TasksForTrack(aTrackId, tasks);
+   }
+   else
+   {
+      for (const WsfTask& task : mRcvdTaskList)
+      {
+         tasks.push_back(&task);
+      }
+   }
+
    int taskCount = 0;
-   for (const WsfTask& task : mRcvdTaskList)
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((aTrackId.IsNull() || (aTrackId == task.GetLocalTrackId())) &&
           ((aTaskType == nullptr) || (aTaskType == task.GetTaskType())) &&
           ((aResourceName == nullptr) || (aResourceName == task.GetResourceName())))
@@ -1552,9 +1635,12 @@ int WsfTaskManager::TasksReceivedFor(const WsfTrackId& aTrackId, WsfStringId aTa
 //! Return the simulation time when a task was assigned.
 double WsfTaskManager::TimeTaskAssigned(const WsfTrackId& aTrackId, WsfStringId aTaskType, size_t aAssigneeIndex) const
 {
-   double timeAssigned = -1.0;
-   for (const WsfTask& task : mXmtdTaskList)
+   double                      timeAssigned = -1.0;
+   std::vector<const WsfTask*> tasks;
+   SelectAssignedTasks(aTrackId, aAssigneeIndex, tasks);
+   for (const WsfTask* taskPtr : tasks)
    {
+      const WsfTask& task = *taskPtr;
       if ((aAssigneeIndex == task.GetAssigneePlatformIndex()) && (aTrackId == task.GetLocalTrackId()) &&
           (aTaskType == task.GetTaskType()))
 
@@ -1613,6 +1699,200 @@ WsfTaskManager::TaskList::iterator WsfTaskManager::FindTask(TaskList& aTaskList,
                        { return task.GetTaskId() == aTaskId && task.GetAssigneePlatformIndex() == aAssigneeIndex; });
 }
 
+// =================================================================================================
+// private static
+template<class MAP>
+void WsfTaskManager::TaskIndex::EraseEntry(MAP& aMap, const typename MAP::key_type& aKey, const WsfTask* aTaskPtr)
+{
+   auto range = aMap.equal_range(aKey);
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      if (&(*it->second) == aTaskPtr)
+      {
+         aMap.erase(it);
+         break;
+      }
+   }
+}
+
+// =================================================================================================
+//! Collect the tasks with the specified key and sort them into list order.
+//! Tasks are always added to the front of the list, so list order is descending insertion sequence.
+// private
+template<class MAP>
+void WsfTaskManager::TaskIndex::Collect(const MAP&                    aMap,
+                                        const typename MAP::key_type& aKey,
+                                        std::vector<const WsfTask*>&  aTasks) const
+{
+   aTasks.clear();
+   auto range = aMap.equal_range(aKey);
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      aTasks.push_back(&(*it->second));
+   }
+   if (aTasks.size() > 1)
+   {
+      std::sort(aTasks.begin(),
+                aTasks.end(),
+                [this](const WsfTask* aLhsPtr, const WsfTask* aRhsPtr)
+                { return mKeys.at(aLhsPtr).mSequence > mKeys.at(aRhsPtr).mSequence; });
+   }
+}
+
+// =================================================================================================
+//! Add a task to the index.
+//! @param aIter The iterator of the task in the task list. It must have just been added to the front of the list.
+void WsfTaskManager::TaskIndex::Insert(TaskList::iterator aIter)
+{
+   Insert(aIter, ++mNextSequence);
+}
+
+// =================================================================================================
+// private
+void WsfTaskManager::TaskIndex::Insert(TaskList::iterator aIter, unsigned int aSequence)
+{
+   const WsfTask& task = *aIter;
+   Keys&          keys = mKeys[&task];
+   keys.mIter          = aIter;
+   keys.mSequence      = aSequence;
+   keys.mTaskId        = task.GetTaskId();
+   keys.mAssigneeIndex = task.GetAssigneePlatformIndex();
+   keys.mTrackId       = task.GetTrackId();
+   keys.mLocalTrackId  = task.GetLocalTrackId();
+
+   mByTaskId.emplace(keys.mTaskId, aIter);
+   mByAssignee.emplace(keys.mAssigneeIndex, aIter);
+   mByTrackId.emplace(keys.mTrackId, aIter);
+   // The local track ID is indexed only if it differs so a task appears at most once for a given key.
+   if ((!keys.mLocalTrackId.IsNull()) && (keys.mLocalTrackId != keys.mTrackId))
+   {
+      mByTrackId.emplace(keys.mLocalTrackId, aIter);
+   }
+}
+
+// =================================================================================================
+//! Remove a task from the index.
+//! This must be called before the task is removed (erased or spliced) from the indexed list.
+//! It is not an error if the task is not in the index.
+void WsfTaskManager::TaskIndex::Erase(const WsfTask& aTask)
+{
+   auto ki = mKeys.find(&aTask);
+   if (ki != mKeys.end())
+   {
+      const Keys& keys = ki->second;
+      EraseEntry(mByTaskId, keys.mTaskId, &aTask);
+      EraseEntry(mByAssignee, keys.mAssigneeIndex, &aTask);
+      EraseEntry(mByTrackId, keys.mTrackId, &aTask);
+      if ((!keys.mLocalTrackId.IsNull()) && (keys.mLocalTrackId != keys.mTrackId))
+      {
+         EraseEntry(mByTrackId, keys.mLocalTrackId, &aTask);
+      }
+      mKeys.erase(ki);
+   }
+}
+
+// =================================================================================================
+//! Re-index a task whose keys (i.e.: its contents) have changed while it remained in the list.
+//! The position of the task in the list order is retained.
+void WsfTaskManager::TaskIndex::Update(const WsfTask& aTask)
+{
+   auto ki = mKeys.find(&aTask);
+   if (ki != mKeys.end())
+   {
+      TaskList::iterator iter     = ki->second.mIter;
+      unsigned int       sequence = ki->second.mSequence;
+      Erase(aTask);
+      Insert(iter, sequence);
+   }
+}
+
+// =================================================================================================
+void WsfTaskManager::TaskIndex::Clear()
+{
+   mKeys.clear();
+   mByTaskId.clear();
+   mByTrackId.clear();
+   mByAssignee.clear();
+}
+
+// =================================================================================================
+//! Return the list iterator of a task that was previously returned by one of the query methods.
+//! @returns An iterator for the task or aTaskList.end() if the task is no longer in the index.
+//! @note The task pointer is used only as a key and is not dereferenced, so it may refer to a task that
+//! has since been removed.
+WsfTaskManager::TaskList::iterator WsfTaskManager::TaskIndex::Find(TaskList& aTaskList, const WsfTask* aTaskPtr) const
+{
+   auto ki = mKeys.find(aTaskPtr);
+   return (ki != mKeys.end()) ? ki->second.mIter : aTaskList.end();
+}
+
+// =================================================================================================
+//! Find the first task (in list order) with the specified task ID.
+//! @returns An iterator for the located task or aTaskList.end() if the task could not be found.
+WsfTaskManager::TaskList::iterator WsfTaskManager::TaskIndex::Find(TaskList& aTaskList, unsigned int aTaskId) const
+{
+   std::vector<const WsfTask*> tasks;
+   Collect(mByTaskId, aTaskId, tasks);
+   return tasks.empty() ? aTaskList.end() : mKeys.at(tasks.front()).mIter;
+}
+
+// =================================================================================================
+//! Find the first task (in list order) with the specified task ID and assignee.
+//! @returns An iterator for the located task or aTaskList.end() if the task could not be found.
+WsfTaskManager::TaskList::iterator WsfTaskManager::TaskIndex::Find(TaskList&    aTaskList,
+                                                                   unsigned int aTaskId,
+                                                                   size_t       aAssigneeIndex) const
+{
+   std::vector<const WsfTask*> tasks;
+   Collect(mByTaskId, aTaskId, tasks);
+   for (const WsfTask* taskPtr : tasks)
+   {
+      if (taskPtr->GetAssigneePlatformIndex() == aAssigneeIndex)
+      {
+         return mKeys.at(taskPtr).mIter;
+      }
+   }
+   return aTaskList.end();
+}
+
+// =================================================================================================
+//! Find the first task (in list order) that matches the selection criteria.
+//! The selection criteria are the same as those of the static WsfTaskManager::FindTask.
+//! @returns An iterator for the located task or aTaskList.end() if the task could not be found.
+WsfTaskManager::TaskList::iterator WsfTaskManager::TaskIndex::Find(TaskList&         aTaskList,
+                                                                   size_t            aAssigneeIndex,
+                                                                   const WsfTrackId& aTrackId,
+                                                                   WsfStringId       aTaskType,
+                                                                   WsfStringId       aResourceName) const
+{
+   std::vector<const WsfTask*> tasks;
+   Collect(mByTrackId, aTrackId, tasks);
+   for (const WsfTask* taskPtr : tasks)
+   {
+      if ((aAssigneeIndex == taskPtr->GetAssigneePlatformIndex()) && (aTaskType == taskPtr->GetTaskType()) &&
+          (aResourceName == taskPtr->GetResourceName()) &&
+          ((aTrackId == taskPtr->GetTrackId()) || (aTrackId == taskPtr->GetLocalTrackId())))
+      {
+         return mKeys.at(taskPtr).mIter;
+      }
+   }
+   return aTaskList.end();
+}
+
+// =================================================================================================
+//! Return the tasks whose task or local track ID is the specified track ID, in list order.
+void WsfTaskManager::TaskIndex::TasksForTrack(const WsfTrackId& aTrackId, std::vector<const WsfTask*>& aTasks) const
+{
+   Collect(mByTrackId, aTrackId, aTasks);
+}
+
+// =================================================================================================
+//! Return the tasks assigned to the specified platform, in list order.
+void WsfTaskManager::TaskIndex::TasksForAssignee(size_t aAssigneeIndex, std::vector<const WsfTask*>& aTasks) const
+{
+   Collect(mByAssignee, aAssigneeIndex, aTasks);
+}
+
 // =================================================================================================
 //! Given a message, get the platform index of the sender and the local device on which the message was received.
 // private
@@ -1723,16 +2003,17 @@ void WsfTaskManager::CheckMessageAcknowledged(double aSimTime, unsigned int aSer
          {
             WsfTaskAssignMessage* messagePtr = dynamic_cast<WsfTaskAssignMessage*>(pendingMessage.mMessagePtr);
             WsfTask&              task       = messagePtr->GetTask();
-            auto                  xtli       = FindTask(mXmtdTaskList,
-                                 task.GetAssigneePlatformIndex(),
-                                 task.GetTrackId(),
-                                 task.GetTaskType(),
-                                 task.GetResourceName());
+            auto                  xtli       = mXmtdTaskIndex.Find(mXmtdTaskList,
+                                                task.GetAssigneePlatformIndex(),
+                                                task.GetTrackId(),
+                                                task.GetTaskType(),
+                                                task.GetResourceName());
             if (xtli != mXmtdTaskList.end())
             {
                // NOTE - In order to avoid problems in callbacks, a copy of the task must be made and
                // the original removed from the list before proceeding.
                WsfTask taskCopy = *xtli;
+               mXmtdTaskIndex.Erase(*xtli);
                mXmtdTaskList.erase(xtli);
                CancelTask(aSimTime, taskCopy, false);
             }
@@ -1754,39 +2035,36 @@ void WsfTaskManager::CheckMessageAcknowledged(double aSimTime, unsigned int aSer
 double WsfTaskManager::SendTrackUpdate(double aSimTime, unsigned int aTaskId)
 {
    double nextUpdateTime = -1.0;
-   for (TaskList::const_iterator xtli = mXmtdTaskList.begin(); xtli != mXmtdTaskList.end(); ++xtli)
+   auto   xtli           = mXmtdTaskIndex.Find(mXmtdTaskList, aTaskId);
+   if (xtli != mXmtdTaskList.end())
    {
-      const WsfTask& task = *xtli;
-      if (aTaskId == task.GetTaskId())
+      const WsfTask&  task     = *xtli;
+      const WsfTrack* trackPtr = mTrackManagerPtr->FindTrack(task.GetLocalTrackId());
+      if (trackPtr != nullptr)
       {
-         const WsfTrack* trackPtr = mTrackManagerPtr->FindTrack(task.GetLocalTrackId());
-         if (trackPtr != nullptr)
+         if (!trackPtr->IsStale())
          {
-            if (!trackPtr->IsStale())
+            if (DebugEnabled())
             {
-               if (DebugEnabled())
-               {
-                  auto out = ut::log::debug() << "Sent track update to assignee.";
-                  out.AddNote() << "T = " << aSimTime;
-                  out.AddNote() << "Platform: " << GetPlatform()->GetName();
-                  out.AddNote() << "Task Manager: " << GetName();
-                  out.AddNote() << "Assignee: " << task.GetAssigneePlatformName();
-                  out.AddNote() << "Target: " << trackPtr->GetTargetName();
-                  out.AddNote() << "Track ID: " << trackPtr->GetTrackId();
-               }
-               WsfTrackMessage message(GetPlatform(), *trackPtr);
-               if (SendTaskMessage(aSimTime, message, task.GetAssigneePlatformIndex(), task.GetCommName(), false))
-               {
-                  nextUpdateTime = aSimTime + mTrackUpdateInterval;
-               }
+               auto out = ut::log::debug() << "Sent track update to assignee.";
+               out.AddNote() << "T = " << aSimTime;
+               out.AddNote() << "Platform: " << GetPlatform()->GetName();
+               out.AddNote() << "Task Manager: " << GetName();
+               out.AddNote() << "Assignee: " << task.GetAssigneePlatformName();
+               out.AddNote() << "Target: " << trackPtr->GetTargetName();
+               out.AddNote() << "Track ID: " << trackPtr->GetTrackId();
             }
-            else
+            WsfTrackMessage message(GetPlatform(), *trackPtr);
+            if (SendTaskMessage(aSimTime, message, task.GetAssigneePlatformIndex(), task.GetCommName(), false))
             {
-               // If the track is stale we still reschedule the event as it may receive an update at a later time.
                nextUpdateTime = aSimTime + mTrackUpdateInterval;
             }
          }
-         break;
+         else
+         {
+            // If the track is stale we still reschedule the event as it may receive an update at a later time.
+            nextUpdateTime = aSimTime + mTrackUpdateInterval;
+         }
       }
    }
    return nextUpdateTime;
@@ -2087,7 +2365,7 @@ bool WsfTaskManager::ProcessTaskAssignMessage(double aSimTime, const WsfTaskAssi
       //
       // NOTE: This must be done before any object spawning because there are some callbacks that update the data.
 
-      auto rtli = FindTask(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, taskType, resourceName);
+      auto rtli = mRcvdTaskIndex.Find(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, taskType, resourceName);
       if (rtli == mRcvdTaskList.end())
       {
          // Create the task from the assignment.
@@ -2095,6 +2373,7 @@ bool WsfTaskManager::ProcessTaskAssignMessage(double aSimTime, const WsfTaskAssi
          task.SetCommName(commName);
          mRcvdTaskList.push_front(task);
          rtli = mRcvdTaskList.begin();
+         mRcvdTaskIndex.Insert(rtli);
       }
       else
       {
@@ -2102,6 +2381,7 @@ bool WsfTaskManager::ProcessTaskAssignMessage(double aSimTime, const WsfTaskAssi
          WsfTask task(aMessage.GetTask());
          task.SetCommName(commName);
          *rtli = task;
+         mRcvdTaskIndex.Update(*rtli);
       }
 
       // Enter the track into the local track list.
@@ -2118,6 +2398,7 @@ bool WsfTaskManager::ProcessTaskAssignMessage(double aSimTime, const WsfTaskAssi
          {
             // Task is self-assigned. The track ID should be the local track ID.
             task.SetLocalTrackId(track.GetTrackId());
+            mRcvdTaskIndex.Update(task);
             TaskCorrelated(aSimTime, task);
          }
          else
@@ -2165,6 +2446,7 @@ bool WsfTaskManager::ProcessTaskAssignMessage(double aSimTime, const WsfTaskAssi
       {
          // NOTE - In order to avoid problems in callbacks, the task is removed from the received task list before proceeding.
          //        A temporary list is used to store the task before deletion.
+         mRcvdTaskIndex.Erase(task);
          TaskList removedTaskList;
          removedTaskList.splice(removedTaskList.end(), mRcvdTaskList, rtli);
 
@@ -2197,12 +2479,13 @@ bool WsfTaskManager::ProcessTaskCancelMessage(double aSimTime, const WsfTaskCanc
 
    // Find and purge the task from the local task list.
 
-   auto rtli = FindTask(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, taskType, resourceName);
+   auto rtli = mRcvdTaskIndex.Find(mRcvdTaskList, GetPlatform()->GetIndex(), trackId, taskType, resourceName);
    if (rtli != mRcvdTaskList.end())
    {
       WsfTask& task = *rtli;
       // NOTE - In order to avoid problems in callbacks, the task is removed from the received task list before proceeding.
       //        A temporary list is used to store the task before deletion.
+      mRcvdTaskIndex.Erase(task);
       TaskList removedTaskList;
       removedTaskList.splice(removedTaskList.end(), mRcvdTaskList, rtli);
 
@@ -2297,7 +2580,7 @@ bool WsfTaskManager::ProcessTaskStatusMessage(double aSimTime, const WsfTaskStat
 
       // Find the task that was sent to the assignee
 
-      auto xtli = FindTask(mXmtdTaskList, assigneeIndex, trackId, taskType, resourceName);
+      auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, assigneeIndex, trackId, taskType, resourceName);
       if (xtli == mXmtdTaskList.end())
       {
          bool showWarning = true;
@@ -2349,6 +2632,7 @@ bool WsfTaskManager::ProcessTaskStatusMessage(double aSimTime, const WsfTaskStat
             // NOTE - In order to avoid problems in callbacks, the task is removed from the transmitted task list before
             // proceeding.
             //        A temporary list is used to store the task before deletion.
+            mXmtdTaskIndex.Erase(task);
             TaskList removedTaskList;
             removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli);
 
@@ -2362,9 +2646,10 @@ bool WsfTaskManager::ProcessTaskStatusMessage(double aSimTime, const WsfTaskStat
    }
    else if (statusId == mScenarioPtr->Strings().cACKNOWLEDGE_CANCEL)
    {
-      auto iter = FindTask(mXmtdTaskList, taskId);
+      auto iter = mXmtdTaskIndex.Find(mXmtdTaskList, taskId);
       if (iter != mXmtdTaskList.end())
       {
+         mXmtdTaskIndex.Erase(*iter);
          mXmtdTaskList.erase(iter);
       }
       DropFromPurgedTaskList(mPurgedXmtdTaskList, assignerIndex, taskId);
@@ -2414,8 +2699,11 @@ bool WsfTaskManager::ProcessTrackDropMessage(double aSimTime, const WsfTrackDrop
          }
 
          // If we've received a tracking task for this track then we must report the task complete.
-         for (WsfTask& task : mRcvdTaskList)
+         std::vector<const WsfTask*> trackTasks;
+         mRcvdTaskIndex.TasksForTrack(atli->mTaskTrackId, trackTasks);
+         for (const WsfTask* taskPtr : trackTasks)
          {
+            const WsfTask& task = *taskPtr;
             if ((atli->mSensorName == task.GetResourceName()) && (atli->mTaskTrackId == task.GetLocalTrackId()))
             {
                ReportTaskComplete(aSimTime,
@@ -2463,23 +2751,23 @@ void WsfTaskManager::PurgeReceivedTask(double aSimTime, WsfTask& aTask)
       // Potentially remove the task from the pending received task list.
       mPendingRcvdTasks.erase(aTask.GetTrackId());
 
-      auto xtli = mXmtdTaskList.begin();
-      while (xtli != mXmtdTaskList.end())
+      std::vector<const WsfTask*> trackTasks;
+      mXmtdTaskIndex.TasksForTrack(aTask.GetTrackId(), trackTasks);
+      for (const WsfTask* taskPtr : trackTasks)
       {
-         if (aTask.GetTrackId() == (*xtli).GetTrackId())
+         // A callback from a previous cancellation may have already removed the task.
+         auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, taskPtr);
+         if ((xtli != mXmtdTaskList.end()) && (aTask.GetTrackId() == (*xtli).GetTrackId()))
          {
             // NOTE - In order to avoid problems in callbacks, the task is removed from the transmitted task list before
             // proceeding.
             //        A temporary list is used to store the task before deletion.
+            mXmtdTaskIndex.Erase(*xtli);
             TaskList removedTaskList;
-            removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli++);
+            removedTaskList.splice(removedTaskList.end(), mXmtdTaskList, xtli);
 
             CancelTask(aSimTime, removedTaskList.front(), false);
          }
-         else
-         {
-            ++xtli;
-         }
       }
    }
 
@@ -2686,6 +2974,7 @@ void WsfTaskManager::UpdateTaskCorrelation(double aSimTime, WsfTask& aTask)
    if (trackPtr != nullptr)
    {
       aTask.SetLocalTrackId(trackPtr->GetTrackId());
+      mRcvdTaskIndex.Update(aTask);
       // Lock the track to prevent it from being purged by the track manager.
       mTrackManagerPtr->LockTrack(aSimTime, trackPtr->GetTrackId());
       mPendingRcvdTasks.erase(aTask.GetTrackId());
@@ -2727,12 +3016,15 @@ void WsfTaskManager::LocalTrackDropped(double aSimTime, const WsfLocalTrack* aLo
    // If I have been assigned a task that is associated with this track then inform the assigner that
    // we're no longer doing anything.
 
-   bool reportSent = true;
+   bool                        reportSent = true;
+   std::vector<const WsfTask*> trackTasks;
    while (reportSent)
    {
       reportSent = false;
-      for (WsfTask& task : mRcvdTaskList)
+      mRcvdTaskIndex.TasksForTrack(aLocalTrackPtr->GetTrackId(), trackTasks);
+      for (const WsfTask* taskPtr : trackTasks)
       {
+         const WsfTask& task = *taskPtr;
          if (task.GetLocalTrackId() == aLocalTrackPtr->GetTrackId())
          {
             reportSent = true;
@@ -2773,8 +3065,16 @@ void WsfTaskManager::LocalTrackUpdated(double aSimTime, const WsfLocalTrack* aLo
    // If the track has been assigned to an off-board asset then determine if an update should be sent.
    if (mTrackUpdateStrategy == cBATCH)
    {
-      for (WsfTask& task : mXmtdTaskList)
+      std::vector<const WsfTask*> trackTasks;
+      mXmtdTaskIndex.TasksForTrack(aLocalTrackPtr->GetTrackId(), trackTasks);
+      for (const WsfTask* taskPtr : trackTasks)
       {
+         auto xtli = mXmtdTaskIndex.Find(mXmtdTaskList, taskPtr);
+         if (xtli == mXmtdTaskList.end())
+         {
+            continue;
+         }
+         WsfTask& task = *xtli;
          if ((task.GetLocalTrackId() == aLocalTrackPtr->GetTrackId()) &&
              ((aSimTime - task.GetUpdateTime()) > mTrackUpdateInterval) &&
              (task.GetAssigneePlatformIndex() != GetPlatform()->GetIndex()))
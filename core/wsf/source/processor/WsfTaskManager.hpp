@@ -19,6 +19,8 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "UtCallback.hpp"
 #include "UtCallbackHolder.hpp"
@@ -108,6 +110,63 @@ public:
 
    using TaskList = std::list<WsfTask>;
 
+   //! Secondary indexes over a TaskList.
+   //! The list continues to own the tasks and defines their order. The index holds iterators into the list
+   //! keyed by task ID, track ID (both the task and local track ID) and assignee index so the query methods
+   //! don't have to scan the entire list. The keys under which a task was indexed are remembered so a task
+   //! can always be removed, even if its contents were changed after it was inserted.
+   //! @note Entries must be added to the front of the list (which is how the task manager adds them) so
+   //! that the insertion sequence can be used to return results in list order.
+   class WSF_EXPORT TaskIndex
+   {
+   public:
+      void Insert(TaskList::iterator aIter);
+      void Erase(const WsfTask& aTask);
+      void Update(const WsfTask& aTask);
+      void Clear();
+
+      TaskList::iterator Find(TaskList& aTaskList, const WsfTask* aTaskPtr) const;
+      TaskList::iterator Find(TaskList& aTaskList, unsigned int aTaskId) const;
+      TaskList::iterator Find(TaskList& aTaskList, unsigned int aTaskId, size_t aAssigneeIndex) const;
+      TaskList::iterator Find(TaskList&         aTaskList,
+                              size_t            aAssigneeIndex,
+                              const WsfTrackId& aTrackId,
+                              WsfStringId       aTaskType,
+                              WsfStringId       aResourceName) const;
+
+      void TasksForTrack(const WsfTrackId& aTrackId, std::vector<const WsfTask*>& aTasks) const;
+      void TasksForAssignee(size_t aAssigneeIndex, std::vector<const WsfTask*>& aTasks) const;
+
+   private:
+      struct Keys
+      {
+         TaskList::iterator mIter;
+         unsigned int       mSequence;
+         unsigned int       mTaskId;
+         size_t             mAssigneeIndex;
+         WsfTrackId         mTrackId;
+         WsfTrackId         mLocalTrackId;
+      };
+
+      using TaskIdMap   = std::unordered_multimap<unsigned int, TaskList::iterator>;
+      using TrackIdMap  = std::unordered_multimap<WsfTrackId, TaskList::iterator, WsfTrackId>;
+      using AssigneeMap = std::unordered_multimap<size_t, TaskList::iterator>;
+
+      void Insert(TaskList::iterator aIter, unsigned int aSequence);
+
+      template<class MAP>
+      static void EraseEntry(MAP& aMap, const typename MAP::key_type& aKey, const WsfTask* aTaskPtr);
+
+      template<class MAP>
+      void Collect(const MAP& aMap, const typename MAP::key_type& aKey, std::vector<const WsfTask*>& aTasks) const;
+
+      std::unordered_map<const WsfTask*, Keys> mKeys;
+      TaskIdMap                                mByTaskId;
+      TrackIdMap                               mByTrackId;
+      AssigneeMap                              mByAssignee;
+      unsigned int                             mNextSequence{0};
+   };
+
    //! Messages that have been sent but are waiting for a receipt.
    //! An entry is made into the 'pending message list' whenever a message must be sent 'reliably'.
    //! The transmission of a reliable message will be (re)attempted until either an acknowledgment
@@ -181,6 +240,7 @@ public:
    bool Initialize2(double aSimTime) override;
    bool ProcessInput(UtInput& aInput) override;
 
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void PlatformDeleted(WsfPlatform* aPlatformPtr) override;
    bool ProcessMessage(double aSimTime, const WsfMessage& aMessage) override;
    bool ReceiveMessage(double aSimTime, const WsfMessage& aMessage) override;
@@ -243,9 +303,11 @@ public:
    double TimeTaskAssigned(const WsfTrackId& aTrackId, WsfStringId aTaskType, size_t aAssigneeIndex) const;
 
    //! Return the list of tasks this TaskManager has assigned.
+   //! @note Tasks must not be added to or removed from the list through this reference as the list is indexed.
    TaskList& AssignedTaskList() { return mXmtdTaskList; }
 
    //! Return the list of tasks this TaskManager has received.
+   //! @note Tasks must not be added to or removed from the list through this reference as the list is indexed.
    TaskList& ReceivedTaskList() { return mRcvdTaskList; }
 
    static TaskList::iterator FindTask(TaskList&         aTaskList,
@@ -429,6 +491,9 @@ protected:
    //! Tasks I have sent to others.
    TaskList mXmtdTaskList;
 
+   //! Index over mXmtdTaskList. It must be updated whenever an entry is added to or removed from the list.
+   TaskIndex mXmtdTaskIndex;
+
    //! A list of transmitted tasks that have recently been canceled.
    //! An entry remains in this list until one of the following:
    //! - We receive a task completion message for the same task. This generally occurs if the assignee
@@ -439,6 +504,10 @@ protected:
    //! Tasks I have received from others.
    TaskList mRcvdTaskList;
 
+   //! Index over mRcvdTaskList. It must be updated whenever an entry is added to or removed from the list,
+   //! or when the local track ID of a received task is changed.
+   TaskIndex mRcvdTaskIndex;
+
    //! A list of received tasks that have been reported as completed.
    //! An entry remains in this list until one of the following:
    //! - We receive acknowledgment of the task completion we sent.
@@ -488,6 +557,8 @@ private:
 
    virtual void PurgeTransmittedTask(double aSimTime, WsfTask& aTask);
 
+   void SelectAssignedTasks(const WsfTrackId& aTrackId, size_t aAssigneeIndex, std::vector<const WsfTask*>& aTasks) const;
+
    void UpdatePendingReceivedTasks(double aSimTime, const WsfLocalTrack* aLocalTrackPtr);
 
    void UpdateSensorRequestList(double            aSimTime,
@@ -43,6 +43,7 @@
 #include "WsfTaskObserver.hpp"
 #include "WsfTrack.hpp"
 #include "WsfTrackObserver.hpp"
+#include "WsfZoneObserver.hpp"
 #include "script/WsfScriptContext.hpp"
 
 namespace
@@ -332,6 +333,16 @@ void TankingEventPacker(UtScriptDataPacker& aScriptArgs, WsfFuelingOperation* aF
                << aEventNameId;
 }
 
+// ============================================================================
+void ZonePacker(UtScriptDataPacker& aScriptArgs,
+                WsfPlatform*        aPlatformPtr,
+                WsfZone*            aZonePtr,
+                double /*aCrossingTime*/,
+                const UtVec3d& /*aCrossingLocationWCS*/)
+{
+   aScriptArgs << aPlatformPtr << aZonePtr;
+}
+
 } // namespace
 
 // ****************************************************************************
@@ -619,6 +630,16 @@ void WsfScriptObserver::AddedToSimulation()
    AddEvent("TASK_CANCELED", WsfObserver::TaskCanceled(&GetSimulation()), "TaskCanceled", "WsfTask");
    AddEvent("TASK_COMPLETED", WsfObserver::TaskCompleted(&GetSimulation()), "TaskCompleted", "WsfTask, string");
    AddEvent("TEAM_NAME_DEFINITION", WsfObserver::PlatformAdded(&GetSimulation()), "TeamNameDefinition", "WsfPlatform");
+   AddEvent("ZONE_ENTERED",
+            WsfObserver::ZoneEntered(&GetSimulation()),
+            "ZoneEntered",
+            "WsfPlatform, WsfZone",
+            UtStd::Bind(&ZonePacker));
+   AddEvent("ZONE_EXITED",
+            WsfObserver::ZoneExited(&GetSimulation()),
+            "ZoneExited",
+            "WsfPlatform, WsfZone",
+            UtStd::Bind(&ZonePacker));
 }
 
 // ============================================================================
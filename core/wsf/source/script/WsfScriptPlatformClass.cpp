@@ -51,6 +51,7 @@
 #include "WsfNavigationErrors.hpp"
 #include "WsfPathFinder.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformSpatialIndex.hpp"
 #include "WsfPlatformTypes.hpp"
 #include "WsfProcessor.hpp"
 #include "WsfRoadMover.hpp"
@@ -248,6 +249,10 @@ void ResetLocation(WsfPlatform* aPlatformPtr, double aSimTime)
    {
       moverPtr->ResetPosition(aSimTime);
    }
+   if (aPlatformPtr->GetSimulation() != nullptr)
+   {
+      WsfPlatformSpatialIndex::Get(*aPlatformPtr->GetSimulation()).PlatformMoved(*aPlatformPtr);
+   }
 }
 
 //! GoToWaypoint helper method
@@ -284,6 +289,37 @@ bool GoToWaypoint(double aSimTime, WsfMover* aRouteMvrPtr, std::string aRouteAct
    }
    return success;
 }
+
+//! Create a script array of the platforms within a given range of a platform, sorted by increasing range.
+//! An empty side or category matches every platform.
+void PlatformsWithin(UtScriptContext&   aContext,
+                     UtScriptClass*     aReturnClassPtr,
+                     UtScriptData&      aReturnVal,
+                     WsfPlatform*       aThisPtr,
+                     double             aRange,
+                     const std::string& aSide,
+                     const std::string& aCategory)
+{
+   double thisLocWCS[3];
+   aThisPtr->GetLocationWCS(thisLocWCS);
+   std::vector<WsfPlatformSpatialIndex::Result> results;
+   WsfPlatformSpatialIndex::Get(*aThisPtr->GetSimulation()).PlatformsWithin(thisLocWCS, aRange, results);
+
+   WsfStringId                sideId(aSide);
+   WsfStringId                categoryId(aCategory);
+   UtScriptClass*             classPtr = aContext.GetTypes()->GetClass(aReturnClassPtr->GetContainerDataTypeId());
+   std::vector<UtScriptData>* arrayPtr = new std::vector<UtScriptData>();
+   for (const auto& result : results)
+   {
+      WsfPlatform* platformPtr = result.second;
+      if ((platformPtr != aThisPtr) && ((!sideId) || (platformPtr->GetSideId() == sideId)) &&
+          ((!categoryId) || platformPtr->IsCategoryMember(categoryId)))
+      {
+         arrayPtr->push_back(UtScriptData(new UtScriptRef(platformPtr, classPtr)));
+      }
+   }
+   aReturnVal.SetPointer(new UtScriptRef(arrayPtr, aReturnClassPtr, UtScriptRef::cMANAGE));
+}
 } // namespace
 
 WsfScriptPlatformClass::WsfScriptPlatformClass(const std::string& aClassName, UtScriptTypes* aTypesPtr)
@@ -573,6 +609,9 @@ WsfScriptPlatformClass::WsfScriptPlatformClass(const std::string& aClassName, Ut
    AddMethod(ut::make_unique<ClosestApproachOf_1>("ClosestApproachOf"));     // ClosestApproachOf(WsfTrack)
    AddMethod(ut::make_unique<ClosestApproachOf_2>("ClosestApproachOf"));     // ClosestApproachOf(WsfPlatform)
    AddMethod(ut::make_unique<HeadingDifferenceOf_1>("HeadingDifferenceOf")); // HeadingDifferenceOf(WsfTrack)
+   AddMethod(ut::make_unique<PlatformsWithin_1>("PlatformsWithin"));         // PlatformsWithin(double)
+   AddMethod(ut::make_unique<PlatformsWithin_2>("PlatformsWithin"));         // PlatformsWithin(double, string, string)
+   AddMethod(ut::make_unique<TracksWithin>());                               // TracksWithin(double)
    AddMethod(ut::make_unique<HeadingDifferenceOf_2>("HeadingDifferenceOf")); // HeadingDifferenceOf(WsfPlatform)
    AddMethod(ut::make_unique<ClosingSpeedOf_1>("ClosingSpeedOf"));           // ClosingSpeedOf(WsfTrack)
    AddMethod(ut::make_unique<ClosingSpeedOf_2>("ClosingSpeedOf"));           // ClosingSpeedOf(WsfPlatform)
@@ -2116,6 +2155,10 @@ UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass, WsfPlatform, SetLocationECI, 1,
 {
    UtVec3d* vec3Ptr = (UtVec3d*)aVarArgs[0].GetPointer()->GetAppObject();
    aObjectPtr->SetLocationECI(vec3Ptr->GetData());
+   if (aObjectPtr->GetSimulation() != nullptr)
+   {
+      WsfPlatformSpatialIndex::Get(*aObjectPtr->GetSimulation()).PlatformMoved(*aObjectPtr);
+   }
 }
 
 //! Returns a GeoPoint with the location of the platform.
@@ -4055,6 +4098,73 @@ UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass, WsfPlatform, ClosestApproachOf_2
    aReturnVal.SetPointer(new UtScriptRef(gpPtr, aReturnClassPtr, UtScriptRef::cMANAGE));
 }
 
+//! Array<WsfPlatform> platforms = PlatformsWithin(double aRange);
+UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass, WsfPlatform, PlatformsWithin_1, 1, "Array<WsfPlatform>", "double")
+{
+   double simTime = TIME_NOW;
+   aObjectPtr->Update(simTime); // Ensure source platform position is current
+   PlatformsWithin(aContext, aReturnClassPtr, aReturnVal, aObjectPtr, aVarArgs[0].GetDouble(), "", "");
+}
+
+//! Array<WsfPlatform> platforms = PlatformsWithin(double aRange, string aSide, string aCategory);
+UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass,
+                        WsfPlatform,
+                        PlatformsWithin_2,
+                        3,
+                        "Array<WsfPlatform>",
+                        "double, string, string")
+{
+   double simTime = TIME_NOW;
+   aObjectPtr->Update(simTime); // Ensure source platform position is current
+   PlatformsWithin(aContext,
+                   aReturnClassPtr,
+                   aReturnVal,
+                   aObjectPtr,
+                   aVarArgs[0].GetDouble(),
+                   aVarArgs[1].GetString(),
+                   aVarArgs[2].GetString());
+}
+
+//! Array<WsfLocalTrack> tracks = TracksWithin(double aRange);
+//! Returns the master track list tracks whose extrapolated location is within the range, sorted by increasing range.
+UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass, WsfPlatform, TracksWithin, 1, "Array<WsfLocalTrack>", "double")
+{
+   double simTime = TIME_NOW;
+   aObjectPtr->Update(simTime); // Ensure source platform position is current
+   double thisLocWCS[3];
+   aObjectPtr->GetLocationWCS(thisLocWCS);
+   double rangeSquared = aVarArgs[0].GetDouble() * aVarArgs[0].GetDouble();
+
+   std::vector<std::pair<double, WsfLocalTrack*>> tracks;
+   WsfLocalTrackList&                             trackList = aObjectPtr->GetMasterTrackList();
+   for (unsigned int i = 0; i < trackList.GetTrackCount(); ++i)
+   {
+      WsfLocalTrack* trackPtr = trackList.GetTrackEntry(i);
+      double         trackLocWCS[3];
+      if (trackPtr->GetExtrapolatedLocationWCS(simTime, trackLocWCS))
+      {
+         UtVec3d::Subtract(trackLocWCS, trackLocWCS, thisLocWCS);
+         double trackRangeSquared = UtVec3d::MagnitudeSquared(trackLocWCS);
+         if (trackRangeSquared <= rangeSquared)
+         {
+            tracks.emplace_back(trackRangeSquared, trackPtr);
+         }
+      }
+   }
+   std::sort(tracks.begin(),
+             tracks.end(),
+             [](const std::pair<double, WsfLocalTrack*>& aLhs, const std::pair<double, WsfLocalTrack*>& aRhs)
+             { return aLhs.first < aRhs.first; });
+
+   UtScriptClass*             classPtr = aContext.GetTypes()->GetClass(aReturnClassPtr->GetContainerDataTypeId());
+   std::vector<UtScriptData>* arrayPtr = new std::vector<UtScriptData>();
+   for (const auto& track : tracks)
+   {
+      arrayPtr->push_back(UtScriptData(new UtScriptRef(track.second, classPtr)));
+   }
+   aReturnVal.SetPointer(new UtScriptRef(arrayPtr, aReturnClassPtr, UtScriptRef::cMANAGE));
+}
+
 //! double headingDifference = HeadingDifferenceOf(WsfTrack aTrack);
 UT_DEFINE_SCRIPT_METHOD(WsfScriptPlatformClass, WsfPlatform, HeadingDifferenceOf_1, 1, "double", "WsfTrack")
 {
@@ -318,6 +318,9 @@ public:
    UT_DECLARE_SCRIPT_METHOD(ClosestApproachOf_1);   // ClosestApproachOf(WsfTrack)
    UT_DECLARE_SCRIPT_METHOD(ClosestApproachOf_2);   // ClosestApproachOf(WsfPlatform)
    UT_DECLARE_SCRIPT_METHOD(HeadingDifferenceOf_1); // HeadingDifferenceOf(WsfTrack)
+   UT_DECLARE_SCRIPT_METHOD(PlatformsWithin_1);     // PlatformsWithin(double)
+   UT_DECLARE_SCRIPT_METHOD(PlatformsWithin_2);     // PlatformsWithin(double, string, string)
+   UT_DECLARE_SCRIPT_METHOD(TracksWithin);          // TracksWithin(double)
    UT_DECLARE_SCRIPT_METHOD(HeadingDifferenceOf_2); // HeadingDifferenceOf(WsfPlatform)
    UT_DECLARE_SCRIPT_METHOD(ClosingSpeedOf_1);      // ClosingSpeedOf(WsfTrack)
    UT_DECLARE_SCRIPT_METHOD(ClosingSpeedOf_2);      // ClosingSpeedOf(WsfPlatform)
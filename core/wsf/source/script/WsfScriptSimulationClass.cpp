@@ -25,6 +25,7 @@
 #include "WsfGroup.hpp"
 #include "WsfGroupManager.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformSpatialIndex.hpp"
 #include "WsfScenario.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfWaypoint.hpp"
@@ -81,6 +82,9 @@ WsfScriptSimulationClass::WsfScriptSimulationClass(const std::string& aClassName
    AddStaticMethod(ut::make_unique<ClassificationString>());
    AddStaticMethod(ut::make_unique<ClassificationColor>());
    AddStaticMethod(ut::make_unique<Name>());
+
+   AddStaticMethod(ut::make_unique<PlatformsWithin_1>("PlatformsWithin")); // PlatformsWithin(WsfGeoPoint, double)
+   AddStaticMethod(ut::make_unique<PlatformsWithin_2>("PlatformsWithin")); // (WsfGeoPoint, double, string, string)
 }
 
 // =================================================================================================
@@ -237,6 +241,62 @@ UT_DEFINE_SCRIPT_METHOD(WsfScriptSimulationClass, WsfSimulation, PlatformType, 1
    aReturnVal.SetString(SIMULATION->GetPlatformTypeId(aVarArgs[0].GetInt()));
 }
 
+// =================================================================================================
+//! Array<WsfPlatform> platforms = PlatformsWithin(WsfGeoPoint aPoint, double aRange);
+UT_DEFINE_SCRIPT_METHOD(WsfScriptSimulationClass,
+                        WsfSimulation,
+                        PlatformsWithin_1,
+                        2,
+                        "Array<WsfPlatform>",
+                        "WsfGeoPoint, double")
+{
+   WsfGeoPoint* pointPtr = static_cast<WsfGeoPoint*>(aVarArgs[0].GetPointer()->GetAppObject());
+   double       locWCS[3];
+   pointPtr->GetLocationWCS(locWCS);
+   std::vector<WsfPlatformSpatialIndex::Result> results;
+   WsfPlatformSpatialIndex::Get(*SIMULATION).PlatformsWithin(locWCS, aVarArgs[1].GetDouble(), results);
+
+   UtScriptClass*             classPtr = aContext.GetTypes()->GetClass(aReturnClassPtr->GetContainerDataTypeId());
+   std::vector<UtScriptData>* arrayPtr = new std::vector<UtScriptData>();
+   for (const auto& result : results)
+   {
+      arrayPtr->push_back(UtScriptData(new UtScriptRef(result.second, classPtr)));
+   }
+   aReturnVal.SetPointer(new UtScriptRef(arrayPtr, aReturnClassPtr, UtScriptRef::cMANAGE));
+}
+
+// =================================================================================================
+//! Array<WsfPlatform> platforms = PlatformsWithin(WsfGeoPoint aPoint, double aRange, string aSide, string aCategory);
+//! An empty side or category matches every platform.
+UT_DEFINE_SCRIPT_METHOD(WsfScriptSimulationClass,
+                        WsfSimulation,
+                        PlatformsWithin_2,
+                        4,
+                        "Array<WsfPlatform>",
+                        "WsfGeoPoint, double, string, string")
+{
+   WsfGeoPoint* pointPtr = static_cast<WsfGeoPoint*>(aVarArgs[0].GetPointer()->GetAppObject());
+   double       locWCS[3];
+   pointPtr->GetLocationWCS(locWCS);
+   std::vector<WsfPlatformSpatialIndex::Result> results;
+   WsfPlatformSpatialIndex::Get(*SIMULATION).PlatformsWithin(locWCS, aVarArgs[1].GetDouble(), results);
+
+   WsfStringId                sideId(aVarArgs[2].GetString());
+   WsfStringId                categoryId(aVarArgs[3].GetString());
+   UtScriptClass*             classPtr = aContext.GetTypes()->GetClass(aReturnClassPtr->GetContainerDataTypeId());
+   std::vector<UtScriptData>* arrayPtr = new std::vector<UtScriptData>();
+   for (const auto& result : results)
+   {
+      WsfPlatform* platformPtr = result.second;
+      if (((!sideId) || (platformPtr->GetSideId() == sideId)) &&
+          ((!categoryId) || platformPtr->IsCategoryMember(categoryId)))
+      {
+         arrayPtr->push_back(UtScriptData(new UtScriptRef(platformPtr, classPtr)));
+      }
+   }
+   aReturnVal.SetPointer(new UtScriptRef(arrayPtr, aReturnClassPtr, UtScriptRef::cMANAGE));
+}
+
 // =================================================================================================
 // Current random seed
 UT_DEFINE_SCRIPT_METHOD(WsfScriptSimulationClass, WsfSimulation, RandomSeed, 0, "int", "")
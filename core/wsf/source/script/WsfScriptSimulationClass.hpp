@@ -30,26 +30,28 @@ public:
 
    // Simulation management methods
 
-   UT_DECLARE_SCRIPT_METHOD(ClockRate);        // Get the simulation clock rate (for realtime)
-   UT_DECLARE_SCRIPT_METHOD(SetClockRate);     // Set the simulation clock rate (for realtime)
-   UT_DECLARE_SCRIPT_METHOD(IsRealtime);       // See if simulation is running in realtime mode
-   UT_DECLARE_SCRIPT_METHOD(PlatformCount);    // Get the number of platforms in the platform list
-   UT_DECLARE_SCRIPT_METHOD(PlatformEntry);    // Get the active platform entry
-   UT_DECLARE_SCRIPT_METHOD(FindPlatform_1);   // FindPlatform(string)
-   UT_DECLARE_SCRIPT_METHOD(FindPlatform_2);   // FindPlatform(index)
-   UT_DECLARE_SCRIPT_METHOD(AddPlatform);      // AddPlatform(WsfPlatform)
-   UT_DECLARE_SCRIPT_METHOD(CreatePlatform);   // CreatePlatform(string, string)
-   UT_DECLARE_SCRIPT_METHOD(DeletePlatform_1); // DeletePlatform(string)
-   UT_DECLARE_SCRIPT_METHOD(DeletePlatform_2); // DeletePlatform(index)
-   UT_DECLARE_SCRIPT_METHOD(PlatformName);     // PlatformName(index)
-   UT_DECLARE_SCRIPT_METHOD(PlatformType);     // PlatformType(index)
-   UT_DECLARE_SCRIPT_METHOD(SetStartDate);     // SetStartDate(month, day, year)
-   UT_DECLARE_SCRIPT_METHOD(SetStartTime);     // SetStartTime(seconds past midnight)
-   UT_DECLARE_SCRIPT_METHOD(SetStartEpoch);    // SetStartEpoch(YYYYDDDD.F)
-   UT_DECLARE_SCRIPT_METHOD(RandomSeed);       // Current random seed
-   UT_DECLARE_SCRIPT_METHOD(RunNumber);        // Current run number
-   UT_DECLARE_SCRIPT_METHOD(GetAtmosphere);    // Scenario-owned atmosphere
-   UT_DECLARE_SCRIPT_METHOD(Terminate);        // End the simulation
+   UT_DECLARE_SCRIPT_METHOD(ClockRate);         // Get the simulation clock rate (for realtime)
+   UT_DECLARE_SCRIPT_METHOD(SetClockRate);      // Set the simulation clock rate (for realtime)
+   UT_DECLARE_SCRIPT_METHOD(IsRealtime);        // See if simulation is running in realtime mode
+   UT_DECLARE_SCRIPT_METHOD(PlatformCount);     // Get the number of platforms in the platform list
+   UT_DECLARE_SCRIPT_METHOD(PlatformEntry);     // Get the active platform entry
+   UT_DECLARE_SCRIPT_METHOD(FindPlatform_1);    // FindPlatform(string)
+   UT_DECLARE_SCRIPT_METHOD(FindPlatform_2);    // FindPlatform(index)
+   UT_DECLARE_SCRIPT_METHOD(AddPlatform);       // AddPlatform(WsfPlatform)
+   UT_DECLARE_SCRIPT_METHOD(CreatePlatform);    // CreatePlatform(string, string)
+   UT_DECLARE_SCRIPT_METHOD(DeletePlatform_1);  // DeletePlatform(string)
+   UT_DECLARE_SCRIPT_METHOD(DeletePlatform_2);  // DeletePlatform(index)
+   UT_DECLARE_SCRIPT_METHOD(PlatformName);      // PlatformName(index)
+   UT_DECLARE_SCRIPT_METHOD(PlatformType);      // PlatformType(index)
+   UT_DECLARE_SCRIPT_METHOD(PlatformsWithin_1); // PlatformsWithin(WsfGeoPoint, double)
+   UT_DECLARE_SCRIPT_METHOD(PlatformsWithin_2); // PlatformsWithin(WsfGeoPoint, double, string, string)
+   UT_DECLARE_SCRIPT_METHOD(SetStartDate);      // SetStartDate(month, day, year)
+   UT_DECLARE_SCRIPT_METHOD(SetStartTime);      // SetStartTime(seconds past midnight)
+   UT_DECLARE_SCRIPT_METHOD(SetStartEpoch);     // SetStartEpoch(YYYYDDDD.F)
+   UT_DECLARE_SCRIPT_METHOD(RandomSeed);        // Current random seed
+   UT_DECLARE_SCRIPT_METHOD(RunNumber);         // Current run number
+   UT_DECLARE_SCRIPT_METHOD(GetAtmosphere);     // Scenario-owned atmosphere
+   UT_DECLARE_SCRIPT_METHOD(Terminate);         // End the simulation
    UT_DECLARE_SCRIPT_METHOD(ScriptExists);
    UT_DECLARE_SCRIPT_METHOD(Execute_1);
    UT_DECLARE_SCRIPT_METHOD(Execute_2);
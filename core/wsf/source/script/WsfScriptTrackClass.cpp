@@ -537,6 +537,13 @@ UT_DEFINE_SCRIPT_METHOD(WsfScriptTrackClass, WsfTrack, UpdateTime, 0, "double",
 UT_DEFINE_SCRIPT_METHOD(WsfScriptTrackClass, WsfTrack, SetUpdateTime, 1, "void", "double")
 {
    aObjectPtr->SetUpdateTime(aVarArgs[0].GetDouble());
+
+   // The purge schedule of the track manager that owns a local track must reflect the new update time.
+   WsfLocalTrack* localTrackPtr = dynamic_cast<WsfLocalTrack*>(aObjectPtr);
+   if ((localTrackPtr != nullptr) && (localTrackPtr->GetTrackManager() != nullptr))
+   {
+      localTrackPtr->GetTrackManager()->ReschedulePurge(*localTrackPtr);
+   }
 }
 
 UT_DEFINE_SCRIPT_METHOD(WsfScriptTrackClass, WsfTrack, TimeSinceUpdated, 0, "double", "")
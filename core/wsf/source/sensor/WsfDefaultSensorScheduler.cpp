@@ -21,9 +21,11 @@
 #include "WsfEM_Xmtr.hpp"
 #include "WsfLocalTrack.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSensorObserver.hpp"
+#include "WsfSensorSearchRoster.hpp"
 #include "WsfSensorTracker.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfTrackList.hpp"
@@ -51,6 +53,10 @@
 // time-ordered manner and a priority_queue would be an obvious choice, but we also have to
 // be able to remove entries from the middle of the list.  Since this list is often very short,
 // searching through a vector to find the next request is probably the easiest thing.
+//
+// With thousands of sensors, a chance list per sensor holding every platform became a problem in its own right
+// (both the memory and the cost of inserting and erasing on every platform addition and deletion), so the chance
+// list is now normally defined in terms of a roster shared by all of the schedulers. See WsfSensorSearchRoster.
 
 // =================================================================================================
 WsfDefaultSensorScheduler::WsfDefaultSensorScheduler()
@@ -62,6 +68,14 @@ WsfDefaultSensorScheduler::WsfDefaultSensorScheduler()
    , mSearchChanceInterval(0.0)
    , mSearchFrameTime(0.0)
    , mSearchIndex(0)
+   , mSearchRosterPtr()
+   , mSearchListState(cSLS_INACTIVE)
+   , mSearchCount(0)
+   , mSearchLastAdded(0)
+   , mSearchExclusions()
+   , mSearchGeneration(0)
+   , mSearchAtEnd()
+   , mSearchCursor(0)
    , mRequestList()
    , mRequestIndex(0)
    , mLastExplicitModeIndex(0)
@@ -82,6 +96,14 @@ WsfDefaultSensorScheduler::WsfDefaultSensorScheduler(const WsfDefaultSensorSched
    , mSearchChanceInterval(0.0)
    , mSearchFrameTime(0.0)
    , mSearchIndex(0)
+   , mSearchRosterPtr()
+   , mSearchListState(cSLS_INACTIVE)
+   , mSearchCount(0)
+   , mSearchLastAdded(0)
+   , mSearchExclusions()
+   , mSearchGeneration(0)
+   , mSearchAtEnd()
+   , mSearchCursor(0)
    , mRequestList()
    , mRequestIndex(0)
    , mLastExplicitModeIndex(0)
@@ -92,6 +114,12 @@ WsfDefaultSensorScheduler::WsfDefaultSensorScheduler(const WsfDefaultSensorSched
 {
 }
 
+// =================================================================================================
+WsfDefaultSensorScheduler::~WsfDefaultSensorScheduler()
+{
+   ReleaseSearchEntries();
+}
+
 //! Factory method for WsfSensorSchedulerTypes to determine if a scheduler
 //! represented by this class is being requested.
 // static
@@ -179,6 +207,10 @@ bool WsfDefaultSensorScheduler::Initialize(double aSimTime, WsfSensor* aSensorPt
 
    bool ok = WsfSensorScheduler::Initialize(aSimTime, aSensorPtr, aTrackerPtr);
 
+   ReleaseSearchEntries();
+   mSearchRosterPtr = WsfSensorSearchRoster::Find(*aSensorPtr->GetSimulation());
+   mSearchListState = (mSearchRosterPtr != nullptr) ? cSLS_INACTIVE : cSLS_EXPLICIT;
+
    // Reduce future dynamic casting by extracting derived class mode pointers.
    aSensorPtr->GetModeList()->GetDerivedModeList(mModeList);
    mLastExplicitModeIndex = static_cast<unsigned int>(mModeList.size());
@@ -250,6 +282,14 @@ void WsfDefaultSensorScheduler::ModeSelected(double aSimTime, WsfStringId aModeN
    }
 }
 
+// =================================================================================================
+//! Every platform is a potential search target.
+// virtual
+void WsfDefaultSensorScheduler::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 // =================================================================================================
 // virtual
 void WsfDefaultSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
@@ -269,20 +309,34 @@ void WsfDefaultSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPla
    }
 
    // Put the platform on either the front or the back of the queue.
+   // The contents of the queue are not needed while the sensor is off (the queue is rebuilt when it is turned on).
 
-   if (addToFront)
+   if (mSearchListState == cSLS_SHARED)
    {
-      mSearchList.push_back(aPlatformPtr->GetIndex());
+      // Note that 'addToFront' places the platform at the end of the vector.
+      if (!AddSearchEntry(aPlatformPtr->GetIndex(), addToFront))
+      {
+         // The platform was already added or was added out of order.
+         UseExplicitSearchList();
+      }
    }
-   else
+   if (mSearchListState == cSLS_EXPLICIT)
    {
-      mSearchList.insert(mSearchList.begin(), aPlatformPtr->GetIndex());
+      if (addToFront)
+      {
+         mSearchList.push_back(aPlatformPtr->GetIndex());
+      }
+      else
+      {
+         mSearchList.insert(mSearchList.begin(), aPlatformPtr->GetIndex());
 
-      // Because the list has been shifted we must also shift the index.  If it was pointed one-past
-      // -the-end before then it will still be one-past-the-end.  This is OK because we check the
-      // index in SelectTarget.
-      ++mSearchIndex;
+         // Because the list has been shifted we must also shift the index.  If it was pointed one-past
+         // -the-end before then it will still be one-past-the-end.  This is OK because we check the
+         // index in SelectTarget.
+         ++mSearchIndex;
+      }
    }
+   ++mSearchCount;
    UpdateSearchChanceInterval();
 }
 
@@ -291,8 +345,7 @@ void WsfDefaultSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPla
 void WsfDefaultSensorScheduler::PlatformDeleted(WsfPlatform* aPlatformPtr)
 {
    // Tell 'SelectTarget' to check the search list for obsolete items if search is disabled.
-   if ((!mSearchAllowed) &&
-       (std::find(mSearchList.begin(), mSearchList.end(), aPlatformPtr->GetIndex()) != mSearchList.end()))
+   if ((!mSearchAllowed) && IsSearchEntry(aPlatformPtr->GetIndex()))
    {
       mCheckSearchList = true;
    }
@@ -335,6 +388,17 @@ bool WsfDefaultSensorScheduler::ProcessInput(UtInput& aInput)
 // virtual
 void WsfDefaultSensorScheduler::RemoveTarget(double aSimTime, size_t aTargetIndex)
 {
+   if (mSearchListState == cSLS_SHARED)
+   {
+      // The cursor is unaffected, as it refers to a position relative to the remaining entries.
+      if (IsSearchEntry(aTargetIndex))
+      {
+         RemoveSearchEntry(aTargetIndex);
+         UpdateSearchChanceInterval();
+      }
+      return;
+   }
+
    auto sli = std::find(mSearchList.begin(), mSearchList.end(), aTargetIndex);
    if (sli != mSearchList.end())
    {
@@ -352,6 +416,7 @@ void WsfDefaultSensorScheduler::RemoveTarget(double aSimTime, size_t aTargetInde
       }
 
       mSearchList.erase(sli);
+      mSearchCount = mSearchList.size();
       UpdateSearchChanceInterval();
    }
 }
@@ -399,7 +464,31 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
    // NOTE: This check is performed only when requested AND when search is disabled. The request is made
    //       when mode change occurs or when a platform is deleted from the simulation.
 
-   if (mCheckSearchList && (!mSearchAllowed))
+   if (mCheckSearchList && (!mSearchAllowed) && (mSearchListState == cSLS_SHARED))
+   {
+      WsfSensorTracker::Settings stSettings;
+      for (size_t ti = FirstSearchEntry(); ti != 0; ti = NextSearchEntry(SearchKey(ti) + 1))
+      {
+         if (!TargetHasActiveRequest(ti))
+         {
+            // Loop until any detection data is cleaned up and outstanding track is dropped.
+            while (!mTrackerPtr->TargetSkipped(aSimTime, stSettings, WsfTrackId(), ti))
+            {
+            }
+
+            // If the target platform no longer exists, remove it from the search list.
+            if (sim.GetPlatformByIndex(ti) == nullptr)
+            {
+               RemoveSearchEntry(ti);
+            }
+         }
+      }
+
+      // Start at the head of the list when a search mode is subsequently selected.
+      size_t firstIndex = FirstSearchEntry();
+      mSearchCursor     = (firstIndex != 0) ? SearchKey(firstIndex) : 0;
+   }
+   else if (mCheckSearchList && (!mSearchAllowed))
    {
       WsfSensorTracker::Settings stSettings;
       bool                       platformsDeleted = false;
@@ -426,6 +515,7 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
       if (platformsDeleted)
       {
          mSearchList.erase(std::remove(mSearchList.begin(), mSearchList.end(), 0U), mSearchList.end());
+         mSearchCount = mSearchList.size();
       }
       // Start at the head of the list when a search mode is subsequently selected.
       mSearchIndex = 0;
@@ -517,7 +607,23 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
    else if (mNextSearchVisitTime <= (aSimTime + cEPSILON))
    {
       // Select the next target for a search chance if search is allowed and there are items to search.
-      if (mSearchAllowed && (!mSearchList.empty()))
+      if (mSearchAllowed && (mSearchCount != 0) && (mSearchListState == cSLS_SHARED))
+      {
+         aSettings.mModeIndex = mSearchModeIndex;
+         targetIndex          = NextSearchEntry(mSearchCursor);
+         if (targetIndex == 0)
+         {
+            targetIndex = FirstSearchEntry();
+         }
+         mSearchCursor = SearchKey(targetIndex) + 1;
+
+         // Bypass the search chance if there is an explicit request against the target
+         if (TargetHasActiveRequest(targetIndex))
+         {
+            targetIndex = 0;
+         }
+      }
+      else if (mSearchAllowed && (!mSearchList.empty()))
       {
          aSettings.mModeIndex = mSearchModeIndex;
          if (mSearchIndex >= mSearchList.size())
@@ -768,6 +874,10 @@ void WsfDefaultSensorScheduler::TurnOff(double aSimTime)
    // When the sensor is turned off the sensing chance queue is cleared to save memory.
    ResetSearchList();
    ResetTrackList();
+   if (mSearchRosterPtr != nullptr)
+   {
+      mSearchListState = cSLS_INACTIVE;
+   }
 }
 
 // =================================================================================================
@@ -782,6 +892,7 @@ void WsfDefaultSensorScheduler::TurnOn(double aSimTime)
    // The queue must be rebuilt when the sensor is turned back on.
 
    ResetSearchList(); // This should be a no-op...
+   mSearchListState = (mSearchRosterPtr != nullptr) ? cSLS_SHARED : cSLS_EXPLICIT;
    WsfSimulation& sim           = *mSensorPtr->GetSimulation();
    size_t         platformCount = sim.GetPlatformCount();
    for (size_t platformEntry = 0; platformEntry < platformCount; ++platformEntry)
@@ -923,11 +1034,211 @@ void WsfDefaultSensorScheduler::SelectMode(double aSimTime, Request& aRequest)
 void WsfDefaultSensorScheduler::ResetSearchList()
 {
    // Delete the scan chances.
+   ReleaseSearchEntries();
    mSearchList.clear();
    mSearchIndex         = 0;
+   mSearchCount         = 0;
    mNextSearchVisitTime = 1.0E+30;
 }
 
+// =================================================================================================
+//! Add a target to the shared search list.
+//! @param aTargetIndex The platform index of the target.
+//! @param aAddToEnd    'true' if the target is to be added to the end of the list or 'false' if it is to be
+//!                     added to the front.
+//! @returns 'true' if successful or 'false' if the target cannot be represented in terms of the roster (it is
+//! not on the roster or it was not added in order of increasing platform index).
+// private
+bool WsfDefaultSensorScheduler::AddSearchEntry(size_t aTargetIndex, bool aAddToEnd)
+{
+   PruneSearchExclusions();
+   WsfSensorSearchRoster& roster   = *mSearchRosterPtr;
+   size_t                 position = roster.FindPosition(aTargetIndex);
+   if ((aTargetIndex <= mSearchLastAdded) || (position >= roster.GetSize()))
+   {
+      return false;
+   }
+
+   // Exclude the roster platforms between the previous target and this one. They were not given to this scheduler.
+   for (size_t skipped = roster.LowerBound(mSearchLastAdded + 1); skipped < position; ++skipped)
+   {
+      mSearchExclusions.push_back(roster.GetPlatformIndex(skipped));
+   }
+   mSearchLastAdded = aTargetIndex;
+   roster.Hold(position);
+   if (mScanSchedulingMethod == cSSM_RANDOM)
+   {
+      if (mSearchAtEnd.size() <= aTargetIndex)
+      {
+         mSearchAtEnd.resize(aTargetIndex + 1);
+      }
+      mSearchAtEnd[aTargetIndex] = aAddToEnd;
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Return the platform index of the first entry in the shared search list, or 0 if the list is empty.
+// private
+size_t WsfDefaultSensorScheduler::FirstSearchEntry() const
+{
+   // No entry can have a key less than that of the last target added to the front of the list.
+   return NextSearchEntry(-static_cast<std::int64_t>(mSearchLastAdded));
+}
+
+// =================================================================================================
+//! Return the platform index of the first entry in the shared search list whose key is not less than
+//! the specified key, or 0 if there is no such entry.
+// private
+size_t WsfDefaultSensorScheduler::NextSearchEntry(std::int64_t aKey) const
+{
+   const WsfSensorSearchRoster& roster      = *mSearchRosterPtr;
+   size_t                       endPosition = roster.LowerBound(mSearchLastAdded + 1);
+
+   // The entries at the front of the list (key = -index) in order of decreasing platform index.
+   if ((aKey <= 0) && (mScanSchedulingMethod != cSSM_INPUT_ORDER))
+   {
+      size_t position = std::min(roster.LowerBound(static_cast<size_t>(-aKey) + 1), endPosition);
+      while (position > 0)
+      {
+         --position;
+         size_t targetIndex = roster.GetPlatformIndex(position);
+         if ((SearchKey(targetIndex) < 0) && (!IsSearchExclusion(targetIndex)))
+         {
+            return targetIndex;
+         }
+      }
+   }
+
+   // The entries at the end of the list (key = index) in order of increasing platform index.
+   if (mScanSchedulingMethod != cSSM_REVERSE_INPUT_ORDER)
+   {
+      size_t position = roster.LowerBound(static_cast<size_t>(std::max(aKey, static_cast<std::int64_t>(1))));
+      for (; position < endPosition; ++position)
+      {
+         size_t targetIndex = roster.GetPlatformIndex(position);
+         if ((SearchKey(targetIndex) > 0) && (!IsSearchExclusion(targetIndex)))
+         {
+            return targetIndex;
+         }
+      }
+   }
+   return 0;
+}
+
+// =================================================================================================
+//! Return 'true' if the specified target is in the search list.
+// private
+bool WsfDefaultSensorScheduler::IsSearchEntry(size_t aTargetIndex) const
+{
+   bool isEntry = false;
+   if (mSearchListState == cSLS_SHARED)
+   {
+      isEntry = (aTargetIndex != 0) && (aTargetIndex <= mSearchLastAdded) && mSearchRosterPtr->Contains(aTargetIndex) &&
+                (!IsSearchExclusion(aTargetIndex));
+   }
+   else if (mSearchListState == cSLS_EXPLICIT)
+   {
+      isEntry = (std::find(mSearchList.begin(), mSearchList.end(), aTargetIndex) != mSearchList.end());
+   }
+   return isEntry;
+}
+
+// =================================================================================================
+// private
+bool WsfDefaultSensorScheduler::IsSearchExclusion(size_t aTargetIndex) const
+{
+   return std::binary_search(mSearchExclusions.begin(), mSearchExclusions.end(), aTargetIndex);
+}
+
+// =================================================================================================
+//! Discard the exclusions of platforms that have been removed from the roster.
+// private
+void WsfDefaultSensorScheduler::PruneSearchExclusions()
+{
+   const WsfSensorSearchRoster& roster = *mSearchRosterPtr;
+   if (mSearchGeneration != roster.GetGeneration())
+   {
+      mSearchGeneration = roster.GetGeneration();
+      mSearchExclusions.erase(std::remove_if(mSearchExclusions.begin(),
+                                             mSearchExclusions.end(),
+                                             [&roster](size_t aTargetIndex) { return !roster.Contains(aTargetIndex); }),
+                              mSearchExclusions.end());
+   }
+}
+
+// =================================================================================================
+//! Release the roster platforms held by the shared search list and clear the shared search list.
+// private
+void WsfDefaultSensorScheduler::ReleaseSearchEntries()
+{
+   if (mSearchListState == cSLS_SHARED)
+   {
+      WsfSensorSearchRoster& roster      = *mSearchRosterPtr;
+      size_t                 endPosition = roster.LowerBound(mSearchLastAdded + 1);
+      for (size_t position = 0; position < endPosition; ++position)
+      {
+         size_t targetIndex = roster.GetPlatformIndex(position);
+         if (!IsSearchExclusion(targetIndex))
+         {
+            roster.Release(targetIndex);
+         }
+      }
+      mSearchGeneration = roster.GetGeneration();
+   }
+   mSearchLastAdded = 0;
+   mSearchExclusions.clear();
+   mSearchAtEnd.clear();
+   mSearchCursor = 0;
+}
+
+// =================================================================================================
+//! Remove an entry from the shared search list.
+// private
+void WsfDefaultSensorScheduler::RemoveSearchEntry(size_t aTargetIndex)
+{
+   PruneSearchExclusions();
+   mSearchExclusions.insert(std::upper_bound(mSearchExclusions.begin(), mSearchExclusions.end(), aTargetIndex),
+                            aTargetIndex);
+   mSearchRosterPtr->Release(aTargetIndex);
+   --mSearchCount;
+}
+
+// =================================================================================================
+//! Return the key that defines the position of a target in the shared search list.
+//! Targets added to the front of the list have negative keys, so they precede those added to the end.
+// private
+std::int64_t WsfDefaultSensorScheduler::SearchKey(size_t aTargetIndex) const
+{
+   bool atEnd = (mScanSchedulingMethod == cSSM_INPUT_ORDER);
+   if (mScanSchedulingMethod == cSSM_RANDOM)
+   {
+      atEnd = (aTargetIndex < mSearchAtEnd.size()) && mSearchAtEnd[aTargetIndex];
+   }
+   std::int64_t key = static_cast<std::int64_t>(aTargetIndex);
+   return atEnd ? key : -key;
+}
+
+// =================================================================================================
+//! Convert the shared search list to an explicit search list.
+//! This is done only if the list can't be represented in terms of the roster.
+// private
+void WsfDefaultSensorScheduler::UseExplicitSearchList()
+{
+   mSearchList.clear();
+   mSearchIndex = 0;
+   for (size_t ti = FirstSearchEntry(); ti != 0; ti = NextSearchEntry(SearchKey(ti) + 1))
+   {
+      if (SearchKey(ti) < mSearchCursor)
+      {
+         ++mSearchIndex;
+      }
+      mSearchList.push_back(ti);
+   }
+   ReleaseSearchEntries();
+   mSearchListState = cSLS_EXPLICIT;
+}
+
 // =================================================================================================
 // private
 void WsfDefaultSensorScheduler::ResetTrackList()
@@ -1007,9 +1318,9 @@ void WsfDefaultSensorScheduler::UpdateSearchChanceInterval()
    if (mSearchAllowed)
    {
       mSearchChanceInterval = mModeList[mSearchModeIndex]->GetFrameTime();
-      if (!mSearchList.empty())
+      if (mSearchCount != 0)
       {
-         mSearchChanceInterval = mSearchChanceInterval / mSearchList.size();
+         mSearchChanceInterval = mSearchChanceInterval / mSearchCount;
       }
    }
    else
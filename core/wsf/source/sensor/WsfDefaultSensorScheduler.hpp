@@ -14,9 +14,12 @@
 
 #include "wsf_export.h"
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "WsfSensorScheduler.hpp"
+class WsfSensorSearchRoster;
 #include "WsfTrack.hpp"
 #include "WsfTrackId.hpp"
 
@@ -25,12 +28,19 @@
 //! In search mode, this schedules detection chances for a sensor using a statistical scan.
 //! Times of detection chances are random and independent of the target's location, but still
 //! constrained by the 'frame_time'.
+//!
+//! The search list (the targets that receive search chances) is normally not held by the scheduler. It is instead
+//! defined in terms of the simulation-wide WsfSensorSearchRoster: the roster platforms that have been added to the
+//! scheduler, less a short list of exclusions (targets that were never added or have since been removed). The position
+//! of each target within the list follows from its platform index and whether it was added to the front or the end of
+//! the list, so only a cursor is needed to cycle through the list. The list is converted to an explicit list (held in
+//! mSearchList) only in the unusual case where it cannot be represented this way (e.g., a target is added twice).
 class WSF_EXPORT WsfDefaultSensorScheduler : public WsfSensorScheduler
 {
 public:
    WsfDefaultSensorScheduler();
 
-   ~WsfDefaultSensorScheduler() override = default;
+   ~WsfDefaultSensorScheduler() override;
 
    static std::unique_ptr<WsfSensorScheduler> ObjectFactory(const std::string& aTypeName);
 
@@ -50,6 +60,8 @@ public:
 
    void ModeSelected(double aSimTime, WsfStringId aModeNameId) override;
 
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
+
    void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) override;
 
    void PlatformDeleted(WsfPlatform* aPlatformPtr) override;
@@ -135,6 +147,14 @@ protected:
       cSSM_REVERSE_INPUT_ORDER
    };
 
+   //! How the search list is represented.
+   enum SearchListState
+   {
+      cSLS_INACTIVE, //!< The sensor is off. Only the number of entries is maintained.
+      cSLS_SHARED,   //!< The search list is defined in terms of the search roster.
+      cSLS_EXPLICIT  //!< The search list is held in mSearchList.
+   };
+
    WsfDefaultSensorScheduler(const WsfDefaultSensorScheduler& aSrc);
    WsfDefaultSensorScheduler& operator=(const WsfDefaultSensorScheduler&) = delete;
 
@@ -148,6 +168,17 @@ protected:
 
    void ResetSearchList();
 
+   bool         AddSearchEntry(size_t aTargetIndex, bool aAddToEnd);
+   size_t       FirstSearchEntry() const;
+   size_t       NextSearchEntry(std::int64_t aKey) const;
+   bool         IsSearchEntry(size_t aTargetIndex) const;
+   bool         IsSearchExclusion(size_t aTargetIndex) const;
+   void         PruneSearchExclusions();
+   void         ReleaseSearchEntries();
+   void         RemoveSearchEntry(size_t aTargetIndex);
+   std::int64_t SearchKey(size_t aTargetIndex) const;
+   void         UseExplicitSearchList();
+
    size_t SelectTargetForRequest(Request& aRequest);
 
    bool TargetHasActiveRequest(size_t aTargetIndex) const;
@@ -183,9 +214,39 @@ protected:
    double mSearchChanceInterval;
    double mSearchFrameTime;
 
-   //! The vector index of the next search chance to be performed.
+   //! The vector index of the next search chance to be performed (explicit search list).
    SearchListIndex mSearchIndex;
 
+   //! The shared search roster (null if the simulation does not provide one).
+   std::shared_ptr<WsfSensorSearchRoster> mSearchRosterPtr;
+
+   SearchListState mSearchListState;
+
+   //! The number of entries in the search list.
+   size_t mSearchCount;
+
+   //! @name Shared search list state.
+   //! The search list consists of the roster platforms with an index not greater than mSearchLastAdded that are
+   //! not in mSearchExclusions. The list is ordered by SearchKey(): the entries added to the front of the list
+   //! in order of decreasing platform index, followed by the entries added to the end in increasing order.
+   //@{
+   //! The platform index of the last target added to the search list.
+   size_t mSearchLastAdded;
+
+   //! The roster platforms not greater than mSearchLastAdded that are not in the search list (sorted).
+   std::vector<size_t> mSearchExclusions;
+
+   //! The roster generation when the exclusions were last pruned.
+   unsigned int mSearchGeneration;
+
+   //! For 'random' scan scheduling, 'true' for each platform index that was added to the end of the list.
+   std::vector<bool> mSearchAtEnd;
+
+   //! The next search chance is for the first entry whose key is not less than the cursor (or the first entry
+   //! if there is no such entry).
+   std::int64_t mSearchCursor;
+   //@}
+
    //! A list of active track requests
    RequestList mRequestList;
 
@@ -41,6 +41,15 @@
 #include "WsfTrack.hpp"
 #include "WsfTrackList.hpp"
 
+namespace
+{
+//! Returns true if a state list entry is ordered before the entry for an object index.
+bool EntryBefore(const std::pair<size_t, WsfDefaultSensorTracker::State*>& aEntry, size_t aObjectId)
+{
+   return aEntry.first < aObjectId;
+}
+} // namespace
+
 // =================================================================================================
 WsfDefaultSensorTracker::WsfDefaultSensorTracker(WsfScenario& aScenario)
    : WsfSensorTracker()
@@ -50,6 +59,8 @@ WsfDefaultSensorTracker::WsfDefaultSensorTracker(WsfScenario& aScenario)
    , mFilterPtr(nullptr)
    , mModeList()
    , mStateList()
+   , mFreeStateList()
+   , mFreeFilterList()
    , mSendTrackDropOnTurnOff(false)
    , mTurnOffInProgress(false)
 {
@@ -64,6 +75,8 @@ WsfDefaultSensorTracker::WsfDefaultSensorTracker(const WsfDefaultSensorTracker&
    , mFilterPtr(nullptr)
    , mModeList()
    , mStateList()
+   , mFreeStateList()
+   , mFreeFilterList()
    , mSendTrackDropOnTurnOff(aSrc.mSendTrackDropOnTurnOff)
    , mTurnOffInProgress(false)
 {
@@ -82,6 +95,14 @@ WsfDefaultSensorTracker::~WsfDefaultSensorTracker()
    {
       delete sli.second;
    }
+   for (State* statePtr : mFreeStateList)
+   {
+      delete statePtr;
+   }
+   for (WsfFilter* filterPtr : mFreeFilterList)
+   {
+      delete filterPtr;
+   }
 }
 
 // =================================================================================================
@@ -176,10 +197,9 @@ void WsfDefaultSensorTracker::GetRequestDataForTarget(size_t      aObjectId,
                                                       size_t&     aModeIndex,
                                                       WsfTrackId& aTrackId) const
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   const State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       aRequestId      = statePtr->mRequestId;
       aModeIndex      = statePtr->mModeIndex;
       aTrackId.Null();
@@ -245,10 +265,9 @@ void WsfDefaultSensorTracker::SchedulerModeChange(double            aSimTime,
                                                   WsfPlatform*      aTargetPtr,
                                                   WsfStringId       aNewModeName)
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr     = sli->second;
       size_t newModeIndex = mSensorPtr->GetModeList()->GetModeByName(aNewModeName);
       if (newModeIndex < mSensorPtr->GetModeList()->GetModeCount())
       {
@@ -269,7 +288,7 @@ void WsfDefaultSensorTracker::StopTracking(double aSimTime, const WsfTrackId& aR
 
    // Locate the state(s) with the requested Id. In theory there may be more than one physical object associated
    // with a given request, so we must construct a list of the targets and then process them at the end.
-   // We can't process them inside the following loop because the iterator would get invalidated by 'erase'.
+   // We can't process them inside the following loop because the iterator would get invalidated by 'RemoveState'.
    std::vector<size_t> objectKeys;
    for (auto& sli : mStateList)
    {
@@ -283,14 +302,12 @@ void WsfDefaultSensorTracker::StopTracking(double aSimTime, const WsfTrackId& aR
    // Now go back and process the applicable targets.
    for (size_t objectKey : objectKeys)
    {
-      auto sli = mStateList.find(objectKey);
-      if (sli != mStateList.end())
+      // NOTE - the order of operations is important to avoid problems with callbacks.
+      State* statePtr = RemoveState(objectKey); // 1...
+      if (statePtr != nullptr)
       {
-         // NOTE - the order of operations is important to avoid problems with callbacks.
-         State* statePtr = (*sli).second;
-         mStateList.erase(sli);         // 1...
          DropTrack(aSimTime, statePtr); // 2...
-         delete statePtr;               // 3...
+         ReleaseState(statePtr);        // 3...
       }
    }
 }
@@ -302,10 +319,9 @@ void WsfDefaultSensorTracker::TargetBlocked(double            aSimTime,
                                             const WsfTrackId& aRequestId,
                                             unsigned int      aObjectId)
 {
-   auto sli = mStateList.find((int)aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = (*sli).second;
       if (statePtr->mTrackPtr != nullptr)
       {
          WsfSensorMode* modePtr = GetSensor()->GetModeEntry(statePtr->mModeIndex);
@@ -329,10 +345,9 @@ bool WsfDefaultSensorTracker::TargetDeleted(double            aSimTime,
    // a track is being maintained, then we must not delete the track until it has
    // failed the M/N criteria.
 
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       assert(statePtr->mModeIndex < mSensorPtr->GetModeCount());
 
       // Unless suppressed, inform observers of change in detection status.
@@ -358,10 +373,10 @@ bool WsfDefaultSensorTracker::TargetDeleted(double            aSimTime,
          if (dropTrack)
          {
             // NOTE - The order of operations is important to avoid problems with callbacks.
-            mStateList.erase(sli); // 1...
+            RemoveState(aObjectId); // 1...
             DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
             DropTrack(aSimTime, statePtr); // 2...
-            delete statePtr;               // 3...
+            ReleaseState(statePtr);        // 3...
          }
          else
          {
@@ -386,17 +401,11 @@ void WsfDefaultSensorTracker::TargetDetected(double            aSimTime,
    // Locate the state data for the requested object ID.  If no data exists then create
    // and initialize state data for the object.
 
-   State* statePtr = nullptr;
-   auto   sli      = mStateList.find(aObjectId);
-   if (sli == mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr == nullptr)
    {
       // State data does not exist for this target.  Create and initialize new state data.
-      statePtr = new State(aRequestId, aResult);
-      mStateList.insert(std::make_pair(aObjectId, statePtr));
-   }
-   else
-   {
-      statePtr = sli->second;
+      statePtr = AddState(aObjectId, aRequestId, aResult);
    }
 
    // Check for a possible mode switch.
@@ -416,11 +425,9 @@ void WsfDefaultSensorTracker::TargetDetected(double            aSimTime,
    // Allow a component to reject the detection.
    if (!AllowTrackingP(aSimTime, aSettings, aRequestId, aObjectId, statePtr->mTrackPtr, aResult))
    {
-      sli = mStateList.find(aObjectId);
       DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
       DropTrack(aSimTime, statePtr);
-      mStateList.erase(sli);
-      delete statePtr;
+      ReleaseState(RemoveState(aObjectId));
       return;
    }
 
@@ -444,8 +451,7 @@ void WsfDefaultSensorTracker::TargetDetected(double            aSimTime,
       // Allocate the filter object for this target if not yet allocated
       if (statePtr->mFilterPtr == nullptr)
       {
-         statePtr->mFilterPtr = mFilterPtr->Clone();
-         statePtr->mFilterPtr->Initialize(aSimTime, GetSimulation());
+         AttachFilter(aSimTime, statePtr);
       }
       else if (statePtr->mTrackPtr == nullptr)
       {
@@ -622,10 +628,9 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
    // a track is being maintained, then we must not delete the track until it has
    // failed the M/N criteria.
 
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       assert(statePtr->mModeIndex < mSensorPtr->GetModeCount());
       WsfSensorMode* modePtr      = mModeList[statePtr->mModeIndex];
       statePtr->mDetectionHistory = (statePtr->mDetectionHistory << 1);
@@ -641,10 +646,10 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
          if (shouldDropTrack)
          {
             // NOTE - The order of operations is important to avoid problems with callbacks.
-            mStateList.erase(sli); // 1...
+            RemoveState(aObjectId); // 1...
             DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
             DropTrack(aSimTime, statePtr); // 2...
-            delete statePtr;               // 3...
+            ReleaseState(statePtr);        // 3...
          }
          else
          {
@@ -653,8 +658,8 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
       }
       else
       {
-         mStateList.erase(sli);
-         delete statePtr;
+         RemoveState(aObjectId);
+         ReleaseState(statePtr);
       }
    }
 
@@ -670,12 +675,11 @@ void WsfDefaultSensorTracker::TargetUndetected(double            aSimTime,
                                                WsfPlatform*      aTargetPtr,
                                                WsfSensorResult&  aResult)
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli == mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr == nullptr)
    {
       return;
    }
-   State* statePtr = sli->second;
 
    // Check for a possible mode switch.
    // TODO - should this be for tracking requests only??? What about simple mode switches for things like
@@ -815,22 +819,20 @@ void WsfDefaultSensorTracker::TurnOff(double aSimTime)
 
    // NOTE - A copy of the state data pointer list is made and then the original is cleared. This is
    // necessary to prevent problems associated with the callbacks that result from dropping tracks.
-   StateList tempStateData(mStateList);
-   mStateList.clear();
+   StateList tempStateData;
+   tempStateData.swap(mStateList);
 
    mTurnOffInProgress = true;
-   while (!tempStateData.empty())
+   for (StateEntry& entry : tempStateData)
    {
-      auto   sli      = tempStateData.begin();
-      State* statePtr = (*sli).second;     // 1...
-      tempStateData.erase(sli);            // 2...
+      State* statePtr = entry.second;      // 1...
       if (statePtr->mDetectionHistory & 1) // currently detected
       {
          ProcessSensorDetectionChanged(aSimTime, *statePtr,
-                                       WsfSensorResult::cDETECTION_STOP); // 3...
+                                       WsfSensorResult::cDETECTION_STOP); // 2...
       }
-      DropTrack(aSimTime, statePtr); // 4...
-      delete statePtr;               // 5...
+      DropTrack(aSimTime, statePtr); // 3...
+      ReleaseState(statePtr);        // 4...
    }
    mTurnOffInProgress = false;
    mActiveTrackCount  = 0;
@@ -880,10 +882,9 @@ void WsfDefaultSensorTracker::CheckForAutoModeSwitch(double aSimTime, size_t aOb
    // NOTE: If this was called as the result of dropping a track, the call to DropTrack may have resulted in
    // callbacks to which may themselves that end up canceling the tracking request and the eventual deleting
    // of the state object. Therefore we must make sure it still exists prior to actually performing any mode switch.
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       if (SwitchMode(aSimTime, statePtr, aNewModeIndex))
       {
          // Notify the scheduler of the mode switch.
@@ -972,24 +973,141 @@ void WsfDefaultSensorTracker::ProcessSensorDetectionChanged(double aSimTime, con
 }
 
 // =================================================================================================
-// Nested class 'State'
+//! Return the state data for a target.
+//! @param aObjectId The object index of the target.
+//! @returns The state data, or nullptr if there is no state data for the target.
+// protected
+WsfDefaultSensorTracker::State* WsfDefaultSensorTracker::FindState(size_t aObjectId) const
+{
+   auto sli = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, EntryBefore);
+   if ((sli != mStateList.end()) && (sli->first == aObjectId))
+   {
+      return sli->second;
+   }
+   return nullptr;
+}
+
 // =================================================================================================
+//! Create the state data for a target that does not have state data.
+//! A previously released state is reused if one is available.
+//! @param aObjectId  The object index of the target.
+//! @param aRequestId The sensor scheduler request ID associated with the interaction.
+//! @param aResult    The result of the detection attempt that created the interaction.
+//! @returns The new state data.
+// protected
+WsfDefaultSensorTracker::State* WsfDefaultSensorTracker::AddState(size_t                   aObjectId,
+                                                                  const WsfTrackId&        aRequestId,
+                                                                  const WsfSensor::Result& aResult)
+{
+   State* statePtr = nullptr;
+   if (mFreeStateList.empty())
+   {
+      statePtr = new State(aRequestId, aResult);
+   }
+   else
+   {
+      statePtr = mFreeStateList.back();
+      mFreeStateList.pop_back();
+      statePtr->Reset(aRequestId, aResult);
+   }
+   auto sli = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, EntryBefore);
+   assert((sli == mStateList.end()) || (sli->first != aObjectId));
+   mStateList.emplace(sli, aObjectId, statePtr);
+   return statePtr;
+}
 
-WsfDefaultSensorTracker::State::State(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult)
-   : mRequestId(aRequestId)
-   , mModeIndex(aResult.mModeIndex)
-   , mXmtrIndex(aResult.mXmtrIndex)
-   , mRcvrIndex(aResult.mRcvrIndex)
+// =================================================================================================
+//! Remove the state data for a target from the state list.
+//! The state data is not released; the caller must call ReleaseState when it is no longer needed.
+//! @param aObjectId The object index of the target.
+//! @returns The removed state data, or nullptr if there was no state data for the target.
+// protected
+WsfDefaultSensorTracker::State* WsfDefaultSensorTracker::RemoveState(size_t aObjectId)
 {
-   const WsfPlatform* targetPtr = aResult.GetTarget();
-   if (targetPtr != nullptr)
+   State* statePtr = nullptr;
+   auto   sli      = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, EntryBefore);
+   if ((sli != mStateList.end()) && (sli->first == aObjectId))
    {
-      mTargetIndex = targetPtr->GetIndex();
+      statePtr = sli->second;
+      mStateList.erase(sli);
+   }
+   return statePtr;
+}
+
+// =================================================================================================
+//! Release state data that has been removed from the state list so it may be reused.
+//! The track (if any) is deleted. The filter (if any) is retained for reuse by AttachFilter.
+//! @param aStatePtr The state to be released. Nothing is done if this is nullptr.
+// protected
+void WsfDefaultSensorTracker::ReleaseState(State* aStatePtr)
+{
+   if (aStatePtr != nullptr)
+   {
+      delete aStatePtr->mTrackPtr;
+      aStatePtr->mTrackPtr = nullptr;
+      if (aStatePtr->mFilterPtr != nullptr)
+      {
+         mFreeFilterList.push_back(aStatePtr->mFilterPtr);
+         aStatePtr->mFilterPtr = nullptr;
+      }
+      mFreeStateList.push_back(aStatePtr);
    }
 }
 
+// =================================================================================================
+//! Provide a state with a filter created from the prototype filter.
+//! A previously released filter is reset and reused if one is available.
+//! @param aSimTime  The current simulation time.
+//! @param aStatePtr The state that is to receive the filter.
+// protected
+void WsfDefaultSensorTracker::AttachFilter(double aSimTime, State* aStatePtr)
+{
+   if (mFreeFilterList.empty())
+   {
+      aStatePtr->mFilterPtr = mFilterPtr->Clone();
+      aStatePtr->mFilterPtr->Initialize(aSimTime, GetSimulation());
+   }
+   else
+   {
+      aStatePtr->mFilterPtr = mFreeFilterList.back();
+      mFreeFilterList.pop_back();
+      aStatePtr->mFilterPtr->Reset(aSimTime);
+   }
+}
+
+// =================================================================================================
+// Nested class 'State'
+// =================================================================================================
+
+WsfDefaultSensorTracker::State::State(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult)
+{
+   Reset(aRequestId, aResult);
+}
+
 WsfDefaultSensorTracker::State::~State()
 {
    delete mFilterPtr;
    delete mTrackPtr;
 }
+
+//! Reset the state to that of a new sensor-target interaction.
+//! The filter and track (which must have been released) are not changed.
+void WsfDefaultSensorTracker::State::Reset(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult)
+{
+   mRequestId         = aRequestId;
+   mLockonTime        = -1.0;
+   mTargetIndex       = cINVALID_TARGET_INDEX;
+   mModeIndex         = aResult.mModeIndex;
+   mXmtrIndex         = aResult.mXmtrIndex;
+   mRcvrIndex         = aResult.mRcvrIndex;
+   mDetectionHistory  = 0;
+   mFailuresUntilDrop = -1;
+   mModeSwitchActive  = false;
+   mFalseTargetTrack  = false;
+
+   const WsfPlatform* targetPtr = aResult.GetTarget();
+   if (targetPtr != nullptr)
+   {
+      mTargetIndex = targetPtr->GetIndex();
+   }
+}
@@ -14,7 +14,8 @@
 
 #include "wsf_export.h"
 
-#include <map>
+#include <utility>
+#include <vector>
 
 class WsfFilter;
 #include "WsfSensor.hpp"
@@ -90,6 +91,8 @@ public:
       State(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
       ~State();
 
+      void Reset(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
+
       //! The sensor scheduler request ID associated with the interaction
       WsfTrackId mRequestId;
 
@@ -147,6 +150,12 @@ protected:
 
    void ProcessSensorDetectionChanged(double aSimTime, const State& aState, unsigned int aStatus);
 
+   State* FindState(size_t aObjectId) const;
+   State* AddState(size_t aObjectId, const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
+   State* RemoveState(size_t aObjectId);
+   void   ReleaseState(State* aStatePtr);
+   void   AttachFilter(double aSimTime, State* aStatePtr);
+
    WsfScenario* mScenarioPtr;
 
    //! The maximum number of tracks that can be maintained by the tracker.
@@ -164,13 +173,21 @@ protected:
 
    //! The state data for active sensor-target interactions.
    //! The key value is the object index of the target (which may be a platform index or any other
-   //! index that is unique among all objects of that type.
-   using StateList = std::map<size_t, State*>;
+   //! index that is unique among all objects of that type. The entries are kept sorted by the key in a
+   //! flat vector so a lookup is a binary search over contiguous memory.
+   using StateEntry = std::pair<size_t, State*>;
+   using StateList  = std::vector<StateEntry>;
    StateList mStateList;
 
    //! An iterator for accessing state data.
    using StateListIter = StateList::iterator;
 
+   //! States that have been released and may be reused for new sensor-target interactions.
+   std::vector<State*> mFreeStateList;
+
+   //! Filters that have been released and may be reset and reused for new sensor-target interactions.
+   std::vector<WsfFilter*> mFreeFilterList;
+
    //! 'true' if 'Track Drop' messages should be sent when the sensor is turned off.
    bool mSendTrackDropOnTurnOff;
 
@@ -20,6 +20,7 @@
 #include "UtMath.hpp"
 #include "UtRandom.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSimulation.hpp"
@@ -171,6 +172,12 @@ void WsfPhysicalScanSensorScheduler::ModeSelected(double aSimTime, WsfStringId a
    CheckSearchModeAvailability();
 }
 
+// virtual
+void WsfPhysicalScanSensorScheduler::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 // virtual
 void WsfPhysicalScanSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 {
@@ -23,6 +23,7 @@
 #include "UtRandom.hpp"
 #include "WsfEM_Rcvr.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSimulation.hpp"
@@ -677,6 +678,12 @@ void WsfSectorScanSensorScheduler::ModeSelected(double aSimTime, WsfStringId aMo
    mSearchAllowed         = (!mModeList[mLastExplicitModeIndex]->DisablesSearch());
 }
 
+// virtual
+void WsfSectorScanSensorScheduler::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 // virtual
 void WsfSectorScanSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 {
@@ -329,6 +329,21 @@ bool WsfSensor::Initialize2(double aSimTime)
    return ok;
 }
 
+// =================================================================================================
+//! The sensor is interested in the platforms in which its scheduler and components are interested.
+// virtual
+void WsfSensor::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   if (mSchedulerPtr != nullptr)
+   {
+      mSchedulerPtr->AddPlatformInterest(aInterest);
+   }
+   for (auto component : mComponents)
+   {
+      component->AddPlatformInterest(aInterest);
+   }
+}
+
 // =================================================================================================
 // virtual
 void WsfSensor::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
@@ -29,6 +29,7 @@ class WsfEM_Xmtr;
 #include "WsfMeasurement.hpp"
 class WsfMessage;
 class WsfPlatform;
+class WsfPlatformInterest;
 class WsfSensor;
 #include "WsfSensorComponent.hpp"
 class WsfSensorMode;
@@ -203,6 +204,7 @@ public:
    bool         PreInitialize(double aSimTime) override;
    bool         Initialize(double aSimTime) override;
    bool         Initialize2(double aSimTime) override;
+   void         AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
    void         PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) override;
    void         PlatformDeleted(WsfPlatform* aPlatformPtr) override;
    void         PreInput() override;
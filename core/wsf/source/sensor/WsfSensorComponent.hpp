@@ -15,6 +15,7 @@
 class UtInput;
 #include "WsfComponent.hpp"
 class WsfPlatform;
+class WsfPlatformInterest;
 class WsfSensor;
 class WsfSensorBeam;
 class WsfSensorMode;
@@ -61,6 +62,9 @@ public:
    virtual bool ProcessModeInput(UtInput& aInput, WsfSensorMode& aSensorMode) { return false; }
    virtual bool ProcessBeamInput(UtInput& aInput, WsfSensorBeam& aSensorBeam) { return false; }
 
+   //! Add the other platforms whose addition and deletion the component must be told about.
+   //! A component that overrides PlatformAdded or PlatformDeleted must also override this method.
+   virtual void AddPlatformInterest(WsfPlatformInterest& aInterest) const {}
    virtual void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) {}
    virtual void PlatformDeleted(WsfPlatform* aPlatformPtr) {}
 
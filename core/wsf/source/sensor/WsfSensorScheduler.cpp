@@ -19,6 +19,7 @@
 #include "UtMemory.hpp"
 #include "WsfDefaultSensorScheduler.hpp"
 #include "WsfPhysicalScanSensorScheduler.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSectorScanSensorScheduler.hpp"
 #include "WsfSensorTracker.hpp"
 
@@ -114,6 +115,16 @@ void WsfSensorScheduler::ModeDeselected(double aSimTime, WsfStringId aModeNameId
 // virtual
 void WsfSensorScheduler::ModeSelected(double aSimTime, WsfStringId aModeNameId) {}
 
+// =================================================================================================
+//! Add the other platforms whose addition and deletion the scheduler must be told about.
+//! The default is all platforms. A scheduler that does not need all of them may narrow this.
+//! @param aInterest [updated] The interests of the sensor.
+// virtual
+void WsfSensorScheduler::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 // =================================================================================================
 //! A platform has been added to the simulation.
 //! @param aSimTime     The current simulation time.
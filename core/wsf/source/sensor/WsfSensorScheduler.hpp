@@ -16,6 +16,7 @@
 
 class UtInput;
 class WsfPlatform;
+class WsfPlatformInterest;
 #include "WsfSensor.hpp"
 class WsfSensorTracker;
 #include "WsfTrackId.hpp"
@@ -51,6 +52,8 @@ public:
 
    virtual void ModeSelected(double aSimTime, WsfStringId aModeNameId);
 
+   virtual void AddPlatformInterest(WsfPlatformInterest& aInterest) const;
+
    virtual void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr);
 
    virtual void PlatformDeleted(WsfPlatform* aPlatformPtr);
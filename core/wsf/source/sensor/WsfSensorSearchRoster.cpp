@@ -0,0 +1,167 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfSensorSearchRoster.hpp"
+
+#include <algorithm>
+
+#include "WsfPlatform.hpp"
+#include "WsfPlatformObserver.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+//! The minimum number of dead slots before the roster is compacted.
+const size_t cMIN_COMPACT_COUNT = 64;
+
+bool CompareSlot(const WsfSensorSearchRoster::Slot& aSlot, size_t aPlatformIndex)
+{
+   return aSlot.mPlatformIndex < aPlatformIndex;
+}
+} // namespace
+
+// =================================================================================================
+//! Return the search roster for the specified simulation.
+//! @returns The roster, or a null pointer if the simulation does not maintain one.
+// static
+std::shared_ptr<WsfSensorSearchRoster> WsfSensorSearchRoster::Find(const WsfSimulation& aSimulation)
+{
+   auto extensionPtr = static_cast<WsfSensorSearchRosterExtension*>(aSimulation.FindExtension("sensor_search_roster"));
+   return (extensionPtr != nullptr) ? extensionPtr->GetRoster() : nullptr;
+}
+
+// =================================================================================================
+WsfSensorSearchRoster::WsfSensorSearchRoster()
+   : mSlots()
+   , mDeadCount(0)
+   , mGeneration(0)
+   , mMutex()
+{
+}
+
+// =================================================================================================
+//! Return the position of the platform with the specified index.
+//! @returns The position of the platform, or GetSize() if the platform is not on the roster.
+size_t WsfSensorSearchRoster::FindPosition(size_t aPlatformIndex) const
+{
+   size_t position = LowerBound(aPlatformIndex);
+   if ((position < mSlots.size()) && (mSlots[position].mPlatformIndex != aPlatformIndex))
+   {
+      position = mSlots.size();
+   }
+   return position;
+}
+
+// =================================================================================================
+//! Return the position of the first platform whose index is not less than the specified index.
+size_t WsfSensorSearchRoster::LowerBound(size_t aPlatformIndex) const
+{
+   return std::lower_bound(mSlots.begin(), mSlots.end(), aPlatformIndex, CompareSlot) - mSlots.begin();
+}
+
+// =================================================================================================
+//! Hold the platform at the specified position, which keeps it on the roster after it is deleted.
+void WsfSensorSearchRoster::Hold(size_t aPosition)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   ++mSlots[aPosition].mHolderCount;
+}
+
+// =================================================================================================
+//! Release a platform previously held with Hold().
+void WsfSensorSearchRoster::Release(size_t aPlatformIndex)
+{
+   size_t                      position = FindPosition(aPlatformIndex);
+   std::lock_guard<std::mutex> lock(mMutex);
+   if ((position < mSlots.size()) && (mSlots[position].mHolderCount > 0))
+   {
+      Slot& slot = mSlots[position];
+      --slot.mHolderCount;
+      if (IsDead(slot))
+      {
+         ++mDeadCount;
+      }
+   }
+}
+
+// =================================================================================================
+//! Add a platform to the roster.
+//! Platforms are added in order of increasing platform index.
+void WsfSensorSearchRoster::PlatformAdded(size_t aPlatformIndex)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   // Removing platforms invalidates positions, so it is done only here where positions are already invalidated.
+   if ((mDeadCount >= cMIN_COMPACT_COUNT) && ((2 * mDeadCount) >= mSlots.size()))
+   {
+      Compact();
+   }
+   if (mSlots.empty() || (mSlots.back().mPlatformIndex < aPlatformIndex))
+   {
+      mSlots.push_back(Slot{aPlatformIndex, 0, false});
+   }
+}
+
+// =================================================================================================
+//! Indicate a platform has been deleted from the simulation.
+void WsfSensorSearchRoster::PlatformDeleted(size_t aPlatformIndex)
+{
+   size_t                      position = FindPosition(aPlatformIndex);
+   std::lock_guard<std::mutex> lock(mMutex);
+   if ((position < mSlots.size()) && (!mSlots[position].mDeleted))
+   {
+      Slot& slot    = mSlots[position];
+      slot.mDeleted = true;
+      if (IsDead(slot))
+      {
+         ++mDeadCount;
+      }
+   }
+}
+
+// =================================================================================================
+//! Remove the platforms that have been deleted and are no longer held.
+//! The caller must hold the mutex.
+// private
+void WsfSensorSearchRoster::Compact()
+{
+   mSlots.erase(std::remove_if(mSlots.begin(), mSlots.end(), [this](const Slot& aSlot) { return IsDead(aSlot); }),
+                mSlots.end());
+   mDeadCount = 0;
+   ++mGeneration;
+}
+
+// =================================================================================================
+WsfSensorSearchRosterExtension::WsfSensorSearchRosterExtension()
+   : mRosterPtr(std::make_shared<WsfSensorSearchRoster>())
+   , mCallbacks()
+{
+}
+
+// =================================================================================================
+void WsfSensorSearchRosterExtension::AddedToSimulation()
+{
+   mCallbacks.Add(WsfObserver::PlatformAdded(&GetSimulation())
+                     .Connect(&WsfSensorSearchRosterExtension::PlatformAdded, this));
+   mCallbacks.Add(WsfObserver::PlatformDeleted(&GetSimulation())
+                     .Connect(&WsfSensorSearchRosterExtension::PlatformDeleted, this));
+}
+
+// =================================================================================================
+// private
+void WsfSensorSearchRosterExtension::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
+{
+   mRosterPtr->PlatformAdded(aPlatformPtr->GetIndex());
+}
+
+// =================================================================================================
+// private
+void WsfSensorSearchRosterExtension::PlatformDeleted(double aSimTime, WsfPlatform* aPlatformPtr)
+{
+   mRosterPtr->PlatformDeleted(aPlatformPtr->GetIndex());
+}
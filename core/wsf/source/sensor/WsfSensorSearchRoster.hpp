@@ -0,0 +1,111 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFSENSORSEARCHROSTER_HPP
+#define WSFSENSORSEARCHROSTER_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "UtCallbackHolder.hpp"
+class WsfPlatform;
+class WsfSimulation;
+#include "WsfSimulationExtension.hpp"
+
+//! The simulation-wide roster of platforms that may be searched by sensors.
+//!
+//! The roster is shared by the default sensor schedulers (see WsfDefaultSensorScheduler) so each scheduler does not
+//! have to keep its own list of every platform in the simulation. A scheduler defines its search list in terms of the
+//! roster (the platforms it has been given, less a short list of exclusions) and keeps only a cursor into it.
+//!
+//! The roster holds the platforms in order of increasing platform index. A deleted platform is kept on the roster
+//! while any scheduler still holds it (i.e., until the scheduler drops it from its search list). Platforms that are
+//! deleted and no longer held are removed when they become a large part of the roster, at which point the generation
+//! number is incremented so schedulers know they may discard their exclusions of removed platforms.
+//!
+//! Schedulers release platforms while their sensors are updated, which may be on the worker threads of a
+//! multi-threaded simulation, so the holder counts are guarded by a mutex. Slots are only added and removed by
+//! PlatformAdded, which is called on the main thread while no sensor is being updated.
+class WSF_EXPORT WsfSensorSearchRoster
+{
+public:
+   //! A platform on the roster.
+   struct Slot
+   {
+      size_t       mPlatformIndex;
+      unsigned int mHolderCount; //!< The number of schedulers holding the platform.
+      bool         mDeleted;     //!< 'true' if the platform has been deleted from the simulation.
+   };
+
+   static std::shared_ptr<WsfSensorSearchRoster> Find(const WsfSimulation& aSimulation);
+
+   WsfSensorSearchRoster();
+
+   unsigned int GetGeneration() const { return mGeneration; }
+
+   //! @name Access by position.
+   //! Positions are valid only until the next platform is added to the roster.
+   //@{
+   size_t GetSize() const { return mSlots.size(); }
+   size_t GetPlatformIndex(size_t aPosition) const { return mSlots[aPosition].mPlatformIndex; }
+   size_t FindPosition(size_t aPlatformIndex) const;
+   size_t LowerBound(size_t aPlatformIndex) const;
+   //@}
+
+   bool Contains(size_t aPlatformIndex) const { return FindPosition(aPlatformIndex) < mSlots.size(); }
+
+   void Hold(size_t aPosition);
+   void Release(size_t aPlatformIndex);
+
+   void PlatformAdded(size_t aPlatformIndex);
+   void PlatformDeleted(size_t aPlatformIndex);
+
+private:
+   bool IsDead(const Slot& aSlot) const { return aSlot.mDeleted && (aSlot.mHolderCount == 0); }
+
+   void Compact();
+
+   std::vector<Slot> mSlots;
+
+   //! The number of slots that are deleted and no longer held.
+   size_t mDeadCount;
+
+   //! Incremented whenever platforms are removed from the roster.
+   unsigned int mGeneration;
+
+   //! Guards the holder counts, the deleted flags and the dead count.
+   std::mutex mMutex;
+};
+
+//! The simulation extension that maintains the sensor search roster.
+class WSF_EXPORT WsfSensorSearchRosterExtension : public WsfSimulationExtension
+{
+public:
+   WsfSensorSearchRosterExtension();
+   ~WsfSensorSearchRosterExtension() override = default;
+
+   void AddedToSimulation() override;
+
+   //! Return the roster. The roster is shared with the schedulers that use it, as they may outlive the simulation.
+   const std::shared_ptr<WsfSensorSearchRoster>& GetRoster() const { return mRosterPtr; }
+
+private:
+   void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr);
+   void PlatformDeleted(double aSimTime, WsfPlatform* aPlatformPtr);
+
+   std::shared_ptr<WsfSensorSearchRoster> mRosterPtr;
+
+   UtCallbackHolder mCallbacks;
+};
+
+#endif
@@ -29,6 +29,7 @@
 #include "WsfMover.hpp"
 #include "WsfMoverObserver.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfPlatformInterest.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSimulation.hpp"
@@ -165,6 +166,11 @@ void WsfSpinSensorScheduler::ModeSelected(double aSimTime, WsfStringId aModeName
    mLastExplicitModeIndex = mSensorPtr->GetModeList()->GetModeByName(aModeNameId);
 }
 
+void WsfSpinSensorScheduler::AddPlatformInterest(WsfPlatformInterest& aInterest) const
+{
+   aInterest.AddAllPlatforms();
+}
+
 void WsfSpinSensorScheduler::PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr)
 {
    // When a platform is added, add it to the SearchList, calculate its detection time,
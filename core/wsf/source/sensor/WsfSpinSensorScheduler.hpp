@@ -50,6 +50,8 @@ public:
    void ModeDeselected(double aSimTime, WsfStringId aModeNameId) override;
    void ModeSelected(double aSimTime, WsfStringId aModeNameId) override;
 
+   void AddPlatformInterest(WsfPlatformInterest& aInterest) const override;
+
    void PlatformAdded(double aSimTime, WsfPlatform* aPlatformPtr) override;
 
    void RemoveTarget(double aSimTime, size_t aTargetIndex) override;
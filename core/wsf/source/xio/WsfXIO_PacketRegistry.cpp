@@ -21,7 +21,7 @@
 //! This will prevent incompatible applications from communicating.
 //! NOTE: This should be incremented if ANY of the information that gets serialized is changed.
 //!       This includes ANY object contained within a packet (e.g.: track, message, etc.)
-int WsfXIO_PacketRegistry::sPacketVersion = 38;
+int WsfXIO_PacketRegistry::sPacketVersion = 39;
 
 // Helper macro to ease the pain of registering packets
 #define VALID_ID_RANGE(ID) ((ID >= 1) && (ID <= cXIO_WSF_LAST_PACKET_ID))
@@ -107,6 +107,7 @@ void WsfXIO_PacketRegistry::RegisterPackets(PakProcessor& aProcessor)
    REGISTER_PACKET(WsfXIO_RequestScriptSessionPkt, 71);
    REGISTER_PACKET(WsfXIO_RequestScriptSessionResponsePkt, 72);
    // Packet 73 is assigned in WsfXIO_SimPacketRegistry.
+   REGISTER_PACKET(WsfXIO_EncodedTrackPkt, 74);
 }
 
 void WsfXIO_PacketRegistry::RegisterClasses()
@@ -31,6 +31,7 @@ class PakProcessor;
 #include "xio/WsfXIO_Packet.hpp"
 #include "xio/WsfXIO_PublishKey.hpp"
 #include "xio/WsfXIO_SerializeTypes.hpp"
+#include "xio/WsfXIO_TrackEncoding.hpp"
 
 // See WsfXIO_Packet.hpp for packet ID reservations
 
@@ -243,7 +244,11 @@ public:
       cRAW_DROPPED_TRACKS   = 0x4,
       cLOCAL_TRACKS         = 0x8,
       cLOCAL_DROPPED_TRACKS = 0xe,
-      cALL                  = 0x1f
+      cALL                  = 0x1f,
+      //! Send track updates as WsfXIO_EncodedTrackPkt (an option, not included in cALL)
+      cENCODED_TRACKS       = 0x20,
+      //! Send only the changes to encoded tracks when possible (an option, not included in cALL)
+      cDELTA_TRACKS         = 0x40
    };
 
    //! Index of the platform whose tracks are requested
@@ -1731,4 +1736,32 @@ public:
    // The first response will fill this value with some general information about the system
    InitialData* mInitialData;
 };
+
+//! A track encoded with WsfXIO_TrackEncoding.
+//! This is sent in place of WsfXIO_LocalTrackPkt and WsfXIO_RawTrackPkt to requests for encoded tracks (see
+//! WsfXIO_RequestTracksPkt::cENCODED_TRACKS). The encoding of a track update is made once and shared by all of the
+//! requests that receive the update.
+class WSF_EXPORT WsfXIO_EncodedTrackPkt : public WsfXIO_ResponsePkt
+{
+public:
+   XIO_DEFINE_PACKET_CTOR(WsfXIO_EncodedTrackPkt, WsfXIO_ResponsePkt, 74), mPlatformIndex(0), mIsRawTrack(false),
+      mIsDelta(false)
+   {
+   }
+   XIO_DEFINE_PACKET_SERIALIZE() { aBuff& mPlatformIndex& mIsRawTrack& mTrackId& mIsDelta& mData& mDelta; }
+
+   //! Index of the platform sending the track
+   int32_t mPlatformIndex;
+   //! true if the track is a raw track (WsfTrack), it is a local track (WsfLocalTrack) otherwise
+   bool mIsRawTrack;
+   //! ID of the track, which identifies the baseline to which a delta applies
+   WsfTrackId mTrackId;
+   //! true if the track is sent as mDelta, it is sent as mData otherwise
+   bool mIsDelta;
+   //! The encoded track
+   WsfXIO_TrackEncoding::Buffer mData;
+   //! The changes from the previous encoding of the track sent to the request
+   WsfXIO_TrackEncoding::Delta mDelta;
+};
+
 #endif
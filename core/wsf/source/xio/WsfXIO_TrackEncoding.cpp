@@ -0,0 +1,137 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "xio/WsfXIO_TrackEncoding.hpp"
+
+#include <algorithm>
+
+#include "GenMemIO.hpp"
+#include "PakSerialize.hpp"
+#include "PakSerializeImpl.hpp"
+#include "WsfLocalTrack.hpp"
+#include "WsfTrack.hpp"
+#include "xio/WsfXIO_Defines.hpp"
+
+namespace
+{
+//! The approximate number of bytes needed to send a run in addition to its bytes (the offset and the length).
+//! Runs that are separated by fewer unchanged bytes than this are merged.
+const size_t cRUN_OVERHEAD = 8;
+
+template<typename TRACK>
+void EncodeTrack(const TRACK& aTrack, WsfXIO_TrackEncoding::Buffer& aData)
+{
+   GenBuffer buf;
+   buf.SetBigEndian();
+   PakO ar(&buf);
+   ar&  const_cast<TRACK&>(aTrack);
+   const char* dataPtr = (char*)buf.GetBuffer();
+   aData.assign(dataPtr, dataPtr + buf.GetPutPos());
+}
+
+template<typename TRACK>
+void DecodeTrack(const WsfXIO_TrackEncoding::Buffer& aData, TRACK& aTrack)
+{
+   GenBuffer io(const_cast<char*>(aData.data()), static_cast<int>(aData.size()));
+   io.SetBigEndian();
+   PakI ar(&io);
+   ar&  aTrack;
+}
+} // namespace
+
+// =================================================================================================
+// static
+void WsfXIO_TrackEncoding::Encode(const WsfTrack& aTrack, Buffer& aData)
+{
+   EncodeTrack(aTrack, aData);
+}
+
+// =================================================================================================
+// static
+void WsfXIO_TrackEncoding::Encode(const WsfLocalTrack& aTrack, Buffer& aData)
+{
+   EncodeTrack(aTrack, aData);
+}
+
+// =================================================================================================
+// static
+void WsfXIO_TrackEncoding::Decode(const Buffer& aData, WsfTrack& aTrack)
+{
+   DecodeTrack(aData, aTrack);
+}
+
+// =================================================================================================
+// static
+void WsfXIO_TrackEncoding::Decode(const Buffer& aData, WsfLocalTrack& aTrack)
+{
+   DecodeTrack(aData, aTrack);
+}
+
+// =================================================================================================
+//! Compute the difference between two encodings of a track.
+//! @param aBaseline The earlier encoding, which the receiver holds.
+//! @param aData     The new encoding.
+//! @param aDelta    [output] The runs of aData that differ from aBaseline.
+//! @returns false if a delta cannot be made (the encodings are not the same size) or if it would not be
+//! sufficiently smaller than the new encoding to be worth sending.
+// static
+bool WsfXIO_TrackEncoding::MakeDelta(const Buffer& aBaseline, const Buffer& aData, Delta& aDelta)
+{
+   aDelta.clear();
+   if (aBaseline.size() != aData.size())
+   {
+      return false;
+   }
+
+   size_t deltaSize = 0;
+   size_t index     = 0;
+   while (index < aData.size())
+   {
+      if (aData[index] == aBaseline[index])
+      {
+         ++index;
+         continue;
+      }
+
+      // Extend the run through any differences that are too close to be worth starting a new run.
+      size_t runBegin = index;
+      size_t runEnd   = index + 1;
+      for (size_t next = runEnd; (next < aData.size()) && ((next - runEnd) < cRUN_OVERHEAD); ++next)
+      {
+         if (aData[next] != aBaseline[next])
+         {
+            runEnd = next + 1;
+         }
+      }
+
+      aDelta.emplace_back();
+      aDelta.back().mOffset = static_cast<uint32_t>(runBegin);
+      aDelta.back().mBytes.assign(aData.begin() + runBegin, aData.begin() + runEnd);
+      deltaSize += cRUN_OVERHEAD + (runEnd - runBegin);
+      index = runEnd;
+   }
+   return (2 * deltaSize) <= aData.size();
+}
+
+// =================================================================================================
+//! Apply a delta created by MakeDelta to the baseline encoding.
+//! @returns false if the delta does not fit the baseline, in which case the baseline is not valid.
+// static
+bool WsfXIO_TrackEncoding::ApplyDelta(const Delta& aDelta, Buffer& aBaseline)
+{
+   for (const Run& run : aDelta)
+   {
+      if ((run.mOffset > aBaseline.size()) || (run.mBytes.size() > (aBaseline.size() - run.mOffset)))
+      {
+         return false;
+      }
+      std::copy(run.mBytes.begin(), run.mBytes.end(), aBaseline.begin() + run.mOffset);
+   }
+   return true;
+}
@@ -0,0 +1,57 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFXIO_TRACKENCODING_HPP
+#define WSFXIO_TRACKENCODING_HPP
+
+#include "wsf_export.h"
+
+#include <cstdint>
+#include <vector>
+
+class WsfLocalTrack;
+class WsfTrack;
+
+//! Encodes tracks for WsfXIO_EncodedTrackPkt.
+//!
+//! A track is encoded once into a byte buffer using the same serialization as the track packets, so the buffer
+//! may be sent to every subscription that receives the same track update. A delta is the list of the runs of bytes
+//! in which an encoding differs from an earlier encoding (the baseline) of the same track. A receiver that holds
+//! the baseline applies the delta to it to recover the new encoding.
+class WSF_EXPORT WsfXIO_TrackEncoding
+{
+public:
+   using Buffer = std::vector<char>;
+
+   //! A run of bytes that replaces the bytes of the baseline starting at an offset.
+   struct Run
+   {
+      template<typename T>
+      void Serialize(T& aBuff)
+      {
+         aBuff& mOffset& mBytes;
+      }
+
+      uint32_t mOffset;
+      Buffer   mBytes;
+   };
+
+   using Delta = std::vector<Run>;
+
+   static void Encode(const WsfTrack& aTrack, Buffer& aData);
+   static void Encode(const WsfLocalTrack& aTrack, Buffer& aData);
+
+   static void Decode(const Buffer& aData, WsfTrack& aTrack);
+   static void Decode(const Buffer& aData, WsfLocalTrack& aTrack);
+
+   static bool MakeDelta(const Buffer& aBaseline, const Buffer& aData, Delta& aDelta);
+   static bool ApplyDelta(const Delta& aDelta, Buffer& aBaseline);
+};
+
+#endif
@@ -11,6 +11,8 @@
 
 #include "xio/WsfXIO_TrackRequest.hpp"
 
+#include "WsfLocalTrack.hpp"
+#include "WsfTrack.hpp"
 #include "xio/WsfXIO_Interface.hpp"
 #include "xio/WsfXIO_PacketRegistry.hpp"
 
@@ -116,6 +118,7 @@ WsfXIO_TrackRequest::WsfXIO_TrackRequest(int aRemotePlatformIndex, WsfXIO_Connec
    : WsfXIO_Request(aConnectionPtr, aIsReliable)
    , mRemotePlatformIndex(aRemotePlatformIndex)
    , mRequiredData(WsfXIO_RequestTracksPkt::cALL)
+   , mEncodingOptions(0)
    , mSendInitialTracks(false)
    , mUpdateInterval(0.0)
    , mRealTime(false)
@@ -127,13 +130,27 @@ void WsfXIO_TrackRequest::Initialized()
    WsfXIO_RequestTracksPkt pkt;
    pkt.mPlatformIndex     = mRemotePlatformIndex;
    pkt.mSendInitialTracks = mSendInitialTracks;
-   pkt.mRequiredData      = mRequiredData;
+   pkt.mRequiredData      = mRequiredData | mEncodingOptions;
    pkt.mSensorNameId      = mSensorNameId;
    pkt.mUpdateInterval    = mUpdateInterval;
    pkt.mRealtimeInterval  = mRealTime;
    SendRequest(pkt);
 }
 
+//! Specifies that track updates are to be sent as WsfXIO_EncodedTrackPkt, which the remote application encodes only
+//! once for all of the requests that receive the same update. Encoded tracks are passed to Handle() as if they had
+//! been sent as track packets. Must be used prior to submitting the request.
+//! @param aUseDeltas If true, only the changes to a track since the last update are sent when possible.
+//!                   This applies only to requests with an update interval.
+void WsfXIO_TrackRequest::EnableEncodedTracks(bool aUseDeltas)
+{
+   mEncodingOptions = WsfXIO_RequestTracksPkt::cENCODED_TRACKS;
+   if (aUseDeltas)
+   {
+      mEncodingOptions |= WsfXIO_RequestTracksPkt::cDELTA_TRACKS;
+   }
+}
+
 void WsfXIO_TrackRequest::SetUpdateInterval(double aUpdateInterval, bool aRealTime)
 {
    mUpdateInterval = aUpdateInterval;
@@ -150,10 +167,75 @@ void WsfXIO_TrackRequest::HandleResponse(WsfXIO_ResponsePkt& aPkt)
       Handle((WsfXIO_LocalTrackPkt&)aPkt);
       break;
    case WsfXIO_TrackDropPkt::cPACKET_ID:
-      Handle((WsfXIO_TrackDropPkt&)aPkt);
+   {
+      auto& dropPkt = (WsfXIO_TrackDropPkt&)aPkt;
+      mBaselines.erase(BaselineKey(dropPkt.mIsRawTrack, dropPkt.mTrackId));
+      Handle(dropPkt);
       break;
+   }
    case WsfXIO_RawTrackPkt::cPACKET_ID:
       Handle((WsfXIO_RawTrackPkt&)aPkt);
       break;
+   case WsfXIO_EncodedTrackPkt::cPACKET_ID:
+      HandleEncodedTrack((WsfXIO_EncodedTrackPkt&)aPkt);
+      break;
+   }
+}
+
+//! Decode an encoded track and pass it to Handle() as a track packet.
+void WsfXIO_TrackRequest::HandleEncodedTrack(const WsfXIO_EncodedTrackPkt& aPkt)
+{
+   const WsfXIO_TrackEncoding::Buffer* dataPtr = &aPkt.mData;
+   if ((mEncodingOptions & WsfXIO_RequestTracksPkt::cDELTA_TRACKS) != 0)
+   {
+      BaselineKey key(aPkt.mIsRawTrack, aPkt.mTrackId);
+      if (aPkt.mIsDelta)
+      {
+         auto iter = mBaselines.find(key);
+         if ((iter == mBaselines.end()) || (!WsfXIO_TrackEncoding::ApplyDelta(aPkt.mDelta, iter->second)))
+         {
+            // The baseline is missing or does not match. The track is ignored until it is next sent in full.
+            mBaselines.erase(key);
+            return;
+         }
+         dataPtr = &iter->second;
+      }
+      else
+      {
+         mBaselines[key] = aPkt.mData;
+      }
+   }
+   else if (aPkt.mIsDelta)
+   {
+      return;
+   }
+
+   if (aPkt.mIsRawTrack)
+   {
+      WsfTrack track;
+      WsfXIO_TrackEncoding::Decode(*dataPtr, track);
+      WsfXIO_RawTrackPkt pkt;
+      pkt.mApplicationId = aPkt.mApplicationId;
+      pkt.SetFlags(aPkt.GetFlags());
+      pkt.SetTimeStamp(aPkt.GetTimeStamp());
+      pkt.mFromProvider  = aPkt.mFromProvider;
+      pkt.mRequestId     = aPkt.mRequestId;
+      pkt.mPlatformIndex = aPkt.mPlatformIndex;
+      pkt.mTrack         = &track;
+      Handle(pkt);
+   }
+   else
+   {
+      WsfLocalTrack track;
+      WsfXIO_TrackEncoding::Decode(*dataPtr, track);
+      WsfXIO_LocalTrackPkt pkt;
+      pkt.mApplicationId = aPkt.mApplicationId;
+      pkt.SetFlags(aPkt.GetFlags());
+      pkt.SetTimeStamp(aPkt.GetTimeStamp());
+      pkt.mFromProvider  = aPkt.mFromProvider;
+      pkt.mRequestId     = aPkt.mRequestId;
+      pkt.mPlatformIndex = aPkt.mPlatformIndex;
+      pkt.mTrack         = &track;
+      Handle(pkt);
    }
 }
@@ -14,12 +14,18 @@
 
 #include "wsf_export.h"
 
+#include <map>
+#include <utility>
+
 #include "GenUniqueId.hpp"
 #include "WsfStringId.hpp"
+#include "WsfTrackId.hpp"
+class WsfXIO_EncodedTrackPkt;
 class WsfXIO_LocalTrackPkt;
 class WsfXIO_RawTrackPkt;
 #include "xio/WsfXIO_Request.hpp"
 class WsfXIO_TrackDropPkt;
+#include "xio/WsfXIO_TrackEncoding.hpp"
 
 //! Represents a request for track information.
 //! May be subclassed to handle received tracks
@@ -44,6 +50,8 @@ public:
    //! @param aRequiredData A combination of flags in WsfXIO_RequestTracksPkt::TrackData
    void SetRequiredData(int aRequiredData) { mRequiredData = aRequiredData; }
 
+   void EnableEncodedTracks(bool aUseDeltas);
+
    //! Handle() is called when a messages sent as a response to this request
    //! are received.
    virtual void Handle(const WsfXIO_RawTrackPkt& aPkt) {}
@@ -62,12 +70,20 @@ public:
 protected:
    void Initialized() override;
 
+   void HandleEncodedTrack(const WsfXIO_EncodedTrackPkt& aPkt);
+
+   //! Raw track flag and track ID.
+   using BaselineKey = std::pair<bool, WsfTrackId>;
+
    int         mRemotePlatformIndex;
    int         mRequiredData;
+   int         mEncodingOptions;
    bool        mSendInitialTracks;
    WsfStringId mSensorNameId;
    double      mUpdateInterval;
    bool        mRealTime;
+   //! The last encoding received for each track, to which deltas are applied.
+   std::map<BaselineKey, WsfXIO_TrackEncoding::Buffer> mBaselines;
 };
 
 
@@ -299,12 +299,10 @@ void WsfXIO_PlatformInfoService::SendPartState(const WsfPlatformPart& aPart, int
       WsfXIO_PartStateChangePkt pkt;
       pkt.mPlatformIndex = index;
       FillPartState(aPart, pkt);
-      PlatformInfo& info = i->second;
       for (; i != end; ++i)
       {
          if (i->second.mInfoTypes & aInfoMask)
          {
-            pkt.mRequestId = info.mSubscriptionPtr->GetRequestId();
             i->second.mSubscriptionPtr->SendResponse(pkt);
          }
       }
@@ -664,25 +662,31 @@ void WsfXIO_PlatformInfoService::DR_Change(double aSimTime, WsfExtEntityDeadReck
 }
 void WsfXIO_PlatformInfoService::MoverChanged(WsfPlatform* aPlatformPtr)
 {
-   auto iter = mPlatformInfo.lower_bound(aPlatformPtr->GetIndex());
-   auto last = mPlatformInfo.upper_bound(aPlatformPtr->GetIndex());
+   // The packet is filled once and sent to each subscription for route information.
+   WsfXIO_RouteUpdatePkt pkt;
+   bool                  isFilled = false;
+   auto                  iter     = mPlatformInfo.lower_bound(aPlatformPtr->GetIndex());
+   auto                  last     = mPlatformInfo.upper_bound(aPlatformPtr->GetIndex());
    for (; iter != last; ++iter)
    {
       if (iter->second.mInfoTypes & WsfXIO_RequestPlatformInfoPkt::cROUTE_INFO)
       {
-         WsfXIO_RouteUpdatePkt pkt;
-         pkt.mPlatformIndex       = static_cast<int>(aPlatformPtr->GetIndex());
-         pkt.mRoutePtr            = nullptr;
-         pkt.mTargetWaypointIndex = 0;
-         WsfMover* moverPtr       = aPlatformPtr->GetMover();
-         if (moverPtr != nullptr)
+         if (!isFilled)
          {
-            pkt.mRoutePtr      = const_cast<WsfRoute*>(moverPtr->GetRoute());
-            auto routeMoverPtr = dynamic_cast<WsfRouteMover*>(moverPtr);
-            if (routeMoverPtr != nullptr)
+            pkt.mPlatformIndex       = static_cast<int>(aPlatformPtr->GetIndex());
+            pkt.mRoutePtr            = nullptr;
+            pkt.mTargetWaypointIndex = 0;
+            WsfMover* moverPtr       = aPlatformPtr->GetMover();
+            if (moverPtr != nullptr)
             {
-               pkt.mTargetWaypointIndex = routeMoverPtr->GetTargetIndex();
+               pkt.mRoutePtr      = const_cast<WsfRoute*>(moverPtr->GetRoute());
+               auto routeMoverPtr = dynamic_cast<WsfRouteMover*>(moverPtr);
+               if (routeMoverPtr != nullptr)
+               {
+                  pkt.mTargetWaypointIndex = routeMoverPtr->GetTargetIndex();
+               }
             }
+            isFilled = true;
          }
          iter->second.mSubscriptionPtr->SendResponse(pkt);
       }
@@ -23,9 +23,17 @@
 #include "xio/WsfXIO_PacketRegistry.hpp"
 #include "xio_sim/WsfXIO_Simulation.hpp"
 
+namespace
+{
+//! The number of consecutive deltas after which a track is sent in full.
+//! This bounds the time a receiver that has lost its baseline goes without updates to the track.
+const unsigned int cFULL_REFRESH_COUNT = 20;
+} // namespace
+
 WsfXIO_TrackService::WsfXIO_TrackService(WsfXIO_Simulation& aXIO_Simulation)
    : BaseClassType(aXIO_Simulation.GetInterface())
    , mSimulation(aXIO_Simulation.GetSimulation())
+   , mEncodedTracksPtr(std::make_shared<EncodedTrackCache>(aXIO_Simulation.GetSimulation()))
 {
    mCallbacks.Add(GetInterface()->Connect(&WsfXIO_TrackService::HandleRequest, this));
    mCallbacks.Add(GetInterface()->Connect(&WsfXIO_TrackService::HandleExtendedTrackInfoRequest, this));
@@ -55,7 +63,7 @@ void WsfXIO_TrackService::HandleRequest(WsfXIO_RequestTracksPkt& aPkt)
       }
       else
       {
-         auto eventPtr             = ut::make_unique<UpdateSendEvent>(subPtr, platformPtr);
+         auto eventPtr             = ut::make_unique<UpdateSendEvent>(subPtr, platformPtr, mEncodedTracksPtr);
          eventPtr->mUpdateInterval = aPkt.mUpdateInterval;
          eventPtr->mRequiredData   = aPkt.mRequiredData;
          mUpdateSendEvents.push_back(eventPtr.get());
@@ -74,17 +82,30 @@ void WsfXIO_TrackService::HandleRequest(WsfXIO_RequestTracksPkt& aPkt)
       if (aPkt.mSendInitialTracks)
       {
          int32_t platformIndex = static_cast<int32_t>(platformPtr->GetIndex());
+         bool    isEncoded     = ((aPkt.mRequiredData & WsfXIO_RequestTracksPkt::cENCODED_TRACKS) != 0);
          if (aPkt.mRequiredData & WsfXIO_RequestTracksPkt::cLOCAL_TRACKS)
          {
             WsfLocalTrackList& localTracks = trackManager.GetTrackList();
             for (unsigned int i = 0; i < localTracks.GetTrackCount(); ++i)
             {
-               WsfLocalTrack*       trackPtr = localTracks.GetTrackEntry(i);
-               WsfXIO_LocalTrackPkt pkt;
-               pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
-               pkt.mPlatformIndex = platformIndex;
-               pkt.mTrack         = trackPtr;
-               subPtr->SendResponse(pkt);
+               WsfLocalTrack* trackPtr = localTracks.GetTrackEntry(i);
+               if (isEncoded)
+               {
+                  WsfXIO_EncodedTrackPkt pkt;
+                  pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
+                  pkt.mPlatformIndex = platformIndex;
+                  pkt.mTrackId       = trackPtr->GetTrackId();
+                  pkt.mData          = mEncodedTracksPtr->GetEncoding(platformPtr->GetIndex(), *trackPtr);
+                  subPtr->SendResponse(pkt);
+               }
+               else
+               {
+                  WsfXIO_LocalTrackPkt pkt;
+                  pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
+                  pkt.mPlatformIndex = platformIndex;
+                  pkt.mTrack         = trackPtr;
+                  subPtr->SendResponse(pkt);
+               }
             }
          }
          if (aPkt.mRequiredData & WsfXIO_RequestTracksPkt::cRAW_TRACKS)
@@ -92,11 +113,25 @@ void WsfXIO_TrackService::HandleRequest(WsfXIO_RequestTracksPkt& aPkt)
             WsfTrackList& rawTracks = trackManager.GetRawTrackList();
             for (unsigned int i = 0; i < rawTracks.GetTrackCount(); ++i)
             {
-               WsfXIO_RawTrackPkt pkt;
-               pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
-               pkt.mPlatformIndex = platformIndex;
-               pkt.mTrack         = rawTracks.GetTrackEntry(i);
-               subPtr->SendResponse(pkt);
+               WsfTrack* trackPtr = rawTracks.GetTrackEntry(i);
+               if (isEncoded)
+               {
+                  WsfXIO_EncodedTrackPkt pkt;
+                  pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
+                  pkt.mPlatformIndex = platformIndex;
+                  pkt.mIsRawTrack    = true;
+                  pkt.mTrackId       = trackPtr->GetTrackId();
+                  pkt.mData          = mEncodedTracksPtr->GetEncoding(platformPtr->GetIndex(), *trackPtr);
+                  subPtr->SendResponse(pkt);
+               }
+               else
+               {
+                  WsfXIO_RawTrackPkt pkt;
+                  pkt.SetFlags(WsfXIO_Packet::cSYNCHRONIZED);
+                  pkt.mPlatformIndex = platformIndex;
+                  pkt.mTrack         = trackPtr;
+                  subPtr->SendResponse(pkt);
+               }
             }
          }
       }
@@ -431,10 +466,15 @@ WsfEvent::EventDisposition WsfXIO_TrackService::UpdateSendEvent::Execute()
    {
       return cDELETE;
    }
+   bool isEncoded = ((mRequiredData & WsfXIO_RequestTracksPkt::cENCODED_TRACKS) != 0);
    for (const auto& trackId : mLocalUpdateSet)
    {
       WsfLocalTrack* trackPtr = mTrackManagerPtr->FindTrack(trackId);
-      if (trackPtr != nullptr)
+      if ((trackPtr != nullptr) && isEncoded)
+      {
+         SendEncodedTrack(mEncodedTracksPtr->GetEncoding(mPlatformPtr->GetIndex(), *trackPtr), false, trackId);
+      }
+      else if (trackPtr != nullptr)
       {
          WsfXIO_LocalTrackPkt pkt;
          pkt.mPlatformIndex = static_cast<int32_t>(mPlatformPtr->GetIndex());
@@ -446,7 +486,11 @@ WsfEvent::EventDisposition WsfXIO_TrackService::UpdateSendEvent::Execute()
    for (const auto& trackId : mRawUpdateSet)
    {
       WsfTrack* trackPtr = mTrackManagerPtr->FindRawTrack(trackId);
-      if (trackPtr != nullptr)
+      if ((trackPtr != nullptr) && isEncoded)
+      {
+         SendEncodedTrack(mEncodedTracksPtr->GetEncoding(mPlatformPtr->GetIndex(), *trackPtr), true, trackId);
+      }
+      else if (trackPtr != nullptr)
       {
          WsfXIO_RawTrackPkt pkt;
          pkt.mPlatformIndex = static_cast<int32_t>(mPlatformPtr->GetIndex());
@@ -462,6 +506,7 @@ WsfEvent::EventDisposition WsfXIO_TrackService::UpdateSendEvent::Execute()
       pkt.mPlatformIndex = static_cast<int32_t>(mPlatformPtr->GetIndex());
       pkt.mTrackId       = trackId;
       mSubscriptionPtr->SendResponse(pkt);
+      mBaselines.erase(BaselineKey(false, trackId));
    }
 
    for (const auto& trackId : mRawDropSet)
@@ -471,6 +516,7 @@ WsfEvent::EventDisposition WsfXIO_TrackService::UpdateSendEvent::Execute()
       pkt.mPlatformIndex = static_cast<int32_t>(mPlatformPtr->GetIndex());
       pkt.mTrackId       = trackId;
       mSubscriptionPtr->SendResponse(pkt);
+      mBaselines.erase(BaselineKey(true, trackId));
    }
 
    mLocalUpdateSet.clear();
@@ -482,9 +528,12 @@ WsfEvent::EventDisposition WsfXIO_TrackService::UpdateSendEvent::Execute()
    return cRESCHEDULE;
 }
 
-WsfXIO_TrackService::UpdateSendEvent::UpdateSendEvent(WsfXIO_Subscription* aSubscriptionPtr, WsfPlatform* aPlatformPtr)
+WsfXIO_TrackService::UpdateSendEvent::UpdateSendEvent(WsfXIO_Subscription*               aSubscriptionPtr,
+                                                      WsfPlatform*                       aPlatformPtr,
+                                                      std::shared_ptr<EncodedTrackCache> aEncodedTracksPtr)
    : mSubscriptionPtr(aSubscriptionPtr)
    , mPlatformPtr(aPlatformPtr)
+   , mEncodedTracksPtr(std::move(aEncodedTracksPtr))
 {
    mTrackManagerPtr = &mPlatformPtr->GetTrackManager();
 
@@ -530,4 +579,103 @@ void WsfXIO_TrackService::UpdateSendEvent::Disable()
    mEnabled = false;
    mCallbacks.Clear();
    mTrackManagerPtr = nullptr;
+   mBaselines.clear();
+}
+
+// =================================================================================================
+//! Send an encoded track update to the subscriber.
+//! If the subscriber requested deltas then only the changes from the last encoding sent are sent, except that
+//! the track is sent in full periodically or when the changes are not much smaller than the encoding. Responses
+//! are sent over the reliable connection of the subscription, so the last encoding sent is the baseline held
+//! by the subscriber.
+void WsfXIO_TrackService::UpdateSendEvent::SendEncodedTrack(const WsfXIO_TrackEncoding::Buffer& aData,
+                                                            bool                                aIsRawTrack,
+                                                            const WsfTrackId&                   aTrackId)
+{
+   WsfXIO_EncodedTrackPkt pkt;
+   pkt.mPlatformIndex = static_cast<int32_t>(mPlatformPtr->GetIndex());
+   pkt.mIsRawTrack    = aIsRawTrack;
+   pkt.mTrackId       = aTrackId;
+   if ((mRequiredData & WsfXIO_RequestTracksPkt::cDELTA_TRACKS) != 0)
+   {
+      Baseline& baseline = mBaselines[BaselineKey(aIsRawTrack, aTrackId)];
+      if ((baseline.mDeltaCount < cFULL_REFRESH_COUNT) &&
+          WsfXIO_TrackEncoding::MakeDelta(baseline.mData, aData, pkt.mDelta))
+      {
+         pkt.mIsDelta = true;
+         ++baseline.mDeltaCount;
+      }
+      else
+      {
+         pkt.mDelta.clear();
+         baseline.mDeltaCount = 0;
+      }
+      baseline.mData = aData;
+   }
+   if (!pkt.mIsDelta)
+   {
+      pkt.mData = aData;
+   }
+   mSubscriptionPtr->SendResponse(pkt);
+}
+
+// =================================================================================================
+WsfXIO_TrackService::EncodedTrackCache::EncodedTrackCache(WsfSimulation& aSimulation)
+   : mSimulation(aSimulation)
+   , mSimTime(-1.0)
+   , mEntries()
+{
+}
+
+// =================================================================================================
+//! Return the encoding of the current state of a local track.
+//! The reference is valid until the next call.
+const WsfXIO_TrackEncoding::Buffer&
+WsfXIO_TrackService::EncodedTrackCache::GetEncoding(size_t aPlatformIndex, const WsfLocalTrack& aTrack)
+{
+   Entry& entry = FindEntry(aPlatformIndex, false, aTrack);
+   if (entry.mData.empty())
+   {
+      WsfXIO_TrackEncoding::Encode(aTrack, entry.mData);
+   }
+   return entry.mData;
+}
+
+// =================================================================================================
+//! Return the encoding of the current state of a raw track.
+//! The reference is valid until the next call.
+const WsfXIO_TrackEncoding::Buffer&
+WsfXIO_TrackService::EncodedTrackCache::GetEncoding(size_t aPlatformIndex, const WsfTrack& aTrack)
+{
+   Entry& entry = FindEntry(aPlatformIndex, true, aTrack);
+   if (entry.mData.empty())
+   {
+      WsfXIO_TrackEncoding::Encode(aTrack, entry.mData);
+   }
+   return entry.mData;
+}
+
+// =================================================================================================
+//! Return the cache entry for a track, which is empty if the track has not been encoded in its current state.
+//! Entries are kept only for the current simulation time, and an entry is current only while the update count and
+//! update time of the track are unchanged.
+// private
+WsfXIO_TrackService::EncodedTrackCache::Entry&
+WsfXIO_TrackService::EncodedTrackCache::FindEntry(size_t aPlatformIndex, bool aIsRawTrack, const WsfTrack& aTrack)
+{
+   double simTime = mSimulation.GetSimTime();
+   if (simTime != mSimTime)
+   {
+      mEntries.clear();
+      mSimTime = simTime;
+   }
+
+   Entry& entry = mEntries[Key(aPlatformIndex, aIsRawTrack, aTrack.GetTrackId())];
+   if ((entry.mUpdateCount != aTrack.GetUpdateCount()) || (entry.mUpdateTime != aTrack.GetUpdateTime()))
+   {
+      entry.mUpdateCount = aTrack.GetUpdateCount();
+      entry.mUpdateTime  = aTrack.GetUpdateTime();
+      entry.mData.clear();
+   }
+   return entry;
 }
@@ -15,12 +15,16 @@
 #include "wsf_export.h"
 
 #include <map>
+#include <memory>
 #include <set>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "GenUniqueId.hpp"
 #include "UtCallbackHolder.hpp"
 #include "WsfEvent.hpp"
+class WsfLocalTrack;
 class WsfPlatform;
 class WsfSensor;
 class WsfSimulation;
@@ -32,6 +36,7 @@ class WsfTrackManager;
 class WsfXIO_ExtendedTrackInfoPkt;
 class WsfXIO_ExtendedTrackInfoRequestPkt;
 class WsfXIO_RequestTracksPkt;
+#include "xio/WsfXIO_TrackEncoding.hpp"
 #include "xio_sim/WsfXIO_SimService.hpp"
 class WsfXIO_Simulation;
 
@@ -55,19 +60,62 @@ private:
 
    void UpdateSensorCallbacks();
 
+   //! The encodings of the track updates sent at the current simulation time.
+   //! The encoding of a track update is made once and shared by all of the subscriptions for encoded tracks.
+   class EncodedTrackCache
+   {
+   public:
+      explicit EncodedTrackCache(WsfSimulation& aSimulation);
+
+      const WsfXIO_TrackEncoding::Buffer& GetEncoding(size_t aPlatformIndex, const WsfLocalTrack& aTrack);
+      const WsfXIO_TrackEncoding::Buffer& GetEncoding(size_t aPlatformIndex, const WsfTrack& aTrack);
+
+   private:
+      //! Platform index, raw track flag and track ID.
+      using Key = std::tuple<size_t, bool, WsfTrackId>;
+
+      struct Entry
+      {
+         int                          mUpdateCount{0};
+         double                       mUpdateTime{0.0};
+         WsfXIO_TrackEncoding::Buffer mData;
+      };
+
+      Entry& FindEntry(size_t aPlatformIndex, bool aIsRawTrack, const WsfTrack& aTrack);
+
+      WsfSimulation&       mSimulation;
+      double               mSimTime;
+      std::map<Key, Entry> mEntries;
+   };
+
    // Services requests for track data which do have an update interval.
    // Sends track data on a regular interval, possibly reducing bandwidth.
    class UpdateSendEvent : public WsfEvent
    {
    public:
-      UpdateSendEvent(WsfXIO_Subscription* aSubscriptionPtr, WsfPlatform* aPlatformPtr);
+      UpdateSendEvent(WsfXIO_Subscription*               aSubscriptionPtr,
+                      WsfPlatform*                       aPlatformPtr,
+                      std::shared_ptr<EncodedTrackCache> aEncodedTracksPtr);
       ~UpdateSendEvent() override = default;
       EventDisposition Execute() override;
 
       void Disable();
 
+      void SendEncodedTrack(const WsfXIO_TrackEncoding::Buffer& aData, bool aIsRawTrack, const WsfTrackId& aTrackId);
+
       using TrackIdSet = std::set<WsfTrackId>;
 
+      //! The last encoding of a track sent to the subscriber, from which deltas are made.
+      struct Baseline
+      {
+         WsfXIO_TrackEncoding::Buffer mData;
+         //! The number of deltas sent since the encoding was last sent in full.
+         unsigned int mDeltaCount{0};
+      };
+
+      //! Raw track flag and track ID.
+      using BaselineKey = std::pair<bool, WsfTrackId>;
+
       double               mUpdateInterval;
       bool                 mEnabled{true};
       int                  mRequiredData{0};
@@ -80,6 +128,9 @@ private:
       TrackIdSet mRawUpdateSet;
       TrackIdSet mRawDropSet;
 
+      std::shared_ptr<EncodedTrackCache> mEncodedTracksPtr;
+      std::map<BaselineKey, Baseline>    mBaselines;
+
       UtCallbackHolder mCallbacks;
    };
 
@@ -123,6 +174,8 @@ private:
    SensorObserverMap   mSensorObservers;
    //! List of all active UpdateSendEvents.
    std::vector<UpdateSendEvent*> mUpdateSendEvents;
+   //! Encodings of track updates, shared by the subscriptions for encoded tracks.
+   std::shared_ptr<EncodedTrackCache> mEncodedTracksPtr;
 };
 
 #endif